@@ -0,0 +1,465 @@
+#include <string.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "anytime.h"
+#include "cfop.h"
+#include "optimize.h"
+#include "pattern.h"
+#include "subgroup.h"
+
+#define PHASE1_TWISTS           2187   // 3^7: the last corner's twist follows from the others.
+#define PHASE1_FLIPS            2048   // 2^11
+#define PHASE1_SLICES           495    // 12 choose 4: which slots the E slice edges are in.
+#define PHASE1_MOVES            18     // Face turn * 3 + direction, in the order of moveDirections.
+#define PHASE1_UNREACHED        255
+
+static const int moveDirections[3] = { CLOCKWISE, ANTI_CLOCKWISE, HALF_TURN };
+
+// The move tables of phase one's coordinates, its pruning tables and the domino group for phase two.
+struct AnytimeTables {
+    Move moves[PHASE1_MOVES];
+    bool keepsDomino[PHASE1_MOVES];     // The move stays in the domino group.
+    bool allowed[PHASE1_MOVES + 1][PHASE1_MOVES];       // By last move + 1 (0 for none) and move.
+    bool sliceEdge[SUBGROUP_EDGES];     // The edge belongs in the E slice.
+    uint16_t sliceMasks[PHASE1_SLICES]; // The slots holding E slice edges, by slice number.
+    int16_t sliceOfMask[1 << SUBGROUP_EDGES];
+    int solvedSlice;
+    uint16_t twistMoves[PHASE1_TWISTS][PHASE1_MOVES];
+    uint16_t flipMoves[PHASE1_FLIPS][PHASE1_MOVES];
+    uint16_t sliceMoves[PHASE1_SLICES][PHASE1_MOVES];
+    std::vector<unsigned char> twistSlice;      // By twist * PHASE1_SLICES + slice.
+    std::vector<unsigned char> flipSlice;       // By flip * PHASE1_SLICES + slice.
+    Subgroup domino;
+
+    AnytimeTables();
+};
+
+// The state of a search.
+struct AnytimeSearch {
+    const AnytimeTables* tables;
+    Cube cube;
+    int path[SEARCH_MAX_MOVES];
+    std::vector<Move> best;
+    std::chrono::steady_clock::time_point deadline;
+    const std::atomic<bool>* cancel;
+    SearchCallback improved;
+    void* context;
+    long long nodes;
+    int result;                         // An ANYTIME_ result once the search should end, or -1.
+};
+
+static void SolvedPieces(CubePieces& pieces)
+{
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        pieces.corners[corner] = (unsigned char)corner;
+        pieces.twists[corner] = 0;
+    }
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        pieces.edges[edge] = (unsigned char)edge;
+        pieces.flips[edge] = 0;
+    }
+}
+
+static int EncodeTwist(const CubePieces& pieces)
+{
+    int twist = 0;
+    for (int corner = SUBGROUP_CORNERS - 2; corner >= 0; corner--) {
+        twist = twist * 3 + pieces.twists[corner];
+    }
+    return twist;
+}
+
+static void DecodeTwist(int twist, CubePieces& pieces)
+{
+    int total = 0;
+    for (int corner = 0; corner < SUBGROUP_CORNERS - 1; corner++) {
+        pieces.twists[corner] = (unsigned char)(twist % 3);
+        total += twist % 3;
+        twist /= 3;
+    }
+    pieces.twists[SUBGROUP_CORNERS - 1] = (unsigned char)((3 - total % 3) % 3);
+}
+
+static int EncodeFlip(const CubePieces& pieces)
+{
+    int flip = 0;
+    for (int edge = SUBGROUP_EDGES - 2; edge >= 0; edge--) {
+        flip = flip * 2 + pieces.flips[edge];
+    }
+    return flip;
+}
+
+static void DecodeFlip(int flip, CubePieces& pieces)
+{
+    int total = 0;
+    for (int edge = 0; edge < SUBGROUP_EDGES - 1; edge++) {
+        pieces.flips[edge] = (unsigned char)(flip & 1);
+        total += flip & 1;
+        flip >>= 1;
+    }
+    pieces.flips[SUBGROUP_EDGES - 1] = (unsigned char)(total & 1);
+}
+
+static int EncodeSlice(const AnytimeTables& tables, const CubePieces& pieces)
+{
+    int mask = 0;
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        if (tables.sliceEdge[pieces.edges[edge]])
+            mask |= 1 << edge;
+    }
+    return tables.sliceOfMask[mask];
+}
+
+// Puts the E slice edges in the slots of the slice number and the others in the rest, in order.
+static void DecodeSlice(const AnytimeTables& tables, int slice, CubePieces& pieces)
+{
+    int sliceEdges[SUBGROUP_EDGES], otherEdges[SUBGROUP_EDGES];
+    int numSlice = 0, numOther = 0;
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        if (tables.sliceEdge[edge])
+            sliceEdges[numSlice++] = edge;
+        else
+            otherEdges[numOther++] = edge;
+    }
+    numSlice = numOther = 0;
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        if (tables.sliceMasks[slice] & (1 << edge))
+            pieces.edges[edge] = (unsigned char)sliceEdges[numSlice++];
+        else
+            pieces.edges[edge] = (unsigned char)otherEdges[numOther++];
+    }
+}
+
+// Fills a table of two coordinates, the second of them the slice, by a BFS from solved.
+static void FillPhase1Table(std::vector<unsigned char>& table, const uint16_t (*moves)[PHASE1_MOVES], int size,
+                            const uint16_t (*sliceMoves)[PHASE1_MOVES], int solvedSlice)
+{
+    table.assign((size_t)size * PHASE1_SLICES, PHASE1_UNREACHED);
+    table[solvedSlice] = 0;
+    bool grew = true;
+    for (int depth = 0; grew; depth++) {
+        grew = false;
+        for (int value = 0; value < size; value++) {
+            for (int slice = 0; slice < PHASE1_SLICES; slice++) {
+                if (table[(size_t)value * PHASE1_SLICES + slice] != depth)
+                    continue;
+                for (int move = 0; move < PHASE1_MOVES; move++) {
+                    size_t next = (size_t)moves[value][move] * PHASE1_SLICES + sliceMoves[slice][move];
+                    if (table[next] == PHASE1_UNREACHED) {
+                        table[next] = (unsigned char)(depth + 1);
+                        grew = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+AnytimeTables::AnytimeTables()
+{
+    Cube solved;
+    InitCube(solved);
+    CubePieces movePieces[PHASE1_MOVES];
+    for (int move = 0; move < PHASE1_MOVES; move++) {
+        moves[move].turn = move / 3;
+        moves[move].direction = moveDirections[move % 3];
+        moves[move].inputTime = 0.0;
+        keepsDomino[move] = moves[move].turn == TURN_U || moves[move].turn == TURN_D || moves[move].direction == HALF_TURN;
+        Cube cube = solved;
+        ApplyMove(cube, moves[move]);
+        ReadCubePieces(cube, movePieces[move]);
+    }
+
+    // A move is allowed after another unless it turns the same face, or the opposite face when that
+    // comes first in TURN_ order, since the two commute.
+    for (int last = 0; last <= PHASE1_MOVES; last++) {
+        for (int move = 0; move < PHASE1_MOVES; move++) {
+            int face = moves[move].turn;
+            int lastFace = (last > 0) ? moves[last - 1].turn : TURN_NONE;
+            int axis, lastAxis, layers, sign;
+            TurnLayers(face, &axis, &layers, &sign);
+            if (last > 0)
+                TurnLayers(lastFace, &lastAxis, &layers, &sign);
+            allowed[last][move] = (last == 0) || (face != lastFace && (axis != lastAxis || face > lastFace));
+        }
+    }
+
+    // The E slice edges are the ones neither U nor D moves.
+    const CubePieces& up = movePieces[TURN_U * 3];
+    const CubePieces& down = movePieces[TURN_D * 3];
+    int solvedMask = 0;
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        sliceEdge[edge] = up.edges[edge] == edge && down.edges[edge] == edge;
+        if (sliceEdge[edge])
+            solvedMask |= 1 << edge;
+    }
+    int numSlices = 0;
+    for (int mask = 0; mask < (1 << SUBGROUP_EDGES); mask++) {
+        int bits = 0;
+        for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+            bits += (mask >> edge) & 1;
+        }
+        sliceOfMask[mask] = -1;
+        if (bits == 4) {
+            sliceMasks[numSlices] = (uint16_t)mask;
+            sliceOfMask[mask] = (int16_t)numSlices++;
+        }
+    }
+    solvedSlice = sliceOfMask[solvedMask];
+
+    CubePieces pieces, moved;
+    SolvedPieces(pieces);
+    for (int twist = 0; twist < PHASE1_TWISTS; twist++) {
+        DecodeTwist(twist, pieces);
+        for (int move = 0; move < PHASE1_MOVES; move++) {
+            MoveCubePieces(movePieces[move], pieces, moved);
+            twistMoves[twist][move] = (uint16_t)EncodeTwist(moved);
+        }
+    }
+    SolvedPieces(pieces);
+    for (int flip = 0; flip < PHASE1_FLIPS; flip++) {
+        DecodeFlip(flip, pieces);
+        for (int move = 0; move < PHASE1_MOVES; move++) {
+            MoveCubePieces(movePieces[move], pieces, moved);
+            flipMoves[flip][move] = (uint16_t)EncodeFlip(moved);
+        }
+    }
+    SolvedPieces(pieces);
+    for (int slice = 0; slice < PHASE1_SLICES; slice++) {
+        DecodeSlice(*this, slice, pieces);
+        for (int move = 0; move < PHASE1_MOVES; move++) {
+            MoveCubePieces(movePieces[move], pieces, moved);
+            sliceMoves[slice][move] = (uint16_t)EncodeSlice(*this, moved);
+        }
+    }
+    FillPhase1Table(twistSlice, twistMoves, PHASE1_TWISTS, sliceMoves, solvedSlice);
+    FillPhase1Table(flipSlice, flipMoves, PHASE1_FLIPS, sliceMoves, solvedSlice);
+
+    std::vector<Move> generators;
+    ParseGenerators(SUBGROUP_DOMINO, generators);
+    BuildSubgroup(generators, domino);
+}
+
+static const AnytimeTables& GetAnytimeTables()
+{
+    static const AnytimeTables tables;
+    return tables;
+}
+
+static int Phase1Distance(const AnytimeTables& tables, int twist, int flip, int slice)
+{
+    int twistDistance = tables.twistSlice[(size_t)twist * PHASE1_SLICES + slice];
+    int flipDistance = tables.flipSlice[(size_t)flip * PHASE1_SLICES + slice];
+    return (twistDistance > flipDistance) ? twistDistance : flipDistance;
+}
+
+// Finishes a way into the domino group of the given length in fewer moves than the best, if there
+// is such a finish, and streams the solution.
+static void SearchPhase2(AnytimeSearch& search, int length)
+{
+    const AnytimeTables& tables = *search.tables;
+    // A way in whose last move stays in the group was already tried a move shorter.
+    if (length > 0 && tables.keepsDomino[search.path[length - 1]])
+        return;
+    int maxLength = (int)search.best.size() - 1 - length;
+    if (maxLength < 0)
+        return;
+
+    Cube cube = search.cube;
+    for (int i = 0; i < length; i++) {
+        ApplyMove(cube, tables.moves[search.path[i]]);
+    }
+    std::vector<Move> finish;
+    if (SolveInSubgroup(tables.domino, cube, maxLength, finish) != SUBGROUP_FOUND)
+        return;
+
+    // The finish may start by turning the face the way in ended with, so the two are merged.
+    std::vector<Move> solution;
+    for (int i = 0; i < length; i++) {
+        solution.push_back(tables.moves[search.path[i]]);
+    }
+    solution.insert(solution.end(), finish.begin(), finish.end());
+    OptimizeMoves(solution, search.best);
+    if (!search.improved(search.best, search.context))
+        search.result = ANYTIME_STOPPED;
+}
+
+static void SearchPhase1(AnytimeSearch& search, int twist, int flip, int slice, int depth, int maxDepth, int lastMove)
+{
+    if (++search.nodes % ANYTIME_CHECK_INTERVAL == 0) {
+        if (search.cancel != NULL && search.cancel->load()) {
+            search.result = ANYTIME_STOPPED;
+            return;
+        }
+        if (std::chrono::steady_clock::now() >= search.deadline) {
+            search.result = ANYTIME_TIMED_OUT;
+            return;
+        }
+    }
+
+    const AnytimeTables& tables = *search.tables;
+    if (depth + Phase1Distance(tables, twist, flip, slice) > maxDepth)
+        return;
+    if (depth == maxDepth) {
+        SearchPhase2(search, depth);
+        return;
+    }
+    for (int move = 0; move < PHASE1_MOVES && search.result < 0; move++) {
+        if (!tables.allowed[lastMove + 1][move])
+            continue;
+        search.path[depth] = move;
+        SearchPhase1(search, tables.twistMoves[twist][move], tables.flipMoves[flip][move], tables.sliceMoves[slice][move],
+                     depth + 1, maxDepth, move);
+    }
+}
+
+void InitAnytimeOptions(AnytimeOptions& options)
+{
+    options.timeLimit = ANYTIME_DEFAULT_TIME;
+    options.cancel = NULL;
+}
+
+int SolveAnytime(const Cube& cube, const AnytimeOptions& options, SearchCallback improved, void* context)
+{
+    AnytimeSearch search;
+    search.deadline = std::chrono::steady_clock::now() +
+                      std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(options.timeLimit));
+
+    // Rotations only change how the cube is held, so they are left out of the first solution.
+    CfopSolution cfop;
+    if (!SolveCfop(cube, cfop))
+        return ANYTIME_UNSOLVABLE;
+    std::vector<Move> optimized;
+    OptimizeMoves(cfop.moves, optimized);
+    for (size_t i = 0; i < optimized.size(); i++) {
+        if (optimized[i].turn < TURN_X)
+            search.best.push_back(optimized[i]);
+    }
+    if (!improved(search.best, context))
+        return ANYTIME_STOPPED;
+    if (search.best.empty())
+        return ANYTIME_OPTIMAL;
+    if (options.cancel != NULL && options.cancel->load())
+        return ANYTIME_STOPPED;
+    if (std::chrono::steady_clock::now() >= search.deadline)
+        return ANYTIME_TIMED_OUT;
+
+    search.tables = &GetAnytimeTables();
+    search.cube = cube;
+    search.cancel = options.cancel;
+    search.improved = improved;
+    search.context = context;
+    search.nodes = 0;
+    search.result = -1;
+
+    Cube recoloured;
+    RecolourByCentres(cube, recoloured);
+    CubePieces pieces;
+    if (!ReadCubePieces(recoloured, pieces))
+        return ANYTIME_UNSOLVABLE;
+    int twist = EncodeTwist(pieces);
+    int flip = EncodeFlip(pieces);
+    int slice = EncodeSlice(*search.tables, pieces);
+
+    int depth = Phase1Distance(*search.tables, twist, flip, slice);
+    for (; depth < (int)search.best.size() && depth < SEARCH_MAX_MOVES; depth++) {
+        SearchPhase1(search, twist, flip, slice, 0, depth, -1);
+        if (search.result >= 0)
+            return search.result;
+    }
+    return (depth >= (int)search.best.size()) ? ANYTIME_OPTIMAL : ANYTIME_TIMED_OUT;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// BACKGROUND SOLVING
+/////////////////////////////////////////////////////////////////////////////
+
+static std::thread* backgroundThread = NULL;
+static std::mutex backgroundMutex;
+static std::condition_variable backgroundWakeup;
+static std::atomic<bool> backgroundCancel(false);
+static bool backgroundQuit = false;
+static unsigned int backgroundGeneration = 0;   // Counts the cubes given, so old results are told apart.
+static Cube backgroundCube;
+static double backgroundTimeLimit;
+static AnytimeStatus backgroundStatus;
+
+static bool BackgroundImproved(const std::vector<Move>& solution, void* context)
+{
+    unsigned int generation = *(const unsigned int*)context;
+    std::lock_guard<std::mutex> lock(backgroundMutex);
+    if (generation == backgroundGeneration) {
+        backgroundStatus.solution = solution;
+        backgroundStatus.found = true;
+    }
+    return true;
+}
+
+static void BackgroundThread()
+{
+    std::unique_lock<std::mutex> lock(backgroundMutex);
+    unsigned int generation = 0;
+    for (;;) {
+        backgroundWakeup.wait(lock, [&generation] { return backgroundQuit || backgroundGeneration != generation; });
+        if (backgroundQuit)
+            return;
+        generation = backgroundGeneration;
+        Cube cube = backgroundCube;
+        AnytimeOptions options;
+        InitAnytimeOptions(options);
+        options.timeLimit = backgroundTimeLimit;
+        options.cancel = &backgroundCancel;
+        backgroundCancel = false;
+        lock.unlock();
+
+        int result = SolveAnytime(cube, options, BackgroundImproved, &generation);
+
+        lock.lock();
+        if (generation == backgroundGeneration) {
+            backgroundStatus.running = false;
+            backgroundStatus.optimal = (result == ANYTIME_OPTIMAL);
+        }
+    }
+}
+
+void StartBackgroundSolve(const Cube& cube, double timeLimit)
+{
+    std::lock_guard<std::mutex> lock(backgroundMutex);
+    backgroundCube = cube;
+    backgroundTimeLimit = timeLimit;
+    backgroundGeneration++;
+    backgroundCancel = true;
+    backgroundStatus.cube = cube;
+    backgroundStatus.solution.clear();
+    backgroundStatus.found = false;
+    backgroundStatus.running = true;
+    backgroundStatus.optimal = false;
+    if (backgroundThread == NULL)
+        backgroundThread = new std::thread(BackgroundThread);
+    backgroundWakeup.notify_one();
+}
+
+void GetBackgroundSolve(AnytimeStatus& status)
+{
+    std::lock_guard<std::mutex> lock(backgroundMutex);
+    status = backgroundStatus;
+}
+
+void StopBackgroundSolve()
+{
+    if (backgroundThread == NULL)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(backgroundMutex);
+        backgroundQuit = true;
+        backgroundCancel = true;
+    }
+    backgroundWakeup.notify_one();
+    backgroundThread->join();
+    delete backgroundThread;
+    backgroundThread = NULL;
+}
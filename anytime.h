@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "cube.h"
+#include "search.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// ANYTIME SOLVER
+//
+// Solves the cube at once and then keeps looking for shorter solutions
+// until a deadline, so there is always an answer and it is better the
+// longer the caller waits:
+//
+// - The first solution is the CFOP solver's with its cancelling moves
+//   merged (see cfop.h and optimize.h), found in microseconds.
+// - Then a two-phase search: IDA* over the 18 face turns into the domino
+//   group <U,D,L2,R2,F2,B2> (corners twisted, edges flipped and E slice
+//   edges in the E slice, bounded by tables of twists by slice and flips
+//   by slice), and for each way in, the domino subgroup solver finishes
+//   the cube in the fewest moves that would beat the best so far. Every
+//   shorter solution is streamed out as it's found.
+//
+// Any solution shorter than the best starts with a way into the domino
+// group whose last move isn't a domino move, followed by only domino moves,
+// so once every way in one move shorter than the best has been tried, the
+// best is optimal in face turns. That happens quickly for cubes a dozen
+// or so moves from solved; for others the deadline comes first.
+//
+// The tables (about 2 MB, and the domino group's) are built the first time
+// after the first solution is out, in about half a second.
+/////////////////////////////////////////////////////////////////////////////
+
+#define ANYTIME_DEFAULT_TIME    5.0    // Default seconds to look for shorter solutions.
+#define ANYTIME_CHECK_INTERVAL  1024   // Phase one nodes between looks at the clock.
+
+#define ANYTIME_OPTIMAL         0      // The last solution streamed is optimal.
+#define ANYTIME_TIMED_OUT       1      // The deadline passed first.
+#define ANYTIME_STOPPED         2      // The callback asked to stop, or cancel was set.
+#define ANYTIME_UNSOLVABLE      3      // The cube can't be solved (e.g. a corner twisted in place).
+
+struct AnytimeOptions {
+    double timeLimit;                   // Seconds from the call to look for shorter solutions.
+    const std::atomic<bool>* cancel;    // Stops the search when set, or NULL.
+};
+
+// Sets options to ANYTIME_DEFAULT_TIME and no cancel flag.
+void InitAnytimeOptions(AnytimeOptions& options);
+
+// Calls improved with a solution of the cube, then with each strictly shorter one, until the time is
+// up or the last is known to be optimal. Solutions are oriented like moves applied with ApplyMove.
+// Returns an ANYTIME_ result.
+int SolveAnytime(const Cube& cube, const AnytimeOptions& options, SearchCallback improved, void* context);
+
+/////////////////////////////////////////////////////////////////////////////
+// BACKGROUND SOLVING
+//
+// For the viewer: one worker thread runs SolveAnytime on the last cube it
+// was given, and the best solution so far can be read at any time. Giving
+// it a new cube cancels the search of the old one without waiting for it.
+/////////////////////////////////////////////////////////////////////////////
+
+struct AnytimeStatus {
+    Cube cube;                          // The cube being solved.
+    std::vector<Move> solution;         // The best so far, if found.
+    bool found;
+    bool running;
+    bool optimal;
+};
+
+// Starts solving a cube on the worker thread, starting the thread the first time.
+void StartBackgroundSolve(const Cube& cube, double timeLimit);
+
+// Sets status to how the solve of the last cube given is going.
+void GetBackgroundSolve(AnytimeStatus& status);
+
+// Stops the worker thread, if it was started.
+void StopBackgroundSolve();
@@ -0,0 +1,353 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __APPLE__
+#define GL_SILENCE_DEPRECATION
+#include <GLUT/glut.h>
+#else
+#include <GL/glut.h>
+#endif
+
+#include "capture.h"
+#include "image.h"
+#include "lockfree.h"
+#include "trace.h"
+
+// Pixel buffer objects are core since OpenGL 2.1, which the Windows headers predate.
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+#define CAPTURE_GL_PIXEL_PACK_BUFFER    0x88EB
+#define CAPTURE_GL_STREAM_READ          0x88E1
+#define CAPTURE_GL_READ_ONLY            0x88B8
+
+typedef void (APIENTRY* GenBuffersProc)(GLsizei n, GLuint* buffers);
+typedef void (APIENTRY* DeleteBuffersProc)(GLsizei n, const GLuint* buffers);
+typedef void (APIENTRY* BindBufferProc)(GLenum target, GLuint buffer);
+typedef void (APIENTRY* BufferDataProc)(GLenum target, ptrdiff_t size, const void* data, GLenum usage);
+typedef void* (APIENTRY* MapBufferProc)(GLenum target, GLenum access);
+typedef GLboolean(APIENTRY* UnmapBufferProc)(GLenum target);
+
+// A frame waiting to be, or being, written by an encoder thread.
+struct CapturedFrame {
+    std::vector<unsigned char> pixels;
+    int width;
+    int height;
+    int format;
+    bool report;            // Print whether it was saved, once it is written.
+    char filename[CAPTURE_MAX_FILENAME];
+};
+
+// A pixel buffer object and the frame being read into it.
+struct PixelBufferSlot {
+    GLuint buffer;
+    size_t size;            // Bytes allocated for the buffer.
+    bool busy;              // A read has been issued and not yet mapped.
+    int width;
+    int height;
+    int format;
+    bool report;
+    char filename[CAPTURE_MAX_FILENAME];
+};
+
+static GenBuffersProc genBuffers = NULL;
+static DeleteBuffersProc deleteBuffers = NULL;
+static BindBufferProc bindBuffer = NULL;
+static BufferDataProc bufferData = NULL;
+static MapBufferProc mapBuffer = NULL;
+static UnmapBufferProc unmapBuffer = NULL;
+static bool usePixelBuffers = false;
+
+static bool captureRunning = false;
+static bool dropFrames = true;      // Drop frames when the encoders fall behind, rather than wait for them.
+static PixelBufferSlot slots[CAPTURE_NUM_PBOS];
+static int nextSlot = 0;
+
+// Frames are handed between the render thread and the encoders by index. freeFrames holds the
+// frames nobody is using, pendingFrames the frames waiting to be written.
+static CapturedFrame frames[CAPTURE_MAX_PENDING];
+static LockFreeQueue<int, CAPTURE_MAX_PENDING> freeFrames;
+static LockFreeQueue<int, CAPTURE_MAX_PENDING> pendingFrames;
+
+// The render thread only takes encoderMutex to hand over a frame or to wait for the encoders.
+// Encoders are started as frames back up, up to maxEncoders, and sleep without a timeout.
+static std::vector<std::thread> encoders;
+static int maxEncoders = 1;
+static std::mutex encoderMutex;
+static std::condition_variable encoderWakeup;   // A frame was queued, or the encoders should stop.
+static std::condition_variable frameReturned;   // A frame went back to freeFrames.
+static int queuedFrames = 0;        // Frames in pendingFrames no encoder has taken yet.
+static int idleEncoders = 0;        // Encoders waiting for a frame.
+static int framesInFlight = 0;      // Frames taken from freeFrames and not yet returned.
+static bool stopEncoders = false;
+
+static std::atomic<int> framesCaptured(0);
+static std::atomic<int> framesWritten(0);
+static std::atomic<int> framesDropped(0);
+static std::atomic<int> writeErrors(0);
+
+// Puts a frame back in freeFrames and wakes anyone waiting for one.
+static void ReturnFrame(int index)
+{
+    freeFrames.Push(index);
+    std::lock_guard<std::mutex> lock(encoderMutex);
+    framesInFlight--;
+    frameReturned.notify_all();
+}
+
+// Writes frames until told to stop and every queued frame is written. Idle encoders sleep until
+// a frame is queued.
+static void EncoderThread()
+{
+    TRACE_THREAD_NAME("encoder");
+    std::unique_lock<std::mutex> lock(encoderMutex);
+    for (;;) {
+        idleEncoders++;
+        encoderWakeup.wait(lock, [] { return queuedFrames > 0 || stopEncoders; });
+        idleEncoders--;
+        if (queuedFrames == 0)
+            return;
+        queuedFrames--;
+        lock.unlock();
+
+        // Every queued frame was pushed before it was counted.
+        int index = 0;
+        pendingFrames.Pop(index);
+        CapturedFrame& frame = frames[index];
+        bool written;
+        {
+            TRACE_SCOPE("WriteImage");
+            written = WriteImage(frame.filename, frame.format, frame.pixels.data(), frame.width, frame.height);
+        }
+        if (written)
+            framesWritten++;
+        else
+            writeErrors++;
+        if (frame.report)
+            printf(written ? "Saved %s\n" : "Couldn't write %s\n", frame.filename);
+        ReturnFrame(index);
+        lock.lock();
+    }
+}
+
+// Takes a free frame for the given image. If all of them are waiting to be written, either
+// returns -1 or waits for the encoders to free one.
+static int AcquireFrame(int width, int height, int format, bool report, const char* filename)
+{
+    int index;
+    if (!freeFrames.Pop(index)) {
+        if (dropFrames) {
+            framesDropped++;
+            if (report)
+                printf("Couldn't save %s, the frames before it are still being written.\n", filename);
+            return -1;
+        }
+        std::unique_lock<std::mutex> lock(encoderMutex);
+        frameReturned.wait(lock, [&index] { return freeFrames.Pop(index); });
+    }
+    {
+        std::lock_guard<std::mutex> lock(encoderMutex);
+        framesInFlight++;
+    }
+
+    CapturedFrame& frame = frames[index];
+    frame.pixels.resize((size_t)width * height * 3);
+    frame.width = width;
+    frame.height = height;
+    frame.format = format;
+    frame.report = report;
+    snprintf(frame.filename, sizeof(frame.filename), "%s", filename);
+    return index;
+}
+
+// Queues a frame for the encoders, starting another if every one is busy.
+static void SubmitFrame(int index)
+{
+    pendingFrames.Push(index);
+    std::lock_guard<std::mutex> lock(encoderMutex);
+    queuedFrames++;
+    if (queuedFrames > idleEncoders && (int)encoders.size() < maxEncoders)
+        encoders.push_back(std::thread(EncoderThread));
+    encoderWakeup.notify_one();
+}
+
+// Maps a slot whose read was issued CAPTURE_NUM_PBOS - 1 frames ago, by which time the copy has
+// finished, and passes its pixels to the encoders.
+static void RetireSlot(PixelBufferSlot& slot)
+{
+    if (!slot.busy)
+        return;
+    slot.busy = false;
+
+    int index = AcquireFrame(slot.width, slot.height, slot.format, slot.report, slot.filename);
+    if (index < 0)
+        return;
+
+    bindBuffer(CAPTURE_GL_PIXEL_PACK_BUFFER, slot.buffer);
+    const unsigned char* data = (const unsigned char*)mapBuffer(CAPTURE_GL_PIXEL_PACK_BUFFER, CAPTURE_GL_READ_ONLY);
+    if (data != NULL) {
+        memcpy(frames[index].pixels.data(), data, frames[index].pixels.size());
+        unmapBuffer(CAPTURE_GL_PIXEL_PACK_BUFFER);
+    }
+    bindBuffer(CAPTURE_GL_PIXEL_PACK_BUFFER, 0);
+
+    if (data != NULL) {
+        SubmitFrame(index);
+    }
+    else {
+        writeErrors++;
+        if (slot.report)
+            printf("Couldn't write %s\n", slot.filename);
+        ReturnFrame(index);
+    }
+}
+
+void StartCapture(CaptureProcLoader loader, int numThreads, bool dropWhenBehind)
+{
+    if (captureRunning)
+        return;
+    dropFrames = dropWhenBehind;
+
+    genBuffers = (GenBuffersProc)loader("glGenBuffers");
+    deleteBuffers = (DeleteBuffersProc)loader("glDeleteBuffers");
+    bindBuffer = (BindBufferProc)loader("glBindBuffer");
+    bufferData = (BufferDataProc)loader("glBufferData");
+    mapBuffer = (MapBufferProc)loader("glMapBuffer");
+    unmapBuffer = (UnmapBufferProc)loader("glUnmapBuffer");
+    usePixelBuffers = genBuffers != NULL && deleteBuffers != NULL && bindBuffer != NULL && bufferData != NULL && mapBuffer != NULL && unmapBuffer != NULL;
+
+    for (int i = 0; i < CAPTURE_NUM_PBOS; i++) {
+        slots[i].buffer = 0;
+        slots[i].size = 0;
+        slots[i].busy = false;
+        if (usePixelBuffers)
+            genBuffers(1, &slots[i].buffer);
+    }
+    nextSlot = 0;
+
+    int index;
+    while (freeFrames.Pop(index)) {
+    }
+    for (int i = 0; i < CAPTURE_MAX_PENDING; i++) {
+        freeFrames.Push(i);
+    }
+    framesCaptured = 0;
+    framesWritten = 0;
+    framesDropped = 0;
+    writeErrors = 0;
+
+    stopEncoders = false;
+    maxEncoders = (numThreads < 1) ? 1 : numThreads;
+    captureRunning = true;
+}
+
+// Queues a read of the current read buffer, as CaptureFrame.
+static void ReadFrame(int width, int height, int format, bool report, const char* filename)
+{
+    if (!captureRunning)
+        return;
+    TRACE_SCOPE("CaptureFrame");
+    framesCaptured++;
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    if (!usePixelBuffers) {
+        int index = AcquireFrame(width, height, format, report, filename);
+        if (index >= 0) {
+            glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, frames[index].pixels.data());
+            SubmitFrame(index);
+        }
+        return;
+    }
+
+    // The slot about to be reused holds the oldest read in flight.
+    PixelBufferSlot& slot = slots[nextSlot];
+    nextSlot = (nextSlot + 1) % CAPTURE_NUM_PBOS;
+    RetireSlot(slot);
+
+    size_t size = (size_t)width * height * 3;
+    bindBuffer(CAPTURE_GL_PIXEL_PACK_BUFFER, slot.buffer);
+    if (slot.size != size) {
+        bufferData(CAPTURE_GL_PIXEL_PACK_BUFFER, (ptrdiff_t)size, NULL, CAPTURE_GL_STREAM_READ);
+        slot.size = size;
+    }
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, (void*)0);
+    bindBuffer(CAPTURE_GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.busy = true;
+    slot.width = width;
+    slot.height = height;
+    slot.format = format;
+    slot.report = report;
+    snprintf(slot.filename, sizeof(slot.filename), "%s", filename);
+}
+
+void CaptureFrame(int width, int height, int format, const char* filename)
+{
+    ReadFrame(width, height, format, false, filename);
+}
+
+void CaptureScreenshot(int width, int height, int format, const char* filename)
+{
+    ReadFrame(width, height, format, true, filename);
+}
+
+void RetireCapture()
+{
+    if (!captureRunning)
+        return;
+
+    // Retire the slots oldest first so frames are queued in the order they were captured.
+    for (int i = 0; i < CAPTURE_NUM_PBOS; i++) {
+        RetireSlot(slots[(nextSlot + i) % CAPTURE_NUM_PBOS]);
+    }
+}
+
+void FlushCapture()
+{
+    if (!captureRunning)
+        return;
+    RetireCapture();
+    std::unique_lock<std::mutex> lock(encoderMutex);
+    frameReturned.wait(lock, [] { return framesInFlight == 0; });
+}
+
+void StopCapture()
+{
+    if (!captureRunning)
+        return;
+    FlushCapture();
+
+    {
+        std::lock_guard<std::mutex> lock(encoderMutex);
+        stopEncoders = true;
+        encoderWakeup.notify_all();
+    }
+    for (size_t i = 0; i < encoders.size(); i++) {
+        encoders[i].join();
+    }
+    encoders.clear();
+
+    if (usePixelBuffers) {
+        for (int i = 0; i < CAPTURE_NUM_PBOS; i++) {
+            deleteBuffers(1, &slots[i].buffer);
+        }
+    }
+    captureRunning = false;
+}
+
+bool IsCaptureRunning()
+{
+    return captureRunning;
+}
+
+CaptureStats GetCaptureStats()
+{
+    CaptureStats stats = { framesCaptured.load(), framesWritten.load(), framesDropped.load(), writeErrors.load() };
+    return stats;
+}
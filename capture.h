@@ -0,0 +1,57 @@
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////
+// FRAME CAPTURE
+//
+// Reads rendered frames back through a ring of pixel buffer objects, so the
+// copy of frame N completes while later frames render, and hands them to a
+// pool of background threads that encode and write the image files, started
+// one at a time as frames back up. The render thread never waits on the GPU
+// or the disk: when the encoders fall behind, new frames are dropped and
+// counted instead (unless asked to wait).
+//
+// Every function except GetCaptureStats must be called from the thread that
+// owns the OpenGL context.
+/////////////////////////////////////////////////////////////////////////////
+
+#define CAPTURE_NUM_PBOS        3       // Frames in flight between glReadPixels and mapping them.
+#define CAPTURE_MAX_PENDING     16      // Frames waiting to be written before new ones are dropped.
+#define CAPTURE_MAX_FILENAME    1024    // Longest file name of a captured frame.
+
+// Looks up an OpenGL function by name, e.g. glutGetProcAddress or eglGetProcAddress.
+typedef void* (*CaptureProcLoader)(const char* name);
+
+struct CaptureStats {
+    int framesCaptured;     // Frames passed to CaptureFrame.
+    int framesWritten;      // Frames written to disk.
+    int framesDropped;      // Frames dropped because every buffer was waiting to be written.
+    int writeErrors;        // Frames that couldn't be written.
+};
+
+// Starts the capture subsystem with up to the given number of encoder threads. Falls back to a
+// plain glReadPixels if the context has no pixel buffer objects. Unless dropWhenBehind is
+// set, CaptureFrame waits for the encoders instead of dropping frames, e.g. when rendering
+// offline where every frame matters more than the frame rate.
+void StartCapture(CaptureProcLoader loader, int numThreads, bool dropWhenBehind);
+
+// Queues a read of the current read buffer (the back buffer before swapping), to be written
+// to filename in the given IMAGE_FORMAT_ once it arrives.
+void CaptureFrame(int width, int height, int format, const char* filename);
+
+// Queues a read like CaptureFrame, for a one-off screenshot. The encoder that writes it prints
+// whether it was saved. Nothing later pushes it out of the ring, so call RetireCapture a frame
+// or so afterwards.
+void CaptureScreenshot(int width, int height, int format, const char* filename);
+
+// Hands every frame read so far to the encoders, without waiting for them to be written.
+void RetireCapture();
+
+// Waits until every captured frame has been written.
+void FlushCapture();
+
+// Flushes, then stops the encoder threads and releases the pixel buffer objects.
+void StopCapture();
+
+bool IsCaptureRunning();
+
+CaptureStats GetCaptureStats();
@@ -0,0 +1,436 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "cfop.h"
+#include "lastlayer.h"
+#include "pattern.h"
+
+#define CFOP_MOVES              18     // Face turns: turn * 3 + CLOCKWISE, ANTI_CLOCKWISE or HALF_TURN.
+#define PIECE_STICKERS          24     // Stickers on the corners, and on the edges.
+#define CROSS_STATES            (PIECE_STICKERS * PIECE_STICKERS * PIECE_STICKERS * PIECE_STICKERS)
+#define PAIR_STATES             (PIECE_STICKERS * PIECE_STICKERS)
+#define NUM_OF_SLOTS            4
+
+// The steps a pair is solved with: U turns, then the triggers, each a side face turned out of the
+// way, a U turn and the side face turned back.
+#define PAIR_U_STEPS            3
+#define PAIR_STEPS              (PAIR_U_STEPS + 4 * 2 * 3)
+#define PAIR_UNREACHABLE        255
+
+static const int moveDirections[3] = { CLOCKWISE, ANTI_CLOCKWISE, HALF_TURN };
+
+// The sides in the order of the cross edges, and the slots clockwise from above, each named by its
+// two sides.
+static const int crossSides[NUM_OF_SLOTS] = { FACE_FRONT, FACE_RIGHT, FACE_BACK, FACE_LEFT };
+static const int slotSides[NUM_OF_SLOTS][2] = { { FACE_FRONT, FACE_RIGHT }, { FACE_RIGHT, FACE_BACK },
+                                                { FACE_BACK, FACE_LEFT }, { FACE_LEFT, FACE_FRONT } };
+static const char* const slotNames[NUM_OF_SLOTS] = { "F2L FR", "F2L BR", "F2L BL", "F2L FL" };
+static const int triggerSides[4] = { FACE_FRONT, FACE_RIGHT, FACE_BACK, FACE_LEFT };
+
+struct CfopTables {
+    // The corner and edge stickers, numbered 0 to 23, with the rest of each piece.
+    int cornerStickers[PIECE_STICKERS];
+    int cornerPartners[PIECE_STICKERS][2];
+    int edgeStickers[PIECE_STICKERS];
+    int edgePartners[PIECE_STICKERS];
+    int pieceSticker[NUM_OF_STICKERS];          // Sticker to its number as a corner or edge sticker, or -1.
+
+    // Where each corner and edge sticker goes with each face turn and each pair step.
+    unsigned char cornerMoves[CFOP_MOVES][PIECE_STICKERS];
+    unsigned char edgeMoves[CFOP_MOVES][PIECE_STICKERS];
+    unsigned char cornerSteps[PAIR_STEPS][PIECE_STICKERS];
+    unsigned char edgeSteps[PAIR_STEPS][PIECE_STICKERS];
+    int stepSlot[PAIR_STEPS];                   // The slot a trigger disturbs, -1 for the U turns.
+    int stepLength[PAIR_STEPS];
+
+    // Face turns from the cross being solved, by where the D sticker of each cross edge is.
+    unsigned char crossDistance[CROSS_STATES];
+
+    // For each slot and each set of slots solved, the moves from each place of the pair's corner
+    // (its D sticker) and edge (the sticker of its first side) to solved, and the step to take.
+    unsigned char pairDistance[NUM_OF_SLOTS][1 << NUM_OF_SLOTS][PAIR_STATES];
+    unsigned char pairStep[NUM_OF_SLOTS][1 << NUM_OF_SLOTS][PAIR_STATES];
+    int solvedCorner[NUM_OF_SLOTS];
+    int solvedEdge[NUM_OF_SLOTS];
+    int solvedCross;
+
+    // The last layer algorithms, parsed.
+    std::vector<Move> ollMoves[64];
+    std::vector<Move> pllMoves[32];
+
+    CfopTables();
+};
+
+static Move FaceMove(int move)
+{
+    Move result = { move / 3, moveDirections[move % 3], 0.0 };
+    return result;
+}
+
+// The moves of a pair step, added to moves.
+static void AddPairStep(int step, std::vector<Move>& moves)
+{
+    if (step < PAIR_U_STEPS) {
+        moves.push_back(FaceMove(TURN_U * 3 + step));
+        return;
+    }
+    int trigger = step - PAIR_U_STEPS;
+    int side = triggerSides[trigger / 6];
+    int direction = ((trigger / 3) % 2 == 0) ? CLOCKWISE : ANTI_CLOCKWISE;
+    Move out = { side, direction, 0.0 };
+    Move back = { side, -direction, 0.0 };
+    moves.push_back(out);
+    moves.push_back(FaceMove(TURN_U * 3 + trigger % 3));
+    moves.push_back(back);
+}
+
+// Where each sticker goes with a sequence of moves.
+static void StickerDestinations(const std::vector<Move>& moves, int destinations[NUM_OF_STICKERS])
+{
+    Cube numbered;
+    InitCube(numbered);
+    int* numbers = &numbered.stickers[0][0];
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        numbers[sticker] = sticker;
+    }
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyMove(numbered, moves[i]);
+    }
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        destinations[numbers[sticker]] = sticker;
+    }
+}
+
+static int CrossState(const int locations[NUM_OF_SLOTS])
+{
+    return ((locations[0] * PIECE_STICKERS + locations[1]) * PIECE_STICKERS + locations[2]) * PIECE_STICKERS + locations[3];
+}
+
+CfopTables::CfopTables()
+{
+    // Number the corner and edge stickers, and find the rest of their pieces.
+    int numCorners = 0, numEdges = 0;
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        int piece = StickerPiece(sticker);
+        int middles = (piece % 3 == 1) + ((piece / 3) % 3 == 1) + (piece / 9 == 1);
+        pieceSticker[sticker] = -1;
+        if (middles == 0) {
+            pieceSticker[sticker] = numCorners;
+            cornerStickers[numCorners++] = sticker;
+        }
+        else if (middles == 1) {
+            pieceSticker[sticker] = numEdges;
+            edgeStickers[numEdges++] = sticker;
+        }
+    }
+    for (int i = 0; i < PIECE_STICKERS; i++) {
+        int numPartners = 0;
+        for (int j = 0; j < PIECE_STICKERS; j++) {
+            if (j != i && StickerPiece(cornerStickers[j]) == StickerPiece(cornerStickers[i]))
+                cornerPartners[i][numPartners++] = cornerStickers[j];
+            if (j != i && StickerPiece(edgeStickers[j]) == StickerPiece(edgeStickers[i]))
+                edgePartners[i] = edgeStickers[j];
+        }
+    }
+
+    int destinations[NUM_OF_STICKERS];
+    for (int move = 0; move < CFOP_MOVES; move++) {
+        StickerDestinations(std::vector<Move>(1, FaceMove(move)), destinations);
+        for (int i = 0; i < PIECE_STICKERS; i++) {
+            cornerMoves[move][i] = (unsigned char)pieceSticker[destinations[cornerStickers[i]]];
+            edgeMoves[move][i] = (unsigned char)pieceSticker[destinations[edgeStickers[i]]];
+        }
+    }
+
+    // Where the pieces are when solved.
+    Cube solved;
+    InitCube(solved);
+    const int* solvedStickers = &solved.stickers[0][0];
+    int crossLocations[NUM_OF_SLOTS];
+    for (int i = 0; i < PIECE_STICKERS; i++) {
+        int colour = solvedStickers[edgeStickers[i]];
+        int partner = solvedStickers[edgePartners[i]];
+        for (int side = 0; side < NUM_OF_SLOTS; side++) {
+            if (colour == FACE_DOWN && partner == crossSides[side])
+                crossLocations[side] = i;
+            if (colour == slotSides[side][0] && partner == slotSides[side][1])
+                solvedEdge[side] = i;
+        }
+        colour = solvedStickers[cornerStickers[i]];
+        int first = solvedStickers[cornerPartners[i][0]];
+        int second = solvedStickers[cornerPartners[i][1]];
+        for (int slot = 0; slot < NUM_OF_SLOTS; slot++) {
+            if (colour == FACE_DOWN && (first == slotSides[slot][0] || second == slotSides[slot][0]) &&
+                (first == slotSides[slot][1] || second == slotSides[slot][1]))
+                solvedCorner[slot] = i;
+        }
+    }
+    solvedCross = CrossState(crossLocations);
+
+    // BFS from the solved cross.
+    memset(crossDistance, 0xFF, sizeof(crossDistance));
+    std::vector<int> level(1, solvedCross), next;
+    crossDistance[solvedCross] = 0;
+    for (int distance = 1; !level.empty(); distance++) {
+        next.clear();
+        for (size_t i = 0; i < level.size(); i++) {
+            int locations[NUM_OF_SLOTS];
+            for (int edge = NUM_OF_SLOTS - 1, state = level[i]; edge >= 0; edge--, state /= PIECE_STICKERS) {
+                locations[edge] = state % PIECE_STICKERS;
+            }
+            for (int move = 0; move < CFOP_MOVES; move++) {
+                int moved[NUM_OF_SLOTS];
+                for (int edge = 0; edge < NUM_OF_SLOTS; edge++) {
+                    moved[edge] = edgeMoves[move][locations[edge]];
+                }
+                int state = CrossState(moved);
+                if (crossDistance[state] == 0xFF) {
+                    crossDistance[state] = (unsigned char)distance;
+                    next.push_back(state);
+                }
+            }
+        }
+        level.swap(next);
+    }
+
+    // The pair steps, and the slot each trigger disturbs.
+    for (int step = 0; step < PAIR_STEPS; step++) {
+        std::vector<Move> moves;
+        AddPairStep(step, moves);
+        stepLength[step] = (int)moves.size();
+        StickerDestinations(moves, destinations);
+        for (int i = 0; i < PIECE_STICKERS; i++) {
+            cornerSteps[step][i] = (unsigned char)pieceSticker[destinations[cornerStickers[i]]];
+            edgeSteps[step][i] = (unsigned char)pieceSticker[destinations[edgeStickers[i]]];
+        }
+        stepSlot[step] = -1;
+        for (int slot = 0; slot < NUM_OF_SLOTS; slot++) {
+            if (cornerSteps[step][solvedCorner[slot]] != solvedCorner[slot] || edgeSteps[step][solvedEdge[slot]] != solvedEdge[slot])
+                stepSlot[step] = slot;
+        }
+    }
+
+    // For each slot and set of other slots solved, relax the distances until nothing improves.
+    // The steps are all short, so this settles in a few passes.
+    for (int slot = 0; slot < NUM_OF_SLOTS; slot++) {
+        for (int solvedSlots = 0; solvedSlots < (1 << NUM_OF_SLOTS); solvedSlots++) {
+            unsigned char* distance = pairDistance[slot][solvedSlots];
+            unsigned char* bestStep = pairStep[slot][solvedSlots];
+            memset(distance, PAIR_UNREACHABLE, PAIR_STATES);
+            memset(bestStep, 0, PAIR_STATES);
+            if (solvedSlots & (1 << slot))
+                continue;
+            distance[solvedCorner[slot] * PIECE_STICKERS + solvedEdge[slot]] = 0;
+            for (bool changed = true; changed;) {
+                changed = false;
+                for (int state = 0; state < PAIR_STATES; state++) {
+                    int corner = state / PIECE_STICKERS, edge = state % PIECE_STICKERS;
+                    for (int step = 0; step < PAIR_STEPS; step++) {
+                        if (stepSlot[step] >= 0 && (solvedSlots & (1 << stepSlot[step])))
+                            continue;
+                        int after = distance[cornerSteps[step][corner] * PIECE_STICKERS + edgeSteps[step][edge]];
+                        if (after != PAIR_UNREACHABLE && after + stepLength[step] < distance[state]) {
+                            distance[state] = (unsigned char)(after + stepLength[step]);
+                            bestStep[state] = (unsigned char)step;
+                            changed = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < lastLayerTables[LAST_LAYER_OLL].numCases; i++) {
+        ParseMoves(lastLayerTables[LAST_LAYER_OLL].cases[i].algorithm, ollMoves[i]);
+    }
+    for (int i = 0; i < lastLayerTables[LAST_LAYER_PLL].numCases; i++) {
+        ParseMoves(lastLayerTables[LAST_LAYER_PLL].cases[i].algorithm, pllMoves[i]);
+    }
+}
+
+static const CfopTables& GetTables()
+{
+    static const CfopTables tables;
+    return tables;
+}
+
+// Where the pieces the first two layers are made of are: the D sticker of each cross edge and of
+// each slot's corner, and the first side's sticker of each slot's edge.
+static void LocatePieces(const CfopTables& tables, const Cube& cube, int cross[NUM_OF_SLOTS],
+                         int corners[NUM_OF_SLOTS], int edges[NUM_OF_SLOTS])
+{
+    const int* stickers = &cube.stickers[0][0];
+    for (int i = 0; i < PIECE_STICKERS; i++) {
+        int colour = stickers[tables.edgeStickers[i]];
+        int partner = stickers[tables.edgePartners[i]];
+        for (int side = 0; side < NUM_OF_SLOTS; side++) {
+            if (colour == FACE_DOWN && partner == crossSides[side])
+                cross[side] = i;
+            if (colour == slotSides[side][0] && partner == slotSides[side][1])
+                edges[side] = i;
+        }
+        if (stickers[tables.cornerStickers[i]] != FACE_DOWN)
+            continue;
+        int first = stickers[tables.cornerPartners[i][0]];
+        int second = stickers[tables.cornerPartners[i][1]];
+        for (int slot = 0; slot < NUM_OF_SLOTS; slot++) {
+            if ((first == slotSides[slot][0] || second == slotSides[slot][0]) &&
+                (first == slotSides[slot][1] || second == slotSides[slot][1]))
+                corners[slot] = i;
+        }
+    }
+}
+
+static void ApplyMoves(Cube& cube, const std::vector<Move>& moves, size_t start)
+{
+    for (size_t i = start; i < moves.size(); i++) {
+        ApplyMove(cube, moves[i]);
+    }
+}
+
+static void StartStep(CfopSolution& solution, int step, int stage, const char* name)
+{
+    solution.steps[step].stage = stage;
+    snprintf(solution.steps[step].name, sizeof(solution.steps[step].name), "%s", name);
+    solution.steps[step].start = (int)solution.moves.size();
+    solution.steps[step].length = 0;
+}
+
+static void EndStep(CfopSolution& solution, int step)
+{
+    solution.steps[step].length = (int)solution.moves.size() - solution.steps[step].start;
+}
+
+// Turns U clockwise the given number of times.
+static void AddUTurns(std::vector<Move>& moves, int turns)
+{
+    static const int directions[4] = { 0, CLOCKWISE, HALF_TURN, ANTI_CLOCKWISE };
+    if (turns % 4 != 0) {
+        Move move = { TURN_U, directions[turns % 4], 0.0 };
+        moves.push_back(move);
+    }
+}
+
+// Recognises the last layer in a set and adds the pre-turn and algorithm. Returns the case, or -1.
+static int SolveLastLayer(Cube& cube, int set, const std::vector<Move>* algorithms, CfopSolution& solution)
+{
+    int preTurns;
+    int found = RecogniseLastLayer(cube, set, &preTurns);
+    if (found < 0)
+        return -1;
+    size_t start = solution.moves.size();
+    if (found != 0)
+        AddUTurns(solution.moves, preTurns);
+    solution.moves.insert(solution.moves.end(), algorithms[found].begin(), algorithms[found].end());
+    ApplyMoves(cube, solution.moves, start);
+    return found;
+}
+
+bool SolveCfop(const Cube& start, CfopSolution& solution)
+{
+    const CfopTables& tables = GetTables();
+    Cube cube;
+    RecolourByCentres(start, cube);
+    solution.moves.clear();
+
+    int cross[NUM_OF_SLOTS], corners[NUM_OF_SLOTS], edges[NUM_OF_SLOTS];
+    LocatePieces(tables, cube, cross, corners, edges);
+
+    // The cross: any face turn that takes it a move closer, until it is solved.
+    StartStep(solution, 0, CFOP_CROSS, "Cross");
+    int state = CrossState(cross);
+    if (tables.crossDistance[state] == 0xFF)
+        return false;
+    while (state != tables.solvedCross) {
+        int distance = tables.crossDistance[state];
+        for (int move = 0; move < CFOP_MOVES; move++) {
+            int moved[NUM_OF_SLOTS];
+            for (int edge = 0; edge < NUM_OF_SLOTS; edge++) {
+                moved[edge] = tables.edgeMoves[move][cross[edge]];
+            }
+            int next = CrossState(moved);
+            if (tables.crossDistance[next] < distance) {
+                memcpy(cross, moved, sizeof(cross));
+                state = next;
+                solution.moves.push_back(FaceMove(move));
+                break;
+            }
+        }
+    }
+    ApplyMoves(cube, solution.moves, 0);
+    EndStep(solution, 0);
+
+    // The pairs, nearest first. The cross moves have moved the slot pieces too.
+    LocatePieces(tables, cube, cross, corners, edges);
+    int solvedSlots = 0;
+    for (int slot = 0; slot < NUM_OF_SLOTS; slot++) {
+        if (corners[slot] == tables.solvedCorner[slot] && edges[slot] == tables.solvedEdge[slot])
+            solvedSlots |= 1 << slot;
+    }
+    for (int step = 1; step <= NUM_OF_SLOTS; step++) {
+        int best = -1;
+        int bestDistance = PAIR_UNREACHABLE;
+        for (int slot = 0; slot < NUM_OF_SLOTS; slot++) {
+            int distance = tables.pairDistance[slot][solvedSlots][corners[slot] * PIECE_STICKERS + edges[slot]];
+            if (!(solvedSlots & (1 << slot)) && distance < bestDistance) {
+                best = slot;
+                bestDistance = distance;
+            }
+        }
+        if (best < 0 && solvedSlots != (1 << NUM_OF_SLOTS) - 1)
+            return false;
+        if (best < 0) {
+            // Every slot is solved already: the steps left are empty.
+            StartStep(solution, step, CFOP_F2L, "F2L");
+            continue;
+        }
+
+        StartStep(solution, step, CFOP_F2L, slotNames[best]);
+        size_t start = solution.moves.size();
+        int corner = corners[best], edge = edges[best];
+        while (corner != tables.solvedCorner[best] || edge != tables.solvedEdge[best]) {
+            int pairStep = tables.pairStep[best][solvedSlots][corner * PIECE_STICKERS + edge];
+            AddPairStep(pairStep, solution.moves);
+            corner = tables.cornerSteps[pairStep][corner];
+            edge = tables.edgeSteps[pairStep][edge];
+        }
+        ApplyMoves(cube, solution.moves, start);
+        EndStep(solution, step);
+        solvedSlots |= 1 << best;
+        LocatePieces(tables, cube, cross, corners, edges);
+        for (int slot = 0; slot < NUM_OF_SLOTS; slot++) {
+            if (corners[slot] == tables.solvedCorner[slot] && edges[slot] == tables.solvedEdge[slot])
+                solvedSlots |= 1 << slot;
+        }
+    }
+
+    // The last layer.
+    StartStep(solution, 5, CFOP_OLL, "OLL");
+    int found = SolveLastLayer(cube, LAST_LAYER_OLL, tables.ollMoves, solution);
+    if (found < 0)
+        return false;
+    snprintf(solution.steps[5].name, sizeof(solution.steps[5].name), "%s", lastLayerTables[LAST_LAYER_OLL].cases[found].name);
+    EndStep(solution, 5);
+
+    StartStep(solution, 6, CFOP_PLL, "PLL");
+    found = SolveLastLayer(cube, LAST_LAYER_PLL, tables.pllMoves, solution);
+    if (found < 0)
+        return false;
+    if (found == 0)
+        snprintf(solution.steps[6].name, sizeof(solution.steps[6].name), "%s", lastLayerTables[LAST_LAYER_PLL].cases[found].name);
+    else
+        snprintf(solution.steps[6].name, sizeof(solution.steps[6].name), "PLL %s", lastLayerTables[LAST_LAYER_PLL].cases[found].name);
+    EndStep(solution, 6);
+
+    StartStep(solution, 7, CFOP_AUF, "AUF");
+    for (int turns = 0; turns < 4; turns++) {
+        if (cube.stickers[FACE_FRONT][1] == FACE_FRONT) {
+            AddUTurns(solution.moves, turns);
+            break;
+        }
+        Move turn = { TURN_U, CLOCKWISE, 0.0 };
+        ApplyMove(cube, turn);
+    }
+    EndStep(solution, 7);
+    return CountIncorrectStickers(cube) == 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// CFOP SOLVER
+//
+// Solves the cube the way people are taught to, in steps that can be
+// followed: the cross on D, the four F2L pairs, OLL and PLL, then turning
+// the last layer into place. Nothing is searched while solving:
+//
+// - The cross is a greedy descent through a table of how many moves each
+//   placement of the four cross edges is from solved, filled by a BFS.
+// - Each pair follows a table of the best next step for every place its
+//   corner and edge can be. The steps are U turns and triggers such as
+//   R U R' that only disturb one slot, so the cross and the pairs already
+//   in stay solved. There is a table for each slot and each combination of
+//   the other slots solved, each filled by a small BFS.
+// - OLL and PLL are looked up in the last layer tables (see lastlayer.h).
+//
+// The tables are built the first time a cube is solved, in a few
+// milliseconds.
+/////////////////////////////////////////////////////////////////////////////
+
+#define CFOP_CROSS              0
+#define CFOP_F2L                1
+#define CFOP_OLL                2
+#define CFOP_PLL                3
+#define CFOP_AUF                4      // Turning the last layer into place.
+#define NUM_OF_CFOP_STAGES      5
+
+#define CFOP_STEPS              8      // The cross, four pairs, OLL, PLL and AUF.
+
+// One step of a solution: moves[start] to moves[start + length - 1]. A step that was already done
+// has no moves.
+struct CfopStep {
+    int stage;                  // CFOP_ stage.
+    char name[16];              // e.g. "Cross", "F2L FR", "OLL 27", "PLL T", "AUF".
+    int start;
+    int length;
+};
+
+struct CfopSolution {
+    std::vector<Move> moves;            // Oriented like moves applied with ApplyMove; may include rotations.
+    CfopStep steps[CFOP_STEPS];         // In order.
+};
+
+// Solves the cube with the cross on its own D face, however it is held, colours told apart by the
+// centres. Returns false if it can't be solved (e.g. a corner twisted in place).
+bool SolveCfop(const Cube& cube, CfopSolution& solution);
@@ -0,0 +1,605 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cube.h"
+
+void PrintCube(const Cube& cube)
+{
+    /*
+        printf("---------START---------\n");
+        for (int face = 0; face < NUM_OF_FACES; face++) {
+            printf("---FACE %d---", face);
+            for (int square = 0; square < NUM_OF_SQUARES; square++) {
+                if (square % 3 == 0)
+                    printf("\n");
+                printf("%d ", cube.stickers[face][square]);
+            }
+            printf("\n");
+        }
+        printf("---------END---------\n");
+        */
+    printf("--------------START--------------\n");
+    // printing FACE_UP
+    for (int i = 0; i < 8; i++) {
+        printf("- ");
+    }
+    for (int square = 0; square < NUM_OF_SQUARES; square++) {
+        if (square % 3 == 0)
+            printf("\n- - - | ");
+        printf("%d ", cube.stickers[FACE_UP][square]);
+        if ((square + 1) % 3 == 0)
+            printf("|");
+    }
+    printf("\n");
+
+    // printing FACE_LEFT, FACE_FRONT, FACE_RIGHT, FACE_BACK
+    for (int i = 0; i < 16; i++) {
+        printf("- ");
+    }
+    for (int i = 0; i < 3; i++) {
+        printf("\n");
+        for (int j = 0; j < 3; j++) {
+            printf("%d ", cube.stickers[FACE_LEFT][i * 3 + j]);
+        }
+        printf("| ");
+        for (int j = 0; j < 3; j++) {
+            for (int k = 0; k < 3; k++) {
+                printf("%d ", cube.stickers[FACE_FRONT + j][i * 3 + k]);
+            }
+            printf("| ");
+        }
+    }
+    printf("\n");
+    for (int i = 0; i < 16; i++) {
+        printf("- ");
+    }
+
+    //printing FACE_DOWN
+    for (int square = 0; square < NUM_OF_SQUARES; square++) {
+        if (square % 3 == 0)
+            printf("\n- - - | ");
+        printf("%d ", cube.stickers[FACE_DOWN][square]);
+        if ((square + 1) % 3 == 0)
+            printf("|");
+    }
+    printf("\n");
+    for (int i = 0; i < 8; i++) {
+        printf("- ");
+    }
+    printf("\n");
+    printf("---------------END---------------\n");
+}
+
+// Initializes the cube in the solved state.
+void InitCube(Cube& cube)
+{
+    for (int face = 0; face < NUM_OF_FACES; face++) {
+        for (int square = 0; square < NUM_OF_SQUARES; square++) {
+            cube.stickers[face][square] = face;
+        }
+    }
+    cube.orientation = 0;
+}
+
+// Where each face is on the cube: the direction it faces, then the directions along its rows and
+// up its columns as indexed above, on the x (right), y (up) and z (front) axes. This is how
+// main.cpp draws them.
+static const int faceDirections[NUM_OF_FACES][3][3] = { { { 0, 1, 0 }, { 1, 0, 0 }, { 0, 0, -1 } },
+                                                        { { 0, 0, 1 }, { 1, 0, 0 }, { 0, 1, 0 } },
+                                                        { { 1, 0, 0 }, { 0, 0, -1 }, { 0, 1, 0 } },
+                                                        { { 0, 0, -1 }, { -1, 0, 0 }, { 0, 1, 0 } },
+                                                        { { -1, 0, 0 }, { 0, 0, 1 }, { 0, 1, 0 } },
+                                                        { { 0, -1, 0 }, { 1, 0, 0 }, { 0, 0, 1 } } };
+
+// The layers each turn turns, the axis they turn about and 1 if the turn is clockwise looking
+// from the positive end of the axis (like R, U or F), -1 if from the negative end.
+static const int turnLayers[NUM_OF_TURNS][3] = { { Y_AXIS, LAYER_POSITIVE, 1 },                                // U
+                                                 { Z_AXIS, LAYER_POSITIVE, 1 },                                // F
+                                                 { X_AXIS, LAYER_POSITIVE, 1 },                                // R
+                                                 { Z_AXIS, LAYER_NEGATIVE, -1 },                               // B
+                                                 { X_AXIS, LAYER_NEGATIVE, -1 },                               // L
+                                                 { Y_AXIS, LAYER_NEGATIVE, -1 },                               // D
+                                                 { X_AXIS, LAYER_MIDDLE, -1 },                                 // M
+                                                 { Y_AXIS, LAYER_MIDDLE, -1 },                                 // E
+                                                 { Z_AXIS, LAYER_MIDDLE, 1 },                                  // S
+                                                 { Y_AXIS, LAYER_POSITIVE | LAYER_MIDDLE, 1 },                 // Uw
+                                                 { Z_AXIS, LAYER_POSITIVE | LAYER_MIDDLE, 1 },                 // Fw
+                                                 { X_AXIS, LAYER_POSITIVE | LAYER_MIDDLE, 1 },                 // Rw
+                                                 { Z_AXIS, LAYER_NEGATIVE | LAYER_MIDDLE, -1 },                // Bw
+                                                 { X_AXIS, LAYER_NEGATIVE | LAYER_MIDDLE, -1 },                // Lw
+                                                 { Y_AXIS, LAYER_NEGATIVE | LAYER_MIDDLE, -1 },                // Dw
+                                                 { X_AXIS, LAYER_NEGATIVE | LAYER_MIDDLE | LAYER_POSITIVE, 1 }, // x
+                                                 { Y_AXIS, LAYER_NEGATIVE | LAYER_MIDDLE | LAYER_POSITIVE, 1 }, // y
+                                                 { Z_AXIS, LAYER_NEGATIVE | LAYER_MIDDLE | LAYER_POSITIVE, 1 } }; // z
+
+// Every turn as a permutation of the stickers, worked out once from where the stickers are, so a
+// move is a single pass over the cube whatever it turns. Cube rotations don't move the stickers;
+// they step between the 24 orientations.
+static struct TurnTables {
+    TurnTables();
+
+    // The sticker that moves to each place: turning sets stickers[i] to the old stickers[permutations[turn][amount][i]],
+    // where amount is a TurnAmount.
+    unsigned char permutations[NUM_OF_TURNS][3][NUM_OF_STICKERS];
+    bool turning[NUM_OF_TURNS][NUM_OF_STICKERS];
+    int turnsByLayers[3][8];                                    // The turn of the layers on an axis, or TURN_NONE.
+    int orientations[NUM_OF_ORIENTATIONS][3][3];                // See OrientationMatrix.
+    unsigned char rotated[NUM_OF_ORIENTATIONS][3][3];           // The orientation after a rotation about an axis.
+} turnTables;
+
+// Where a direction's permutation and rotation are in the tables: 0 clockwise, 1 anticlockwise, 2 half.
+static inline int TurnAmount(int direction)
+{
+    return (direction == CLOCKWISE) ? 0 : (direction == ANTI_CLOCKWISE) ? 1 : 2;
+}
+
+// The centre of a sticker, with the cube from -3 to 3 on each axis.
+static void StickerPosition(int sticker, int position[3])
+{
+    const int (*directions)[3] = faceDirections[sticker / NUM_OF_SQUARES];
+    int square = sticker % NUM_OF_SQUARES;
+    for (int axis = 0; axis < 3; axis++) {
+        position[axis] = 3 * directions[0][axis] + 2 * (square % 3 - 1) * directions[1][axis] + 2 * (1 - square / 3) * directions[2][axis];
+    }
+}
+
+// Sets matrix to a quarter turn about an axis, anticlockwise looking from the positive end if sign is 1.
+static void QuarterTurnMatrix(int axis, int sign, int matrix[3][3])
+{
+    memset(matrix, 0, 9 * sizeof(int));
+    matrix[axis][axis] = 1;
+    matrix[(axis + 1) % 3][(axis + 2) % 3] = -sign;
+    matrix[(axis + 2) % 3][(axis + 1) % 3] = sign;
+}
+
+static void MultiplyMatrices(const int a[3][3], const int b[3][3], int result[3][3])
+{
+    for (int row = 0; row < 3; row++) {
+        for (int column = 0; column < 3; column++) {
+            result[row][column] = a[row][0] * b[0][column] + a[row][1] * b[1][column] + a[row][2] * b[2][column];
+        }
+    }
+}
+
+// The orientation held with the given matrix, or NUM_OF_ORIENTATIONS if there isn't one yet.
+static int FindOrientation(const int orientations[][3][3], int numOrientations, const int matrix[3][3])
+{
+    for (int orientation = 0; orientation < numOrientations; orientation++) {
+        if (memcmp(orientations[orientation], matrix, 9 * sizeof(int)) == 0)
+            return orientation;
+    }
+    return NUM_OF_ORIENTATIONS;
+}
+
+TurnTables::TurnTables()
+{
+    int positions[NUM_OF_STICKERS][3];
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        StickerPosition(sticker, positions[sticker]);
+    }
+
+    for (int turn = 0; turn < NUM_OF_TURNS; turn++) {
+        int axis = turnLayers[turn][0];
+        int u = (axis + 1) % 3;
+        int v = (axis + 2) % 3;
+        for (int anticlockwise = 0; anticlockwise < 2; anticlockwise++) {
+            // A quarter turn anticlockwise about the axis takes u to v and v to -u.
+            int sign = anticlockwise ? turnLayers[turn][2] : -turnLayers[turn][2];
+            for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+                const int* position = positions[sticker];
+                int layer = (position[axis] < 0) ? LAYER_NEGATIVE : (position[axis] > 0) ? LAYER_POSITIVE : LAYER_MIDDLE;
+                turning[turn][sticker] = (turnLayers[turn][1] & layer) != 0;
+                int moved[3] = { position[0], position[1], position[2] };
+                if (turning[turn][sticker]) {
+                    moved[u] = -sign * position[v];
+                    moved[v] = sign * position[u];
+                }
+                for (int to = 0; to < NUM_OF_STICKERS; to++) {
+                    if (memcmp(positions[to], moved, sizeof(moved)) == 0)
+                        permutations[turn][anticlockwise][to] = (unsigned char)sticker;
+                }
+            }
+        }
+        // A half turn is two clockwise quarter turns in one pass.
+        for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+            permutations[turn][2][sticker] = permutations[turn][0][permutations[turn][0][sticker]];
+        }
+    }
+
+    for (int axis = 0; axis < 3; axis++) {
+        for (int layers = 0; layers < 8; layers++) {
+            turnsByLayers[axis][layers] = TURN_NONE;
+        }
+    }
+    for (int turn = 0; turn < NUM_OF_TURNS; turn++) {
+        turnsByLayers[turnLayers[turn][0]][turnLayers[turn][1]] = turn;
+    }
+
+    // Every orientation is reached by rotating about x and y from the first.
+    int numOrientations = 1;
+    memset(orientations[0], 0, sizeof(orientations[0]));
+    for (int axis = 0; axis < 3; axis++) {
+        orientations[0][axis][axis] = 1;
+    }
+    for (int orientation = 0; orientation < numOrientations; orientation++) {
+        for (int axis = X_AXIS; axis <= Y_AXIS; axis++) {
+            int quarterTurn[3][3], matrix[3][3];
+            QuarterTurnMatrix(axis, 1, quarterTurn);
+            MultiplyMatrices(orientations[orientation], quarterTurn, matrix);
+            if (FindOrientation(orientations, numOrientations, matrix) == NUM_OF_ORIENTATIONS)
+                memcpy(orientations[numOrientations++], matrix, sizeof(matrix));
+        }
+    }
+    for (int orientation = 0; orientation < NUM_OF_ORIENTATIONS; orientation++) {
+        for (int axis = 0; axis < 3; axis++) {
+            for (int anticlockwise = 0; anticlockwise < 2; anticlockwise++) {
+                int quarterTurn[3][3], matrix[3][3];
+                QuarterTurnMatrix(axis, anticlockwise ? 1 : -1, quarterTurn);
+                MultiplyMatrices(orientations[orientation], quarterTurn, matrix);
+                rotated[orientation][axis][anticlockwise] = (unsigned char)FindOrientation(orientations, NUM_OF_ORIENTATIONS, matrix);
+            }
+        }
+    }
+    for (int orientation = 0; orientation < NUM_OF_ORIENTATIONS; orientation++) {
+        for (int axis = 0; axis < 3; axis++) {
+            rotated[orientation][axis][2] = rotated[rotated[orientation][axis][0]][axis][0];
+        }
+    }
+}
+
+void PackCube(const Cube& cube, PackedCube& packed)
+{
+    const int* stickers = &cube.stickers[0][0];
+    for (int word = 0; word < 3; word++) {
+        uint64_t bits = 0;
+        int first = word * PACKED_STICKERS_PER_WORD;
+        int last = (first + PACKED_STICKERS_PER_WORD < NUM_OF_STICKERS) ? first + PACKED_STICKERS_PER_WORD : NUM_OF_STICKERS;
+        for (int sticker = last - 1; sticker >= first; sticker--) {
+            bits = (bits << 3) | (uint64_t)stickers[sticker];
+        }
+        packed.words[word] = bits;
+    }
+}
+
+void UnpackCube(const PackedCube& packed, Cube& cube)
+{
+    int* stickers = &cube.stickers[0][0];
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        stickers[sticker] = (int)((packed.words[sticker / PACKED_STICKERS_PER_WORD] >> (3 * (sticker % PACKED_STICKERS_PER_WORD))) & 7);
+    }
+    cube.orientation = 0;
+}
+
+uint64_t HashPackedCube(const PackedCube& packed)
+{
+    uint64_t hash = packed.words[0] * 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 31) ^ packed.words[1]) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 29) ^ packed.words[2]) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 32);
+}
+
+int StickerPiece(int sticker)
+{
+    int position[3];
+    StickerPosition(sticker, position);
+    int piece = 0;
+    for (int axis = Z_AXIS; axis >= X_AXIS; axis--) {
+        piece = piece * 3 + ((position[axis] < 0) ? 0 : (position[axis] > 0) ? 2 : 1);
+    }
+    return piece;
+}
+
+// Count the number of incorrect stickers (e.g. U move from solved state is 12 incorrect stickers)
+int CountIncorrectStickers(const Cube& cube)
+{
+    int incorrectCount = 0;
+    for (int i = 0; i < NUM_OF_FACES; i++) {
+        for (int j = 0; j < NUM_OF_SQUARES; j++) {
+            if (cube.stickers[i][j] != cube.stickers[i][4])
+                incorrectCount++;
+        }
+    }
+    return incorrectCount;
+}
+
+// Checks if the current Square on the Face is in the layers a turn turns.
+bool IsStickerTurning(int turn, int face, int square)
+{
+    if (turn < 0 || turn >= NUM_OF_TURNS)
+        return false;
+    return turnTables.turning[turn][face * NUM_OF_SQUARES + square];
+}
+
+// The turns come from their own generator (the same as the C library's example rand), so a
+// session recording only needs the seed to replay a scramble.
+static int NextScrambleRandom(unsigned int& seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return (int)((seed / 65536) % 32768);
+}
+
+void ScrambleCube(Cube& cube, unsigned int seed)
+{
+    int numMoves = NextScrambleRandom(seed) % 41 + 20;
+    for (int i = 0; i < numMoves; i++) {
+        int move = NextScrambleRandom(seed) % 7;
+        int direction = NextScrambleRandom(seed) % 2;
+
+        // Only six of the seven are face turns.
+        if (move < NUM_OF_FACES) {
+            Move turn = { move, direction ? 1 : -1, 0.0 };
+            ApplyMove(cube, turn);
+        }
+    }
+}
+
+// Applies a move straight to the cube's state without animating it.
+void ApplyMove(Cube& cube, const Move& move)
+{
+    if (move.turn >= TURN_X) {
+        cube.orientation = turnTables.rotated[cube.orientation][move.turn - TURN_X][TurnAmount(move.direction)];
+        return;
+    }
+
+    const unsigned char* permutation = turnTables.permutations[move.turn][TurnAmount(move.direction)];
+    Cube turned;
+    const int* stickers = &cube.stickers[0][0];
+    int* turnedStickers = &turned.stickers[0][0];
+    for (int i = 0; i < NUM_OF_STICKERS; i++) {
+        turnedStickers[i] = stickers[permutation[i]];
+    }
+    turned.orientation = cube.orientation;
+    cube = turned;
+}
+
+Move OrientMove(const Cube& cube, const Move& move)
+{
+    // The cube's own axis along the viewer's axis the move turns about, and whether it points
+    // the other way, which swaps the layers at either end.
+    const int (*matrix)[3] = turnTables.orientations[cube.orientation];
+    int viewAxis = turnLayers[move.turn][0];
+    int axis = X_AXIS;
+    while (matrix[viewAxis][axis] == 0) {
+        axis++;
+    }
+    int sign = matrix[viewAxis][axis];
+    int layers = turnLayers[move.turn][1];
+    if (sign < 0)
+        layers = (layers & LAYER_MIDDLE) | ((layers & LAYER_NEGATIVE) ? LAYER_POSITIVE : 0) | ((layers & LAYER_POSITIVE) ? LAYER_NEGATIVE : 0);
+
+    Move oriented = move;
+    oriented.turn = turnTables.turnsByLayers[axis][layers];
+    if (move.direction != HALF_TURN)
+        oriented.direction = move.direction * turnLayers[move.turn][2] * sign * turnLayers[oriented.turn][2];
+    return oriented;
+}
+
+Move HeldMove(const Cube& cube, const Move& move)
+{
+    // The viewer's axis along the cube's own axis the move turns about, as in OrientMove.
+    const int (*matrix)[3] = turnTables.orientations[cube.orientation];
+    int axis = turnLayers[move.turn][0];
+    int viewAxis = X_AXIS;
+    while (matrix[viewAxis][axis] == 0) {
+        viewAxis++;
+    }
+    int sign = matrix[viewAxis][axis];
+    int layers = turnLayers[move.turn][1];
+    if (sign < 0)
+        layers = (layers & LAYER_MIDDLE) | ((layers & LAYER_NEGATIVE) ? LAYER_POSITIVE : 0) | ((layers & LAYER_POSITIVE) ? LAYER_NEGATIVE : 0);
+
+    Move held = move;
+    held.turn = turnTables.turnsByLayers[viewAxis][layers];
+    if (move.direction != HALF_TURN)
+        held.direction = move.direction * turnLayers[move.turn][2] * sign * turnLayers[held.turn][2];
+    return held;
+}
+
+void TurnLayers(int turn, int* axis, int* layers, int* sign)
+{
+    *axis = turnLayers[turn][0];
+    *layers = turnLayers[turn][1];
+    *sign = turnLayers[turn][2];
+}
+
+int TurnOfLayers(int axis, int layers)
+{
+    return turnTables.turnsByLayers[axis][layers];
+}
+
+void OrientationMatrix(int orientation, int matrix[3][3])
+{
+    memcpy(matrix, turnTables.orientations[orientation], 9 * sizeof(int));
+}
+
+void ResetOrientation(Cube& cube)
+{
+    const int (*matrix)[3] = turnTables.orientations[cube.orientation];
+    Cube held;
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        int position[3], heldPosition[3], to[3];
+        StickerPosition(sticker, position);
+        for (int row = 0; row < 3; row++) {
+            heldPosition[row] = matrix[row][0] * position[0] + matrix[row][1] * position[1] + matrix[row][2] * position[2];
+        }
+        for (int other = 0; other < NUM_OF_STICKERS; other++) {
+            StickerPosition(other, to);
+            if (memcmp(to, heldPosition, sizeof(to)) == 0)
+                (&held.stickers[0][0])[other] = (&cube.stickers[0][0])[sticker];
+        }
+    }
+    held.orientation = 0;
+    cube = held;
+}
+
+int MoveCode(const Move& move)
+{
+    if (move.direction == HALF_TURN)
+        return NUM_OF_TURNS * 2 + move.turn;
+    return move.turn * 2 + ((move.direction == CLOCKWISE) ? 0 : 1);
+}
+
+Move MoveFromCode(int code)
+{
+    if (code >= NUM_OF_TURNS * 2) {
+        Move move = { code - NUM_OF_TURNS * 2, HALF_TURN, 0.0 };
+        return move;
+    }
+    Move move = { code / 2, (code & 1) ? ANTI_CLOCKWISE : CLOCKWISE, 0.0 };
+    return move;
+}
+
+Move InverseMove(const Move& move)
+{
+    Move inverse = move;
+    if (move.direction != HALF_TURN)
+        inverse.direction = -move.direction;
+    return inverse;
+}
+
+// Parses a single move in standard notation (e.g. "R", "U'", "F2", "M", "Rw", "r'", "z").
+// Returns false if the token is not a move.
+bool ParseMove(const char* token, Move* move)
+{
+    const char faceNames[NUM_OF_FACES + 1] = "UFRBLD";
+    const char wideNames[NUM_OF_FACES + 1] = "ufrbld";
+    const char sliceNames[3 + 1] = "MES";
+    const char rotationNames[3 + 1] = "xyz";
+    move->turn = TURN_NONE;
+    move->direction = CLOCKWISE;
+    move->inputTime = 0.0;
+
+    const char* suffix = token + 1;
+    if (token[0] == '\0')
+        return false;
+    else if (strchr(faceNames, token[0]) != NULL) {
+        move->turn = (int)(strchr(faceNames, token[0]) - faceNames);
+        if (*suffix == 'w') {
+            move->turn += TURN_WIDE;
+            suffix++;
+        }
+    }
+    else if (strchr(wideNames, token[0]) != NULL)
+        move->turn = TURN_WIDE + (int)(strchr(wideNames, token[0]) - wideNames);
+    else if (strchr(sliceNames, token[0]) != NULL)
+        move->turn = TURN_M + (int)(strchr(sliceNames, token[0]) - sliceNames);
+    else if (strchr(rotationNames, token[0]) != NULL)
+        move->turn = TURN_X + (int)(strchr(rotationNames, token[0]) - rotationNames);
+    else
+        return false;
+
+    // A half turn is the same either way, so "F2'" is F2 as well.
+    if (*suffix == '2') {
+        move->direction = HALF_TURN;
+        suffix++;
+    }
+    if (*suffix == '\'') {
+        if (move->direction != HALF_TURN)
+            move->direction = ANTI_CLOCKWISE;
+        suffix++;
+    }
+    return *suffix == '\0';
+}
+
+void FormatMove(const Move& move, char* text)
+{
+    const char turnNames[NUM_OF_TURNS + 1] = "UFRBLDMESUFRBLDxyz";
+    *text++ = turnNames[move.turn];
+    if (move.turn >= TURN_WIDE && move.turn < TURN_X)
+        *text++ = 'w';
+    if (move.direction == HALF_TURN)
+        *text++ = '2';
+    else if (move.direction == ANTI_CLOCKWISE)
+        *text++ = '\'';
+    *text = '\0';
+}
+
+void FormatMoves(const Cube& cube, const Move* moves, size_t count, char* text)
+{
+    // Only rotations change how the cube is held.
+    Cube held;
+    InitCube(held);
+    held.orientation = cube.orientation;
+    *text = '\0';
+    for (size_t i = 0; i < count; i++) {
+        FormatMove(HeldMove(held, moves[i]), text);
+        text += strlen(text);
+        *text++ = ' ';
+        *text = '\0';
+        if (moves[i].turn >= TURN_X)
+            ApplyMove(held, moves[i]);
+    }
+}
+
+void PrintMoves(const Cube& cube, const Move* moves, size_t count)
+{
+    std::vector<char> text(4 * count + 1);
+    FormatMoves(cube, moves, count, text.data());
+    fputs(text.data(), stdout);
+}
+
+bool ParseMoves(const char* text, std::vector<Move>& moves)
+{
+    Cube held;
+    InitCube(held);
+    while (*text != '\0') {
+        char token[8];
+        size_t length = strcspn(text, " \t\r\n");
+        if (length >= sizeof(token))
+            return false;
+        memcpy(token, text, length);
+        token[length] = '\0';
+        text += length;
+        text += strspn(text, " \t\r\n");
+        if (length == 0)
+            continue;
+
+        Move move;
+        if (!ParseMove(token, &move))
+            return false;
+        move = OrientMove(held, move);
+        ApplyMove(held, move);
+        moves.push_back(move);
+    }
+    return true;
+}
+
+// Reads a file of whitespace separated moves in standard notation. Everything after a '#' on a line is ignored.
+// Prints the reason and returns false if the file can't be read or holds something that isn't a move.
+bool ReadMoveFile(const char* filename, std::vector<Move>& moves)
+{
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        printf("Unable to open move file '%s'.\n", filename);
+        return false;
+    }
+
+    // How the cube is held after the moves so far.
+    Cube held;
+    InitCube(held);
+
+    char line[1024];
+    int lineNumber = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), file) != NULL) {
+        lineNumber++;
+        char* comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+
+        for (char* token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+            Move move;
+            if (!ParseMove(token, &move)) {
+                printf("%s:%d: '%s' is not a move.\n", filename, lineNumber, token);
+                ok = false;
+                break;
+            }
+            move = OrientMove(held, move);
+            ApplyMove(held, move);
+            moves.push_back(move);
+        }
+    }
+    fclose(file);
+    return ok;
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////
+// CUBE STATE
+//
+// The stickers of the cube and the moves that permute them. Nothing here
+// knows about drawing or threads, so the viewer, the simulation thread and
+// headless rendering all share it.
+//
+// INDEXING OF CUBE
+//         ---------
+//         | 0 1 2 |
+//         | 3 4 5 |
+//         | 6 7 8 |
+// ---------------------------------
+// | 0 1 2 | 0 1 2 | 0 1 2 | 0 1 2 |
+// | 3 4 5 | 3 4 5 | 3 4 5 | 3 4 5 |
+// | 6 7 8 | 6 7 8 | 6 7 8 | 6 7 8 |
+// ---------------------------------
+//         | 0 1 2 |
+//         | 3 4 5 |
+//         | 6 7 8 |
+//         ---------
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#define NUM_OF_FACES            6      // Number of Faces on the Cube.
+#define NUM_OF_SQUARES          9      // Number of Squares on the Face of a Cube.
+#define NUM_OF_STICKERS         (NUM_OF_FACES * NUM_OF_SQUARES)    // Number of Squares on the whole Cube.
+
+#define ANTI_CLOCKWISE          1      // Anitclockwise direction.
+#define CLOCKWISE               -1     // Clockwise direction.
+#define HALF_TURN               -2     // Half turn, animated clockwise like the two quarter turns it is.
+
+#define FACE_NONE               -1
+#define FACE_UP                 0      // The Up Face of the Cube.
+#define FACE_FRONT              1      // The Front Face of the Cube.
+#define FACE_RIGHT              2      // The Right Face of the Cube.
+#define FACE_BACK               3      // The Back Face of the Cube.
+#define FACE_LEFT               4      // The Left Face of the Cube.
+#define FACE_DOWN               5      // The Down Face of the Cube.
+
+#define WHITE                   0      // The index for the color White.
+#define GREEN                   1      // The index for the color Green.
+#define RED                     2      // The index for the color Red.
+#define BLUE                    3      // The index for the color Blue.
+#define ORANGE                  4      // The index for the color Orange.
+#define YELLOW                  5      // The index for the color Yellow.
+#define GREY                    6      // A sticker whose colour doesn't matter, in a goal.
+
+#define X_AXIS                  0      // The x-axis of the cube
+#define Y_AXIS                  1      // The y-axis of the cube
+#define Z_AXIS                  2      // The z-axis of the cube
+
+// The layers a move turns. A face turn turns the face's layer, a slice turn the middle layer
+// between two faces, a wide turn a face's layer and the middle layer behind it, and a cube
+// rotation all three layers.
+#define LAYER_NEGATIVE          1      // The layer at the negative end of an axis (L, D or B).
+#define LAYER_MIDDLE            2
+#define LAYER_POSITIVE          4      // The layer at the positive end of an axis (R, U or F).
+
+#define TURN_NONE               -1
+#define TURN_U                  0      // Face turns, numbered like the faces.
+#define TURN_F                  1
+#define TURN_R                  2
+#define TURN_B                  3
+#define TURN_L                  4
+#define TURN_D                  5
+#define TURN_M                  6      // Slice turns, numbered by axis. M turns like L,
+#define TURN_E                  7      // E like D
+#define TURN_S                  8      // and S like F.
+#define TURN_WIDE               9      // Wide turns are TURN_WIDE + face (Uw, Fw, Rw, Bw, Lw, Dw).
+#define TURN_X                  15     // Cube rotations, numbered by axis. x turns like R,
+#define TURN_Y                  16     // y like U
+#define TURN_Z                  17     // and z like F.
+#define NUM_OF_TURNS            18
+
+#define NUM_OF_MOVE_CODES       (NUM_OF_TURNS * 3)     // Every move, numbered by MoveCode.
+
+#define NUM_OF_ORIENTATIONS     24     // Ways the cube can be held. 0 is the way it starts.
+
+#define NUM_OF_PIECES           27     // Places of the pieces, numbered by StickerPiece (13, the core, has no stickers).
+#define PACKED_STICKERS_PER_WORD 21    // Stickers in each word of a PackedCube, 3 bits each.
+
+// The colour of every sticker, indexed as above, and how the cube is held. The stickers are
+// always indexed as if the cube were held the way it starts, so rotating the whole cube only
+// changes orientation, and turns are remapped to the faces they turn (see OrientMove).
+struct Cube {
+    int stickers[NUM_OF_FACES][NUM_OF_SQUARES];
+    int orientation;
+};
+
+// The stickers of a cube packed into 162 bits, for hashing and comparing states. Sticker i is
+// bits 3 * (i % 21) of words[i / 21]; the top bit of every word and the last 28 bits of words[2]
+// are left 0. The orientation isn't kept.
+struct PackedCube {
+    uint64_t words[3];
+};
+
+// A single move: a quarter or half turn of some layers. Faces, slices and axes are the cube's own
+// (see Cube) unless said otherwise.
+struct Move {
+    int turn;               // TURN_ constant.
+    int direction;          // CLOCKWISE, ANTI_CLOCKWISE or HALF_TURN.
+    double inputTime;       // LatencyNow() of the key press that queued the move, or 0.
+};
+
+// Initializes the cube in the solved state.
+void InitCube(Cube& cube);
+
+// Applies a move straight to the cube's state. Cube rotations only change the orientation.
+void ApplyMove(Cube& cube, const Move& move);
+
+// The move that turns the layers the given move would turn if the faces, slices and axes it
+// names were those of the cube as it is held, e.g. F when the cube is held upside down turns D.
+Move OrientMove(const Cube& cube, const Move& move);
+
+// The inverse of OrientMove: the move, relative to how the cube is held, that turns the same
+// layers as the given move of the cube's own faces, slices and axes.
+Move HeldMove(const Cube& cube, const Move& move);
+
+// The axis a turn turns about, the LAYER_ flags of the layers it turns, and 1 if it turns
+// clockwise looking from the positive end of the axis (like R, U or F), -1 if from the negative end.
+void TurnLayers(int turn, int* axis, int* layers, int* sign);
+
+// The turn of some layers on an axis, or TURN_NONE if no single turn turns just those.
+int TurnOfLayers(int axis, int layers);
+
+// Sets matrix to the rotation from the cube's own axes to those of the viewer when it is held
+// in the given orientation (row by column, x, y, z as in IsStickerTurning).
+void OrientationMatrix(int orientation, int matrix[3][3]);
+
+// Moves the stickers to where they appear and sets the orientation to 0, so the cube looks the same.
+void ResetOrientation(Cube& cube);
+
+// A number from 0 to NUM_OF_MOVE_CODES - 1 for a move: turn * 2, plus 1 if anticlockwise, for a
+// quarter turn, and NUM_OF_TURNS * 2 + turn for a half turn.
+int MoveCode(const Move& move);
+
+// The move numbered code by MoveCode, with no inputTime.
+Move MoveFromCode(int code);
+
+// The move that undoes a move.
+Move InverseMove(const Move& move);
+
+// Packs the stickers of a cube, or unpacks them into a cube held the usual way.
+void PackCube(const Cube& cube, PackedCube& packed);
+void UnpackCube(const PackedCube& packed, Cube& cube);
+
+// A well mixed hash of a packed state, for hash sets of states.
+uint64_t HashPackedCube(const PackedCube& packed);
+
+// The place of the piece a sticker (face * NUM_OF_SQUARES + square) is on: x + 3 * y + 9 * z, with
+// x from the left layer (0) to the right (2), y from down to up and z from back to front.
+int StickerPiece(int sticker);
+
+// Applies 20 to 60 random face turns. The same seed always gives the same turns.
+void ScrambleCube(Cube& cube, unsigned int seed);
+
+// The number of stickers that differ from their face's centre (e.g. 12 after a U move from solved).
+int CountIncorrectStickers(const Cube& cube);
+
+// Checks if a Square on a Face is in the layers a turn turns (TURN_ constant). The cube is on
+// the axes of main.cpp: x to the right face, y to the up face and z to the front face.
+bool IsStickerTurning(int turn, int face, int square);
+
+void PrintCube(const Cube& cube);
+
+// Parses a single move in standard notation (e.g. "R", "U'", "F2", "M", "Rw", "r'", "z").
+// Returns false if the token is not a move.
+bool ParseMove(const char* token, Move* move);
+
+// Writes a move in standard notation (e.g. "R'", "Uw2", "M", "x") to text, which must hold 4 characters.
+void FormatMove(const Move& move, char* text);
+
+// Writes moves, as applied with ApplyMove to the cube, in standard notation relative to how it is
+// held before each of them, each followed by a space. ParseMoves reads them back as the same moves
+// after whatever moves left the cube held that way. Text must hold 4 characters a move, and 1 more.
+void FormatMoves(const Cube& cube, const Move* moves, size_t count, char* text);
+
+// Prints moves as FormatMoves writes them.
+void PrintMoves(const Cube& cube, const Move* moves, size_t count);
+
+// Parses whitespace separated moves in standard notation, relative to how the cube is held after
+// the moves before them, and adds them to moves oriented for a cube held the usual way. Returns
+// false if something isn't a move.
+bool ParseMoves(const char* text, std::vector<Move>& moves);
+
+// Reads a file of whitespace separated moves in standard notation. Everything after a '#' on a line is ignored.
+// The moves are relative to how the cube is held after the moves before them, and are returned
+// oriented for a cube that starts held the usual way.
+// Prints the reason and returns false if the file can't be read or holds something that isn't a move.
+bool ReadMoveFile(const char* filename, std::vector<Move>& moves);
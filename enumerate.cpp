@@ -0,0 +1,417 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "enumerate.h"
+
+#define ENUMERATE_MOVES         18     // Face turns: 1 + turn * 3 + direction in the sequences.
+#define ENUMERATE_BATCH         512    // States a thread collects for a shard before handing them over.
+#define ENUMERATE_EMPTY_SLOT    0xFFFFFFFFu
+
+static const int moveDirections[3] = { CLOCKWISE, ANTI_CLOCKWISE, HALF_TURN };
+
+// The states of one depth, each shard in memory or in its file.
+struct EnumerateLevel {
+    std::vector<EnumeratedState> shards[ENUMERATE_SHARDS];
+    bool onDisk[ENUMERATE_SHARDS];
+};
+
+// The states handed to a shard during a depth, before they are deduplicated.
+struct EnumerateShard {
+    std::mutex mutex;
+    std::vector<EnumeratedState> incoming;
+    FILE* spill;                                // The ones handed over once the memory ran out.
+};
+
+struct Enumeration {
+    const EnumerateOptions* options;
+    EnumerateLevel levels[3];                   // Depth d is levels[d % 3].
+    EnumerateShard shards[ENUMERATE_SHARDS];
+    bool allowed[ENUMERATE_MOVES + 1][ENUMERATE_MOVES];     // Moves allowed after each move (or none, at 0).
+
+    std::atomic<size_t> memory;                 // Bytes of states in memory.
+    std::atomic<bool> spilling;                 // The memory ran out during this depth.
+    std::atomic<int> nextShard;                 // Shard for the next thread that wants work.
+    std::atomic<int> result;
+    std::atomic<uint64_t> sequences;
+    std::atomic<uint64_t> states;
+    bool spilled;
+};
+
+static Move EnumeratedMove(int move)
+{
+    Move result = { move / 3, moveDirections[move % 3], 0.0 };
+    return result;
+}
+
+static int ShardOf(const PackedCube& state)
+{
+    return (int)(HashPackedCube(state) >> 56);
+}
+
+static void FilePath(const Enumeration& enumeration, const char* kind, int depth, int shard, char* path, size_t size)
+{
+    snprintf(path, size, "%s/%s_%02d_%03d.tmp", enumeration.options->directory, kind, depth, shard);
+}
+
+static bool WriteStates(const char* path, const std::vector<EnumeratedState>& states)
+{
+    FILE* file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+    bool ok = fwrite(states.data(), sizeof(EnumeratedState), states.size(), file) == states.size();
+    return (fclose(file) == 0) && ok;
+}
+
+// Adds the states in a file to states.
+static bool ReadStates(const char* path, std::vector<EnumeratedState>& states)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == NULL)
+        return false;
+    EnumeratedState buffer[ENUMERATE_BATCH];
+    size_t count;
+    while ((count = fread(buffer, sizeof(EnumeratedState), ENUMERATE_BATCH, file)) > 0) {
+        states.insert(states.end(), buffer, buffer + count);
+    }
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+// The states of a shard at a depth, read into scratch if they are on disk. Returns NULL if they
+// can't be read.
+static const std::vector<EnumeratedState>* LevelShard(Enumeration& enumeration, int depth, int shard,
+                                                     std::vector<EnumeratedState>& scratch)
+{
+    EnumerateLevel& level = enumeration.levels[depth % 3];
+    if (!level.onDisk[shard])
+        return &level.shards[shard];
+    char path[1024];
+    FilePath(enumeration, "level", depth, shard, path, sizeof(path));
+    scratch.clear();
+    return ReadStates(path, scratch) ? &scratch : NULL;
+}
+
+static void Fail(Enumeration& enumeration, int result)
+{
+    int expected = ENUMERATE_DONE;
+    enumeration.result.compare_exchange_strong(expected, result);
+}
+
+// Hands a batch of states to their shard: into memory while it lasts, then to the shard's file.
+static void HandOver(Enumeration& enumeration, int shard, std::vector<EnumeratedState>& batch)
+{
+    EnumerateShard& target = enumeration.shards[shard];
+    size_t bytes = batch.size() * sizeof(EnumeratedState);
+    std::lock_guard<std::mutex> lock(target.mutex);
+    if (!enumeration.spilling && enumeration.memory + bytes > enumeration.options->maxMemory) {
+        if (enumeration.options->directory == NULL)
+            Fail(enumeration, ENUMERATE_OUT_OF_MEMORY);
+        enumeration.spilling = true;
+    }
+    if (!enumeration.spilling) {
+        target.incoming.insert(target.incoming.end(), batch.begin(), batch.end());
+        enumeration.memory += bytes;
+    }
+    else if (enumeration.options->directory != NULL) {
+        if (target.spill == NULL) {
+            char path[1024];
+            FilePath(enumeration, "incoming", 0, shard, path, sizeof(path));
+            target.spill = fopen(path, "wb");
+        }
+        if (target.spill == NULL || fwrite(batch.data(), sizeof(EnumeratedState), batch.size(), target.spill) != batch.size())
+            Fail(enumeration, ENUMERATE_FILE_ERROR);
+    }
+    batch.clear();
+}
+
+// Turns the states of a depth by every canonical move, handing the results to their shards.
+static void ExpandThread(Enumeration* enumeration, int depth)
+{
+    std::vector<EnumeratedState> batches[ENUMERATE_SHARDS];
+    std::vector<EnumeratedState> scratch;
+    uint64_t sequences = 0;
+    for (int shard; (shard = enumeration->nextShard++) < ENUMERATE_SHARDS && enumeration->result == ENUMERATE_DONE;) {
+        const std::vector<EnumeratedState>* states = LevelShard(*enumeration, depth, shard, scratch);
+        if (states == NULL) {
+            Fail(*enumeration, ENUMERATE_FILE_ERROR);
+            break;
+        }
+        for (size_t i = 0; i < states->size(); i++) {
+            const EnumeratedState& parent = (*states)[i];
+            Cube cube;
+            UnpackCube(parent.state, cube);
+            const bool* allowed = enumeration->allowed[parent.sequence & 31];
+            for (int move = 0; move < ENUMERATE_MOVES; move++) {
+                if (!allowed[move])
+                    continue;
+                Cube next = cube;
+                ApplyMove(next, EnumeratedMove(move));
+                EnumeratedState child;
+                PackCube(next, child.state);
+                child.sequence = (parent.sequence << 5) | (uint64_t)(move + 1);
+                int target = ShardOf(child.state);
+                batches[target].push_back(child);
+                if (batches[target].size() == ENUMERATE_BATCH)
+                    HandOver(*enumeration, target, batches[target]);
+                sequences++;
+            }
+        }
+    }
+    for (int shard = 0; shard < ENUMERATE_SHARDS; shard++) {
+        if (!batches[shard].empty())
+            HandOver(*enumeration, shard, batches[shard]);
+    }
+    enumeration->sequences += sequences;
+}
+
+static bool SameState(const PackedCube& a, const PackedCube& b)
+{
+    return a.words[0] == b.words[0] && a.words[1] == b.words[1] && a.words[2] == b.words[2];
+}
+
+// Keeps the states handed to each shard that aren't in the last two depths, once each with the
+// first of their sequences, as the shard of the new depth.
+static void DeduplicateThread(Enumeration* enumeration, int depth)
+{
+    std::vector<EnumeratedState> incoming, previous, beforePrevious, table, found;
+    std::vector<uint32_t> slots;
+    char path[1024];
+    for (int shard; (shard = enumeration->nextShard++) < ENUMERATE_SHARDS && enumeration->result == ENUMERATE_DONE;) {
+        EnumerateShard& source = enumeration->shards[shard];
+        incoming.swap(source.incoming);
+        enumeration->memory -= incoming.size() * sizeof(EnumeratedState);
+        std::vector<EnumeratedState>().swap(source.incoming);
+        if (source.spill != NULL) {
+            fclose(source.spill);
+            source.spill = NULL;
+            FilePath(*enumeration, "incoming", 0, shard, path, sizeof(path));
+            if (!ReadStates(path, incoming))
+                Fail(*enumeration, ENUMERATE_FILE_ERROR);
+            remove(path);
+        }
+        const std::vector<EnumeratedState>* older[2] = { LevelShard(*enumeration, depth - 1, shard, previous), NULL };
+        if (depth >= 2)
+            older[1] = LevelShard(*enumeration, depth - 2, shard, beforePrevious);
+        if (older[0] == NULL || (depth >= 2 && older[1] == NULL)) {
+            Fail(*enumeration, ENUMERATE_FILE_ERROR);
+            break;
+        }
+
+        // The older states then the new ones in table, found by open addressing at most half full.
+        size_t numOlder = older[0]->size() + (older[1] != NULL ? older[1]->size() : 0);
+        size_t capacity = 16;
+        while (capacity < 2 * (numOlder + incoming.size())) {
+            capacity *= 2;
+        }
+        slots.assign(capacity, ENUMERATE_EMPTY_SLOT);
+        size_t mask = capacity - 1;
+        table.clear();
+        for (int i = 0; i < 2 && older[i] != NULL; i++) {
+            table.insert(table.end(), older[i]->begin(), older[i]->end());
+        }
+        for (size_t j = 0; j < table.size(); j++) {
+            size_t slot = HashPackedCube(table[j].state) & mask;
+            while (slots[slot] != ENUMERATE_EMPTY_SLOT) {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = (uint32_t)j;
+        }
+        for (size_t j = 0; j < incoming.size(); j++) {
+            const EnumeratedState& state = incoming[j];
+            size_t slot = HashPackedCube(state.state) & mask;
+            while (slots[slot] != ENUMERATE_EMPTY_SLOT && !SameState(table[slots[slot]].state, state.state)) {
+                slot = (slot + 1) & mask;
+            }
+            if (slots[slot] == ENUMERATE_EMPTY_SLOT) {
+                slots[slot] = (uint32_t)table.size();
+                table.push_back(state);
+            }
+            else if (slots[slot] >= numOlder && state.sequence < table[slots[slot]].sequence) {
+                table[slots[slot]].sequence = state.sequence;
+            }
+        }
+        found.assign(table.begin() + numOlder, table.end());
+        std::sort(found.begin(), found.end(), [](const EnumeratedState& a, const EnumeratedState& b) { return a.sequence < b.sequence; });
+        incoming.clear();
+
+        // Keep the new shard in memory if there is room.
+        EnumerateLevel& level = enumeration->levels[depth % 3];
+        size_t bytes = found.size() * sizeof(EnumeratedState);
+        level.onDisk[shard] = false;
+        if (enumeration->memory + bytes <= enumeration->options->maxMemory) {
+            level.shards[shard] = found;
+            enumeration->memory += bytes;
+        }
+        else if (enumeration->options->directory == NULL) {
+            Fail(*enumeration, ENUMERATE_OUT_OF_MEMORY);
+        }
+        else {
+            FilePath(*enumeration, "level", depth, shard, path, sizeof(path));
+            if (!WriteStates(path, found))
+                Fail(*enumeration, ENUMERATE_FILE_ERROR);
+            level.onDisk[shard] = true;
+            enumeration->spilling = true;
+        }
+        enumeration->states += found.size();
+    }
+}
+
+// Runs a phase on every thread, each taking shards until there are none left.
+static void RunThreads(Enumeration& enumeration, int depth, void (*phase)(Enumeration*, int))
+{
+    enumeration.nextShard = 0;
+    std::vector<std::thread> threads;
+    for (int i = 1; i < enumeration.options->numThreads; i++) {
+        threads.push_back(std::thread(phase, &enumeration, depth));
+    }
+    phase(&enumeration, depth);
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+
+// Frees the states of a depth, in memory and on disk.
+static void DropLevel(Enumeration& enumeration, int depth)
+{
+    EnumerateLevel& level = enumeration.levels[depth % 3];
+    for (int shard = 0; shard < ENUMERATE_SHARDS; shard++) {
+        if (level.onDisk[shard]) {
+            char path[1024];
+            FilePath(enumeration, "level", depth, shard, path, sizeof(path));
+            remove(path);
+            level.onDisk[shard] = false;
+        }
+        enumeration.memory -= level.shards[shard].size() * sizeof(EnumeratedState);
+        std::vector<EnumeratedState>().swap(level.shards[shard]);
+    }
+}
+
+// Writes the states of a depth to depth_NN.states in the directory, shard by shard.
+static bool WriteDatabase(Enumeration& enumeration, int depth)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/depth_%02d.states", enumeration.options->directory, depth);
+    FILE* file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+    bool ok = true;
+    std::vector<EnumeratedState> scratch;
+    for (int shard = 0; ok && shard < ENUMERATE_SHARDS; shard++) {
+        const std::vector<EnumeratedState>* states = LevelShard(enumeration, depth, shard, scratch);
+        ok = (states != NULL) && fwrite(states->data(), sizeof(EnumeratedState), states->size(), file) == states->size();
+    }
+    return (fclose(file) == 0) && ok;
+}
+
+void InitEnumerateOptions(EnumerateOptions& options)
+{
+    options.maxDepth = 7;
+    options.numThreads = (int)std::thread::hardware_concurrency();
+    if (options.numThreads < 1)
+        options.numThreads = 1;
+    options.maxMemory = ENUMERATE_DEFAULT_MEMORY;
+    options.directory = NULL;
+    options.writeDatabase = false;
+}
+
+int EnumerateStates(const EnumerateOptions& options, EnumerateCallback done, void* context)
+{
+    Enumeration* enumeration = new Enumeration();
+    enumeration->options = &options;
+    enumeration->memory = 0;
+    enumeration->spilling = false;
+    enumeration->result = ENUMERATE_DONE;
+    enumeration->spilled = false;
+    for (int shard = 0; shard < ENUMERATE_SHARDS; shard++) {
+        enumeration->shards[shard].spill = NULL;
+        for (int i = 0; i < 3; i++) {
+            enumeration->levels[i].onDisk[shard] = false;
+        }
+    }
+
+    // A move is allowed after another unless it turns the same face, or the opposite face when
+    // that comes first in TURN_ order (so of U D and D U only U D is walked).
+    for (int last = 0; last <= ENUMERATE_MOVES; last++) {
+        for (int move = 0; move < ENUMERATE_MOVES; move++) {
+            int face = move / 3, lastFace = (last - 1) / 3;
+            int axis, lastAxis, layers, sign;
+            TurnLayers(face, &axis, &layers, &sign);
+            TurnLayers(lastFace, &lastAxis, &layers, &sign);
+            enumeration->allowed[last][move] = (last == 0) || (face != lastFace && (axis != lastAxis || face > lastFace));
+        }
+    }
+
+    // Depth 0 is the solved cube.
+    Cube solved;
+    InitCube(solved);
+    EnumeratedState start;
+    PackCube(solved, start.state);
+    start.sequence = 0;
+    enumeration->levels[0].shards[ShardOf(start.state)].push_back(start);
+    enumeration->memory += sizeof(EnumeratedState);
+    EnumerateDepth result = { 0, 1, 1, 0.0, false };
+    if (options.writeDatabase && options.directory != NULL && !WriteDatabase(*enumeration, 0))
+        enumeration->result = ENUMERATE_FILE_ERROR;
+    else if (done != NULL)
+        done(result, context);
+
+    int reached = 0;
+    for (int depth = 1; depth <= options.maxDepth && depth <= ENUMERATE_MAX_DEPTH && enumeration->result == ENUMERATE_DONE; depth++) {
+        reached = depth;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        if (depth >= 3)
+            DropLevel(*enumeration, depth - 3);
+        enumeration->sequences = 0;
+        enumeration->states = 0;
+        enumeration->spilling = false;
+        RunThreads(*enumeration, depth - 1, ExpandThread);
+        bool spilled = enumeration->spilling;
+        if (enumeration->result == ENUMERATE_DONE)
+            RunThreads(*enumeration, depth, DeduplicateThread);
+        if (enumeration->result != ENUMERATE_DONE)
+            break;
+        if (options.writeDatabase && options.directory != NULL && !WriteDatabase(*enumeration, depth)) {
+            enumeration->result = ENUMERATE_FILE_ERROR;
+            break;
+        }
+
+        result.depth = depth;
+        result.sequences = enumeration->sequences;
+        result.states = enumeration->states;
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.spilled = spilled || enumeration->spilling;
+        if (done != NULL)
+            done(result, context);
+    }
+
+    // Leave no spill files behind.
+    for (int depth = reached; depth >= 0 && depth > reached - 3; depth--) {
+        DropLevel(*enumeration, depth);
+    }
+    for (int shard = 0; shard < ENUMERATE_SHARDS; shard++) {
+        if (enumeration->shards[shard].spill != NULL) {
+            char path[1024];
+            fclose(enumeration->shards[shard].spill);
+            FilePath(*enumeration, "incoming", 0, shard, path, sizeof(path));
+            remove(path);
+        }
+    }
+    int status = enumeration->result;
+    delete enumeration;
+    return status;
+}
+
+void EnumeratedMoves(uint64_t sequence, int depth, std::vector<Move>& moves)
+{
+    moves.clear();
+    for (int i = depth - 1; i >= 0; i--) {
+        moves.push_back(EnumeratedMove((int)((sequence >> (5 * i)) & 31) - 1));
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// STATE ENUMERATION
+//
+// Finds every state a given number of face turns from solved, a depth at a
+// time, with one shortest sequence for each. Only canonical sequences are
+// walked: no face is turned twice in a row, and of two opposite faces
+// turned one after the other (which commute) only one order is taken.
+//
+// Each state's neighbours are one move closer, as far or one move further
+// from solved, so the new states of a depth are the states a move beyond
+// the last depth that aren't in it or the one before. The states are split
+// into shards by their hash. Worker threads turn the states of the last
+// depth and hand the new states to their shards in batches; then each
+// shard is deduplicated on its own against its part of the last two depths,
+// the shards spread over the threads, so no two threads ever share a set.
+//
+// When the memory runs out, the rest of a depth's states and the states of
+// the depths after it are spilled to files in a directory, a file a shard,
+// and only a shard at a time is loaded to deduplicate it.
+/////////////////////////////////////////////////////////////////////////////
+
+#define ENUMERATE_MAX_DEPTH     12     // Deepest depth a sequence fits in 64 bits for.
+#define ENUMERATE_SHARDS        256
+#define ENUMERATE_DEFAULT_MEMORY ((size_t)1 << 30)
+
+#define ENUMERATE_DONE          0
+#define ENUMERATE_OUT_OF_MEMORY 1      // The memory ran out with no directory to spill to.
+#define ENUMERATE_FILE_ERROR    2      // A file in the directory couldn't be written or read.
+
+// A state and the moves that reach it, as stored in the database files. The moves are 5 bits
+// each, the first highest, as 1 + turn * 3 + 0 (clockwise), 1 (anticlockwise) or 2 (half turn).
+struct EnumeratedState {
+    PackedCube state;
+    uint64_t sequence;
+};
+
+struct EnumerateOptions {
+    int maxDepth;
+    int numThreads;
+    size_t maxMemory;           // Bytes of states kept in memory before spilling.
+    const char* directory;      // Where to spill, and write the database; NULL for neither.
+    bool writeDatabase;         // Write the states of each depth to depth_NN.states in the directory.
+};
+
+struct EnumerateDepth {
+    int depth;
+    uint64_t sequences;         // Sequences tried: each state of the depth before turned by each canonical move.
+    uint64_t states;            // States this many moves from solved and no closer.
+    double seconds;
+    bool spilled;               // Some of the states went to disk.
+};
+
+// Called after each depth.
+typedef void (*EnumerateCallback)(const EnumerateDepth& depth, void* context);
+
+// Sets options to depth 7, a thread per core, ENUMERATE_DEFAULT_MEMORY and no directory.
+void InitEnumerateOptions(EnumerateOptions& options);
+
+// Enumerates the states up to options.maxDepth moves from solved. Returns an ENUMERATE_ result.
+int EnumerateStates(const EnumerateOptions& options, EnumerateCallback done, void* context);
+
+// The moves of a sequence of an EnumeratedState at a depth.
+void EnumeratedMoves(uint64_t sequence, int depth, std::vector<Move>& moves);
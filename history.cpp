@@ -0,0 +1,97 @@
+#include <algorithm>
+
+#include "history.h"
+
+static void AddSnapshot(MoveHistory& history)
+{
+    HistorySnapshot snapshot = { history.position, history.cube };
+    history.snapshots.push_back(snapshot);
+}
+
+// Forgets the events after the current position, which are replaced by a new one.
+static void ForgetRedo(MoveHistory& history)
+{
+    history.codes.resize(history.position);
+    while (history.snapshots.back().position > history.position) {
+        history.snapshots.pop_back();
+    }
+}
+
+void InitHistory(MoveHistory& history, const Cube& cube)
+{
+    history.codes.clear();
+    history.snapshots.clear();
+    history.position = 0;
+    history.cube = cube;
+    AddSnapshot(history);
+}
+
+void RecordHistoryMove(MoveHistory& history, const Move& move)
+{
+    ForgetRedo(history);
+    history.codes.push_back((unsigned char)MoveCode(move));
+    history.position++;
+    ApplyMove(history.cube, move);
+    if (history.position - history.snapshots.back().position >= HISTORY_SNAPSHOT_INTERVAL)
+        AddSnapshot(history);
+}
+
+void RecordHistoryState(MoveHistory& history, const Cube& cube)
+{
+    ForgetRedo(history);
+    if (history.snapshots.back().position != history.position)
+        AddSnapshot(history);
+    history.codes.push_back(HISTORY_STATE_CHANGE);
+    history.position++;
+    history.cube = cube;
+    AddSnapshot(history);
+}
+
+int UndoHistory(MoveHistory& history, Move* move, Cube* cube)
+{
+    if (history.position == 0)
+        return HISTORY_NONE;
+    int code = history.codes[history.position - 1];
+    if (code == HISTORY_STATE_CHANGE) {
+        JumpHistory(history, history.position - 1, cube);
+        return HISTORY_STATE;
+    }
+    *move = InverseMove(MoveFromCode(code));
+    ApplyMove(history.cube, *move);
+    history.position--;
+    return HISTORY_MOVE;
+}
+
+int RedoHistory(MoveHistory& history, Move* move, Cube* cube)
+{
+    if (history.position == (int)history.codes.size())
+        return HISTORY_NONE;
+    int code = history.codes[history.position];
+    if (code == HISTORY_STATE_CHANGE) {
+        JumpHistory(history, history.position + 1, cube);
+        return HISTORY_STATE;
+    }
+    *move = MoveFromCode(code);
+    ApplyMove(history.cube, *move);
+    history.position++;
+    return HISTORY_MOVE;
+}
+
+void JumpHistory(MoveHistory& history, int position, Cube* cube)
+{
+    position = std::clamp(position, 0, (int)history.codes.size());
+
+    // The last snapshot at or before the position. Every reset and scramble is followed by a
+    // snapshot, so only moves lie between it and the position.
+    std::vector<HistorySnapshot>::const_iterator snapshot = std::upper_bound(
+        history.snapshots.begin(), history.snapshots.end(), position,
+        [](int position, const HistorySnapshot& snapshot) { return position < snapshot.position; });
+    --snapshot;
+
+    history.cube = snapshot->cube;
+    for (int i = snapshot->position; i < position; i++) {
+        ApplyMove(history.cube, MoveFromCode(history.codes[i]));
+    }
+    history.position = position;
+    *cube = history.cube;
+}
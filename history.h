@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// UNDO HISTORY
+//
+// Every move made, one byte each (its MoveCode), and how far back it has
+// been undone. A move is undone by applying its inverse, so stepping never
+// copies the state. Resets and scrambles can't be inverted, so they get a
+// snapshot of the state on either side. With a snapshot every
+// HISTORY_SNAPSHOT_INTERVAL moves as well, jumping to any point is a binary
+// search for the snapshot before it and at most that many moves replayed.
+// Snapshots add well under a byte a move, so a million moves take about a
+// megabyte.
+/////////////////////////////////////////////////////////////////////////////
+
+#define HISTORY_SNAPSHOT_INTERVAL 4096      // Most moves between snapshots.
+#define HISTORY_STATE_CHANGE    NUM_OF_MOVE_CODES   // Code of a reset or scramble.
+
+#define HISTORY_NONE            0      // There was nothing to undo or redo.
+#define HISTORY_MOVE            1      // Undone or redone by a move.
+#define HISTORY_STATE           2      // Undone or redone by setting the state.
+
+struct HistorySnapshot {
+    int position;               // Number of events before the state.
+    Cube cube;
+};
+
+struct MoveHistory {
+    std::vector<unsigned char> codes;           // Every event, oldest first.
+    std::vector<HistorySnapshot> snapshots;     // Ordered by position. The first is at 0.
+    int position;                               // Events applied. Those after it can be redone.
+    Cube cube;                                  // The state after position events.
+};
+
+// Starts an empty history from the given state.
+void InitHistory(MoveHistory& history, const Cube& cube);
+
+// Records a move after the current position, forgetting the events that could have been redone.
+void RecordHistoryMove(MoveHistory& history, const Move& move);
+
+// Records a reset, scramble or anything else that left the cube in the given state.
+void RecordHistoryState(MoveHistory& history, const Cube& cube);
+
+// Steps back over an event. Sets move to the inverse of a move and returns HISTORY_MOVE, or
+// sets cube to the state before a reset or scramble and returns HISTORY_STATE.
+int UndoHistory(MoveHistory& history, Move* move, Cube* cube);
+
+// Steps forward over an undone event, like UndoHistory.
+int RedoHistory(MoveHistory& history, Move* move, Cube* cube);
+
+// Moves to the state after the given number of events, setting cube to it.
+void JumpHistory(MoveHistory& history, int position, Cube* cube);
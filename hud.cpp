@@ -0,0 +1,402 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef __APPLE__
+#define GL_SILENCE_DEPRECATION
+#include <GLUT/glut.h>
+#else
+#include <GL/glut.h>
+#endif
+
+#include "hud.h"
+#include "latency.h"
+
+#define GLYPH_WIDTH             5      // Width of a glyph in the font, in texels.
+#define GLYPH_HEIGHT            7      // Height of a glyph in the font, in texels.
+#define ATLAS_CELL_SIZE         8      // Glyphs are placed on an 8x8 texel grid in the atlas.
+#define ATLAS_COLUMNS           16
+#define ATLAS_WIDTH             128    // Power of two sizes, for OpenGL 1.1.
+#define ATLAS_HEIGHT            64
+#define ATLAS_SOLID_CELL        127    // The cell for DEL is filled in, for drawing backgrounds.
+
+#define HUD_SCALE               2      // Screen pixels per font texel.
+#define HUD_MARGIN              8      // Distance of the HUD from the window's corner, in pixels.
+#define HUD_LINE_SPACING        4      // Pixels between lines of text.
+#define HUD_MAX_QUADS           512    // Most characters (plus background) drawn in one frame.
+#define HUD_MAX_LINE_LENGTH     64
+#define HUD_NUM_LINES           5
+
+#define SCRUB_BAR_HEIGHT        16     // Height of the scrub bar's handle, in pixels.
+#define SCRUB_BAR_LABEL_WIDTH   200    // Room left of the track for the time, in pixels.
+
+// A character of the 5x7 font. Each row is a bit mask, with bit 4 the leftmost column.
+struct Glyph {
+    char character;
+    unsigned char rows[GLYPH_HEIGHT];
+};
+
+// Lower case letters are drawn with the upper case glyphs.
+static const Glyph font[] = {
+    { ' ', { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+    { '!', { 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 } },
+    { '#', { 0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A } },
+    { '%', { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 } },
+    { '\'', { 0x0C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00 } },
+    { '(', { 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 } },
+    { ')', { 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 } },
+    { '*', { 0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00 } },
+    { '+', { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 } },
+    { ',', { 0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08 } },
+    { '-', { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 } },
+    { '.', { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C } },
+    { '/', { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 } },
+    { '0', { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E } },
+    { '1', { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E } },
+    { '2', { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F } },
+    { '3', { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E } },
+    { '4', { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 } },
+    { '5', { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E } },
+    { '6', { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E } },
+    { '7', { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 } },
+    { '8', { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E } },
+    { '9', { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C } },
+    { ':', { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 } },
+    { '<', { 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02 } },
+    { '=', { 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00 } },
+    { '>', { 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08 } },
+    { '?', { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04 } },
+    { 'A', { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 } },
+    { 'B', { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E } },
+    { 'C', { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E } },
+    { 'D', { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C } },
+    { 'E', { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F } },
+    { 'F', { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 } },
+    { 'G', { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F } },
+    { 'H', { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 } },
+    { 'I', { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E } },
+    { 'J', { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C } },
+    { 'K', { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 } },
+    { 'L', { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F } },
+    { 'M', { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 } },
+    { 'N', { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 } },
+    { 'O', { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E } },
+    { 'P', { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 } },
+    { 'Q', { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D } },
+    { 'R', { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 } },
+    { 'S', { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E } },
+    { 'T', { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 } },
+    { 'U', { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E } },
+    { 'V', { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 } },
+    { 'W', { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A } },
+    { 'X', { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 } },
+    { 'Y', { 0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04 } },
+    { 'Z', { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F } },
+    { '[', { 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E } },
+    { ']', { 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E } },
+    { '_', { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F } },
+    { '|', { 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 } },
+};
+
+// Vertices of the HUD's quads, rebuilt every frame and drawn with one call.
+struct HudVertex {
+    GLfloat position[2];
+    GLfloat texCoord[2];
+    GLubyte color[4];
+};
+
+static GLuint atlasTexture = 0;
+static HudVertex vertices[HUD_MAX_QUADS * 4];
+static int numQuads = 0;
+
+// Frame statistics, kept for the last HUD_FRAME_HISTORY frames.
+static double frameTimes[HUD_FRAME_HISTORY];
+static double phaseTimes[HUD_FRAME_HISTORY][NUM_OF_HUD_PHASES];
+static int drawCalls[HUD_FRAME_HISTORY];
+static int numFrames = 0;
+static double frameStart = 0.0;
+static double currentPhaseTimes[NUM_OF_HUD_PHASES] = { 0.0, 0.0, 0.0, 0.0 };
+static int currentDrawCalls = 0;
+
+static double moveTimes[HUD_MOVE_HISTORY];
+static int numMoves = 0;
+
+double HudNow()
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+void HudBeginFrame()
+{
+    frameStart = HudNow();
+}
+
+void HudEndFrame()
+{
+    int slot = numFrames % HUD_FRAME_HISTORY;
+    frameTimes[slot] = HudNow() - frameStart;
+    for (int phase = 0; phase < NUM_OF_HUD_PHASES; phase++) {
+        phaseTimes[slot][phase] = currentPhaseTimes[phase];
+        currentPhaseTimes[phase] = 0.0;
+    }
+    drawCalls[slot] = currentDrawCalls;
+    currentDrawCalls = 0;
+    numFrames++;
+}
+
+void HudAddPhaseTime(int phase, double microseconds)
+{
+    currentPhaseTimes[phase] += microseconds;
+}
+
+void HudCountDrawCalls(int count)
+{
+    currentDrawCalls += count;
+}
+
+void HudCountMove()
+{
+    moveTimes[numMoves % HUD_MOVE_HISTORY] = HudNow();
+    numMoves++;
+}
+
+// Bakes the font into an alpha texture, one glyph per ATLAS_CELL_SIZE cell, indexed by character code.
+static void CreateAtlas()
+{
+    static GLubyte texels[ATLAS_HEIGHT][ATLAS_WIDTH];
+    memset(texels, 0, sizeof(texels));
+
+    for (size_t i = 0; i < sizeof(font) / sizeof(font[0]); i++) {
+        int cellX = (font[i].character % ATLAS_COLUMNS) * ATLAS_CELL_SIZE;
+        int cellY = (font[i].character / ATLAS_COLUMNS) * ATLAS_CELL_SIZE;
+        for (int row = 0; row < GLYPH_HEIGHT; row++) {
+            for (int col = 0; col < GLYPH_WIDTH; col++) {
+                if (font[i].rows[row] & (1 << (GLYPH_WIDTH - 1 - col)))
+                    texels[cellY + row][cellX + col] = 255;
+            }
+        }
+    }
+    int solidX = (ATLAS_SOLID_CELL % ATLAS_COLUMNS) * ATLAS_CELL_SIZE;
+    int solidY = (ATLAS_SOLID_CELL / ATLAS_COLUMNS) * ATLAS_CELL_SIZE;
+    for (int row = 0; row < ATLAS_CELL_SIZE; row++) {
+        memset(&texels[solidY + row][solidX], 255, ATLAS_CELL_SIZE);
+    }
+
+    glGenTextures(1, &atlasTexture);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, ATLAS_WIDTH, ATLAS_HEIGHT, 0, GL_ALPHA, GL_UNSIGNED_BYTE, texels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Adds a quad covering (x, y) to (x + w, y + h) on screen, textured with the cell of the given character
+// (w by h texels of it). Characters missing from the font come out as '?'.
+static void AddQuad(float x, float y, float w, float h, int character, const GLubyte* color)
+{
+    if (numQuads == HUD_MAX_QUADS)
+        return;
+    if (character >= 'a' && character <= 'z')
+        character += 'A' - 'a';
+    if (character < 0 || character > ATLAS_SOLID_CELL)
+        character = '?';
+
+    float u0 = (float)((character % ATLAS_COLUMNS) * ATLAS_CELL_SIZE) / ATLAS_WIDTH;
+    float v0 = (float)((character / ATLAS_COLUMNS) * ATLAS_CELL_SIZE) / ATLAS_HEIGHT;
+    float u1 = u0 + (w / HUD_SCALE) / ATLAS_WIDTH;
+    float v1 = v0 + (h / HUD_SCALE) / ATLAS_HEIGHT;
+    if (character == ATLAS_SOLID_CELL) {
+        // Backgrounds and bars are wider than a cell, so they take the colour of its middle.
+        u0 = u1 = u0 + (ATLAS_CELL_SIZE / 2.0f) / ATLAS_WIDTH;
+        v0 = v1 = v0 + (ATLAS_CELL_SIZE / 2.0f) / ATLAS_HEIGHT;
+    }
+
+    const float corners[4][4] = { { x, y, u0, v0 }, { x, y + h, u0, v1 }, { x + w, y + h, u1, v1 }, { x + w, y, u1, v0 } };
+    for (int i = 0; i < 4; i++) {
+        HudVertex& vertex = vertices[numQuads * 4 + i];
+        vertex.position[0] = corners[i][0];
+        vertex.position[1] = corners[i][1];
+        vertex.texCoord[0] = corners[i][2];
+        vertex.texCoord[1] = corners[i][3];
+        memcpy(vertex.color, color, 4);
+    }
+    numQuads++;
+}
+
+static void AddText(float x, float y, const char* text, const GLubyte* color)
+{
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c != ' ')
+            AddQuad(x, y, GLYPH_WIDTH * HUD_SCALE, GLYPH_HEIGHT * HUD_SCALE, (unsigned char)*c, color);
+        x += (GLYPH_WIDTH + 1) * HUD_SCALE;
+    }
+}
+
+// Returns the given percentile of the values, which are reordered.
+static double Percentile(double* values, int count, double percentile)
+{
+    int index = (int)(percentile / 100.0 * (count - 1) + 0.5);
+    std::nth_element(values, values + index, values + count);
+    return values[index];
+}
+
+// Draws the quads added since numQuads was last reset, in screen coordinates with the origin
+// in the top left corner of a window of the given size.
+static void DrawQuads(int width, int height)
+{
+    if (atlasTexture == 0)
+        CreateAtlas();
+
+    glPushAttrib(GL_ENABLE_BIT | GL_POLYGON_BIT | GL_COLOR_BUFFER_BIT | GL_TEXTURE_BIT);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(0.0, width, height, 0.0, -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(HudVertex), vertices[0].position);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(HudVertex), vertices[0].texCoord);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(HudVertex), vertices[0].color);
+    glDrawArrays(GL_QUADS, 0, numQuads * 4);
+    HudCountDrawCalls(1);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glPopClientAttrib();
+    glPopAttrib();
+}
+
+void DrawHud(int width, int height)
+{
+    // Frame time percentiles and the mean time of each phase over the recorded frames.
+    char lines[HUD_NUM_LINES][HUD_MAX_LINE_LENGTH];
+    int count = (numFrames < HUD_FRAME_HISTORY) ? numFrames : HUD_FRAME_HISTORY;
+    double sorted[HUD_FRAME_HISTORY];
+    double phaseMeans[NUM_OF_HUD_PHASES] = { 0.0, 0.0, 0.0, 0.0 };
+    for (int i = 0; i < count; i++) {
+        sorted[i] = frameTimes[i] / 1000.0;
+        for (int phase = 0; phase < NUM_OF_HUD_PHASES; phase++) {
+            phaseMeans[phase] += phaseTimes[i][phase] / 1000.0 / count;
+        }
+    }
+    if (count > 0) {
+        snprintf(lines[0], HUD_MAX_LINE_LENGTH, "FRAME MS  P50 %.2f  P90 %.2f  P99 %.2f",
+                 Percentile(sorted, count, 50.0), Percentile(sorted, count, 90.0), Percentile(sorted, count, 99.0));
+    }
+    else {
+        snprintf(lines[0], HUD_MAX_LINE_LENGTH, "FRAME MS  -");
+    }
+    snprintf(lines[1], HUD_MAX_LINE_LENGTH, "CPU MS  UPDATE %.3f  MATRIX %.3f", phaseMeans[HUD_PHASE_UPDATE], phaseMeans[HUD_PHASE_MATRICES]);
+    snprintf(lines[2], HUD_MAX_LINE_LENGTH, "        DRAW %.3f  SWAP %.3f", phaseMeans[HUD_PHASE_DRAW], phaseMeans[HUD_PHASE_SWAP]);
+
+    // Moves in the last second, or over the recorded moves if there were more than that.
+    double now = HudNow();
+    int recentMoves = 0;
+    double oldest = now;
+    for (int i = 0; i < numMoves && i < HUD_MOVE_HISTORY; i++) {
+        double time = moveTimes[(numMoves - 1 - i) % HUD_MOVE_HISTORY];
+        if (now - time > 1000000.0)
+            break;
+        recentMoves++;
+        oldest = time;
+    }
+    double movesPerSecond = (recentMoves == HUD_MOVE_HISTORY) ? recentMoves / ((now - oldest) / 1000000.0) : recentMoves;
+    int lastDrawCalls = (numFrames > 0) ? drawCalls[(numFrames - 1) % HUD_FRAME_HISTORY] : 0;
+    snprintf(lines[3], HUD_MAX_LINE_LENGTH, "DRAW CALLS %d  MOVES/S %.1f", lastDrawCalls, movesPerSecond);
+
+    // Key press to swap, for moves.
+    if (LatencyPercentile(LATENCY_MOVE, 50.0) >= 0.0) {
+        snprintf(lines[4], HUD_MAX_LINE_LENGTH, "INPUT MS  P50 %.1f  P99 %.1f", LatencyPercentile(LATENCY_MOVE, 50.0), LatencyPercentile(LATENCY_MOVE, 99.0));
+    }
+    else {
+        snprintf(lines[4], HUD_MAX_LINE_LENGTH, "INPUT MS  -");
+    }
+
+    // A translucent background, then the text, all in one array of quads.
+    const GLubyte backgroundColor[4] = { 0, 0, 0, 160 };
+    const GLubyte textColor[4] = { 255, 255, 255, 255 };
+    const float lineHeight = GLYPH_HEIGHT * HUD_SCALE + HUD_LINE_SPACING;
+    size_t longest = 0;
+    for (int i = 0; i < HUD_NUM_LINES; i++) {
+        longest = std::max(longest, strlen(lines[i]));
+    }
+    numQuads = 0;
+    AddQuad(HUD_MARGIN, HUD_MARGIN, longest * (GLYPH_WIDTH + 1) * HUD_SCALE + 2 * HUD_LINE_SPACING, HUD_NUM_LINES * lineHeight + HUD_LINE_SPACING, ATLAS_SOLID_CELL, backgroundColor);
+    for (int i = 0; i < HUD_NUM_LINES; i++) {
+        AddText(HUD_MARGIN + HUD_LINE_SPACING, HUD_MARGIN + HUD_LINE_SPACING + i * lineHeight, lines[i], textColor);
+    }
+
+    DrawQuads(width, height);
+}
+
+void DrawStatusText(int width, int height, const char* text)
+{
+    const GLubyte backgroundColor[4] = { 0, 0, 0, 160 };
+    const GLubyte textColor[4] = { 255, 255, 255, 255 };
+    float textWidth = strlen(text) * (GLYPH_WIDTH + 1) * HUD_SCALE;
+    float x = width - HUD_MARGIN - textWidth - 2 * HUD_LINE_SPACING;
+
+    numQuads = 0;
+    AddQuad(x, HUD_MARGIN, textWidth + 2 * HUD_LINE_SPACING, GLYPH_HEIGHT * HUD_SCALE + 2 * HUD_LINE_SPACING, ATLAS_SOLID_CELL, backgroundColor);
+    AddText(x + HUD_LINE_SPACING, HUD_MARGIN + HUD_LINE_SPACING, text, textColor);
+    DrawQuads(width, height);
+}
+
+// The area of the scrub bar's track in a window of the given size.
+static void GetScrubBarTrack(int width, int height, float* x, float* y, float* w, float* h)
+{
+    *x = HUD_MARGIN + SCRUB_BAR_LABEL_WIDTH;
+    *y = height - HUD_MARGIN - SCRUB_BAR_HEIGHT;
+    *w = width - 2 * HUD_MARGIN - SCRUB_BAR_LABEL_WIDTH;
+    *h = SCRUB_BAR_HEIGHT;
+}
+
+void DrawScrubBar(int width, int height, double position, const char* label)
+{
+    const GLubyte backgroundColor[4] = { 0, 0, 0, 160 };
+    const GLubyte trackColor[4] = { 255, 255, 255, 64 };
+    const GLubyte playedColor[4] = { 255, 255, 255, 255 };
+    float x, y, w, h;
+    GetScrubBarTrack(width, height, &x, &y, &w, &h);
+    position = std::clamp(position, 0.0, 1.0);
+
+    numQuads = 0;
+    AddQuad(HUD_MARGIN, y - HUD_LINE_SPACING, width - 2 * HUD_MARGIN, h + 2 * HUD_LINE_SPACING, ATLAS_SOLID_CELL, backgroundColor);
+    AddText(HUD_MARGIN + HUD_LINE_SPACING, y + (h - GLYPH_HEIGHT * HUD_SCALE) / 2, label, playedColor);
+    AddQuad(x, y + h / 2 - HUD_SCALE, w, 2 * HUD_SCALE, ATLAS_SOLID_CELL, trackColor);
+    AddQuad(x, y + h / 2 - HUD_SCALE, (float)(w * position), 2 * HUD_SCALE, ATLAS_SOLID_CELL, playedColor);
+    AddQuad((float)(x + w * position) - HUD_SCALE * 2, y, HUD_SCALE * 4, h, ATLAS_SOLID_CELL, playedColor);
+    DrawQuads(width, height);
+}
+
+bool ScrubBarHit(int width, int height, int mouseX, int mouseY, double* position)
+{
+    float x, y, w, h;
+    GetScrubBarTrack(width, height, &x, &y, &w, &h);
+    if (mouseY < y - HUD_LINE_SPACING || mouseY > y + h + HUD_LINE_SPACING || mouseX < x - HUD_LINE_SPACING || mouseX > x + w + HUD_LINE_SPACING)
+        return false;
+    *position = std::clamp((mouseX - x) / w, 0.0f, 1.0f);
+    return true;
+}
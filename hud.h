@@ -0,0 +1,51 @@
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////
+// PERFORMANCE HUD
+//
+// Collects frame timings and draws them over the scene, along with the
+// scrub bar of a replayed session and a line of status. Text comes from a glyph atlas baked into
+// a texture once, and each overlay is a single batched draw call.
+/////////////////////////////////////////////////////////////////////////////
+
+#define HUD_PHASE_UPDATE        0      // Applying moves to the cube's state.
+#define HUD_PHASE_MATRICES      1      // Building the camera and sticker transforms and vertices.
+#define HUD_PHASE_DRAW          2      // Issuing draw calls.
+#define HUD_PHASE_SWAP          3      // Swapping the buffers.
+#define NUM_OF_HUD_PHASES       4
+
+#define HUD_FRAME_HISTORY       256    // Number of frames the statistics are taken over.
+#define HUD_MOVE_HISTORY        256    // Number of moves the move rate is taken over.
+
+// Current time in microseconds, for timing phases.
+double HudNow();
+
+// Marks the start and end of a rendered frame.
+void HudBeginFrame();
+void HudEndFrame();
+
+// Adds time spent in a HUD_PHASE_ to the current frame. Time spent outside a frame
+// (e.g. updating the state from a timer) is counted towards the next frame.
+void HudAddPhaseTime(int phase, double microseconds);
+
+// Counts draw calls made in the current frame.
+void HudCountDrawCalls(int count);
+
+// Counts a move applied to the cube.
+void HudCountMove();
+
+// Draws the HUD in the top left corner of a window of the given size.
+// Must be called with the OpenGL context current.
+void DrawHud(int width, int height);
+
+// Draws a line of text in the top right corner of a window of the given size. Must be called
+// with the OpenGL context current.
+void DrawStatusText(int width, int height, const char* text);
+
+// Draws a scrub bar along the bottom of a window of the given size, with the handle at
+// position (0 to 1) and the label to its left. Must be called with the OpenGL context current.
+void DrawScrubBar(int width, int height, double position, const char* label);
+
+// If the window coordinates are on the scrub bar, sets position (0 to 1) to the point of the
+// track under them and returns true.
+bool ScrubBarHit(int width, int height, int x, int y, double* position);
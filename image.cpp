@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "image.h"
+
+#define PNG_MAX_STORED_BLOCK    65535   // Largest payload of an uncompressed deflate block.
+
+/////////////////////////////////////////////////////////////////////////////
+// PPM
+/////////////////////////////////////////////////////////////////////////////
+
+bool WritePPM(const char* filename, const unsigned char* pixels, int width, int height)
+{
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL)
+        return false;
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    for (int row = height - 1; row >= 0; row--) {
+        fwrite(pixels + (size_t)row * width * 3, 1, (size_t)width * 3, file);
+    }
+
+    bool ok = !ferror(file);
+    return (fclose(file) == 0) && ok;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// PNG
+/////////////////////////////////////////////////////////////////////////////
+
+// Output for a single PNG chunk, keeping its running CRC.
+struct PngChunkWriter {
+    FILE* file;
+    unsigned int crc;
+};
+
+// An uncompressed zlib stream written into a PNG chunk.
+struct StoredDeflateWriter {
+    PngChunkWriter* chunk;
+    size_t totalLeft;       // Bytes still to be written to the stream.
+    size_t blockLeft;       // Bytes still to be written to the current block.
+    unsigned int adlerA;
+    unsigned int adlerB;
+};
+
+// The CRC-32 of every byte. Built once, however many encoder threads ask for it first.
+struct CrcTable {
+    unsigned int values[256];
+
+    CrcTable();
+};
+
+CrcTable::CrcTable()
+{
+    for (unsigned int n = 0; n < 256; n++) {
+        unsigned int c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        values[n] = c;
+    }
+}
+
+static const unsigned int* GetCrcTable()
+{
+    static const CrcTable table;
+    return table.values;
+}
+
+static void WriteBigEndian(FILE* file, unsigned int value)
+{
+    unsigned char bytes[4] = { (unsigned char)(value >> 24), (unsigned char)(value >> 16), (unsigned char)(value >> 8), (unsigned char)value };
+    fwrite(bytes, 1, 4, file);
+}
+
+static void ChunkWrite(PngChunkWriter* chunk, const unsigned char* data, size_t length)
+{
+    const unsigned int* crcTable = GetCrcTable();
+    unsigned int c = chunk->crc;
+    for (size_t i = 0; i < length; i++) {
+        c = crcTable[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    }
+    chunk->crc = c;
+    fwrite(data, 1, length, chunk->file);
+}
+
+static void ChunkWriteBigEndian(PngChunkWriter* chunk, unsigned int value)
+{
+    unsigned char bytes[4] = { (unsigned char)(value >> 24), (unsigned char)(value >> 16), (unsigned char)(value >> 8), (unsigned char)value };
+    ChunkWrite(chunk, bytes, 4);
+}
+
+static void BeginChunk(PngChunkWriter* chunk, FILE* file, const char* type, unsigned int length)
+{
+    chunk->file = file;
+    chunk->crc = 0xFFFFFFFFu;
+    WriteBigEndian(file, length);
+    ChunkWrite(chunk, (const unsigned char*)type, 4);
+}
+
+static void EndChunk(PngChunkWriter* chunk)
+{
+    WriteBigEndian(chunk->file, chunk->crc ^ 0xFFFFFFFFu);
+}
+
+// Number of bytes a zlib stream of stored blocks takes for the given amount of data.
+static size_t StoredDeflateLength(size_t length)
+{
+    size_t numBlocks = (length + PNG_MAX_STORED_BLOCK - 1) / PNG_MAX_STORED_BLOCK;
+    return 2 + numBlocks * 5 + length + 4;
+}
+
+static void BeginStoredDeflate(StoredDeflateWriter* deflate, PngChunkWriter* chunk, size_t length)
+{
+    const unsigned char zlibHeader[2] = { 0x78, 0x01 };
+    ChunkWrite(chunk, zlibHeader, 2);
+    deflate->chunk = chunk;
+    deflate->totalLeft = length;
+    deflate->blockLeft = 0;
+    deflate->adlerA = 1;
+    deflate->adlerB = 0;
+}
+
+static void StoredDeflateWrite(StoredDeflateWriter* deflate, const unsigned char* data, size_t length)
+{
+    while (length > 0) {
+        if (deflate->blockLeft == 0) {
+            size_t blockLength = (deflate->totalLeft > PNG_MAX_STORED_BLOCK) ? PNG_MAX_STORED_BLOCK : deflate->totalLeft;
+            unsigned char blockHeader[5];
+            blockHeader[0] = (blockLength == deflate->totalLeft) ? 1 : 0;   // Last block flag.
+            blockHeader[1] = (unsigned char)(blockLength & 0xFF);
+            blockHeader[2] = (unsigned char)(blockLength >> 8);
+            blockHeader[3] = (unsigned char)(~blockLength & 0xFF);
+            blockHeader[4] = (unsigned char)((~blockLength >> 8) & 0xFF);
+            ChunkWrite(deflate->chunk, blockHeader, 5);
+            deflate->blockLeft = blockLength;
+        }
+
+        size_t n = (length < deflate->blockLeft) ? length : deflate->blockLeft;
+        ChunkWrite(deflate->chunk, data, n);
+        for (size_t i = 0; i < n; i++) {
+            deflate->adlerA = (deflate->adlerA + data[i]) % 65521;
+            deflate->adlerB = (deflate->adlerB + deflate->adlerA) % 65521;
+        }
+        data += n;
+        length -= n;
+        deflate->blockLeft -= n;
+        deflate->totalLeft -= n;
+    }
+}
+
+static void EndStoredDeflate(StoredDeflateWriter* deflate)
+{
+    ChunkWriteBigEndian(deflate->chunk, (deflate->adlerB << 16) | deflate->adlerA);
+}
+
+bool WritePNG(const char* filename, const unsigned char* pixels, int width, int height)
+{
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL)
+        return false;
+
+    const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+    fwrite(signature, 1, 8, file);
+
+    PngChunkWriter chunk;
+    BeginChunk(&chunk, file, "IHDR", 13);
+    ChunkWriteBigEndian(&chunk, width);
+    ChunkWriteBigEndian(&chunk, height);
+    const unsigned char header[5] = { 8, 2, 0, 0, 0 };    // 8-bit RGB, deflate, no filtering, no interlace.
+    ChunkWrite(&chunk, header, 5);
+    EndChunk(&chunk);
+
+    // Every row is a filter type byte (0, none) followed by its pixels.
+    size_t rawLength = (1 + (size_t)width * 3) * height;
+    BeginChunk(&chunk, file, "IDAT", (unsigned int)StoredDeflateLength(rawLength));
+    StoredDeflateWriter deflate;
+    BeginStoredDeflate(&deflate, &chunk, rawLength);
+    for (int row = height - 1; row >= 0; row--) {
+        const unsigned char filterType = 0;
+        StoredDeflateWrite(&deflate, &filterType, 1);
+        StoredDeflateWrite(&deflate, pixels + (size_t)row * width * 3, (size_t)width * 3);
+    }
+    EndStoredDeflate(&deflate);
+    EndChunk(&chunk);
+
+    BeginChunk(&chunk, file, "IEND", 0);
+    EndChunk(&chunk);
+
+    bool ok = !ferror(file);
+    return (fclose(file) == 0) && ok;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// FORMAT SELECTION
+/////////////////////////////////////////////////////////////////////////////
+
+bool WriteImage(const char* filename, int format, const unsigned char* pixels, int width, int height)
+{
+    if (format == IMAGE_FORMAT_PNG)
+        return WritePNG(filename, pixels, width, height);
+    return WritePPM(filename, pixels, width, height);
+}
+
+const char* ImageFormatExtension(int format)
+{
+    return (format == IMAGE_FORMAT_PNG) ? "png" : "ppm";
+}
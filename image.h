@@ -0,0 +1,23 @@
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////
+// IMAGE FILES
+//
+// Writers for 8-bit RGB images. Pixels are expected bottom row first, the
+// way glReadPixels returns them, and are flipped while writing.
+/////////////////////////////////////////////////////////////////////////////
+
+#define IMAGE_FORMAT_PPM        0      // Binary portable pixmap (P6).
+#define IMAGE_FORMAT_PNG        1      // PNG with uncompressed (stored) deflate blocks.
+
+// Writes a binary PPM file. Returns false if the file could not be written.
+bool WritePPM(const char* filename, const unsigned char* pixels, int width, int height);
+
+// Writes a PNG file. Returns false if the file could not be written.
+bool WritePNG(const char* filename, const unsigned char* pixels, int width, int height);
+
+// Writes an image in the given IMAGE_FORMAT_.
+bool WriteImage(const char* filename, int format, const unsigned char* pixels, int width, int height);
+
+// The file extension (without the dot) for an IMAGE_FORMAT_.
+const char* ImageFormatExtension(int format);
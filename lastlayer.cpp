@@ -0,0 +1,124 @@
+#include "lastlayer.h"
+
+// The stickers of the signature, as face * NUM_OF_SQUARES + square.
+static const int lastLayerStickers[LAST_LAYER_STICKERS] = {
+    FACE_UP * NUM_OF_SQUARES + 0, FACE_UP * NUM_OF_SQUARES + 1, FACE_UP * NUM_OF_SQUARES + 2, FACE_UP * NUM_OF_SQUARES + 3,
+    FACE_UP * NUM_OF_SQUARES + 5, FACE_UP * NUM_OF_SQUARES + 6, FACE_UP * NUM_OF_SQUARES + 7, FACE_UP * NUM_OF_SQUARES + 8,
+    FACE_FRONT * NUM_OF_SQUARES + 0, FACE_FRONT * NUM_OF_SQUARES + 1, FACE_FRONT * NUM_OF_SQUARES + 2,
+    FACE_LEFT * NUM_OF_SQUARES + 0, FACE_LEFT * NUM_OF_SQUARES + 1, FACE_LEFT * NUM_OF_SQUARES + 2,
+    FACE_BACK * NUM_OF_SQUARES + 0, FACE_BACK * NUM_OF_SQUARES + 1, FACE_BACK * NUM_OF_SQUARES + 2,
+    FACE_RIGHT * NUM_OF_SQUARES + 0, FACE_RIGHT * NUM_OF_SQUARES + 1, FACE_RIGHT * NUM_OF_SQUARES + 2
+};
+
+// The sides in the order U turns them: a clockwise U takes the front row to the left.
+static const int sideFaces[4] = { FACE_FRONT, FACE_LEFT, FACE_BACK, FACE_RIGHT };
+
+#define SIGNATURE_U_COLOUR      4
+#define SIGNATURE_D_COLOUR      5
+
+// Where each sticker of the signature is after 0 to 3 clockwise U turns, found by turning a cube
+// whose stickers are numbered.
+struct LastLayerTurns {
+    int stickers[4][LAST_LAYER_STICKERS];
+
+    LastLayerTurns()
+    {
+        Cube numbered;
+        InitCube(numbered);
+        int* numbers = &numbered.stickers[0][0];
+        for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+            numbers[sticker] = sticker;
+        }
+        Move turn = { TURN_U, CLOCKWISE, 0.0 };
+        for (int turns = 0; turns < 4; turns++) {
+            for (int i = 0; i < LAST_LAYER_STICKERS; i++) {
+                stickers[turns][i] = numbers[lastLayerStickers[i]];
+            }
+            ApplyMove(numbered, turn);
+        }
+    }
+};
+
+// What each colour counts as: the U colour, the D colour or the side it belongs on.
+static void ColourValues(const Cube& cube, int values[GREY + 1])
+{
+    for (int colour = 0; colour <= GREY; colour++) {
+        values[colour] = SIGNATURE_D_COLOUR;
+    }
+    for (int side = 0; side < 4; side++) {
+        values[cube.stickers[sideFaces[side]][4]] = side;
+    }
+    values[cube.stickers[FACE_UP][4]] = SIGNATURE_U_COLOUR;
+}
+
+// The signature of the stickers at the given places.
+static uint64_t Signature(const Cube& cube, const int values[GREY + 1], const int* places, int set)
+{
+    // Side colours count from the side they are on, then from the first of them, so turning the
+    // whole layer after the algorithm (which moves every side colour round by the same amount)
+    // gives the same signature.
+    const int* stickers = &cube.stickers[0][0];
+    uint64_t signature = 0;
+    int first = -1;
+    for (int i = 0; i < LAST_LAYER_STICKERS; i++) {
+        int value = values[stickers[places[i]]];
+        if (set == LAST_LAYER_OLL)
+            value = (value == SIGNATURE_U_COLOUR) ? SIGNATURE_U_COLOUR : 0;
+        else if (value < 4) {
+            int side = (i < 8) ? 0 : (i - 8) / 3;
+            value = (value - side) & 3;
+            if (first < 0)
+                first = value;
+            value = (value - first) & 3;
+        }
+        signature |= (uint64_t)value << (3 * i);
+    }
+    return signature;
+}
+
+uint64_t LastLayerSignature(const Cube& cube, int set)
+{
+    int values[GREY + 1];
+    ColourValues(cube, values);
+    return Signature(cube, values, lastLayerStickers, set);
+}
+
+uint64_t LastLayerKey(const Cube& cube, int set, int* turns)
+{
+    // Rather than turning a copy of the cube, read the stickers from where the turns would take them.
+    static const LastLayerTurns lastLayerTurns;
+    int values[GREY + 1];
+    ColourValues(cube, values);
+    uint64_t key = Signature(cube, values, lastLayerTurns.stickers[0], set);
+    *turns = 0;
+    for (int i = 1; i < 4; i++) {
+        uint64_t signature = Signature(cube, values, lastLayerTurns.stickers[i], set);
+        if (signature < key) {
+            key = signature;
+            *turns = i;
+        }
+    }
+    return key;
+}
+
+int LastLayerSlot(uint64_t key, int bits)
+{
+    return (int)((key * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+}
+
+int RecogniseLastLayer(const Cube& cube, int set, int* preTurns)
+{
+    const LastLayerTable& table = lastLayerTables[set];
+    int turns;
+    uint64_t key = LastLayerKey(cube, set, &turns);
+    int mask = (1 << table.bits) - 1;
+    for (int slot = LastLayerSlot(key, table.bits);; slot = (slot + 1) & mask) {
+        const LastLayerEntry& entry = table.entries[slot];
+        if (entry.signature == 0)
+            return -1;
+        if (entry.signature == key) {
+            *preTurns = (turns - entry.turns + 4) % 4;
+            return entry.caseIndex;
+        }
+    }
+}
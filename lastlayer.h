@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// LAST LAYER RECOGNITION
+//
+// Which OLL, PLL or ZBLL case the last layer of a cube is in, once the
+// first two layers are solved. The 20 stickers of the U layer make a
+// signature, with the side colours counted relative to each other so a
+// case looks the same whichever way the layer needs turning after its
+// algorithm. Of the four ways the layer could be turned before it, the
+// smallest signature is the key, so finding a case is one probe of a hash
+// table.
+//
+// The tables are in lastlayer_tables.cpp, which is generated from the
+// algorithm lists in algorithms/ by tools/generate_lastlayer.cpp:
+//
+//   g++ -std=c++20 -O2 -I. tools/generate_lastlayer.cpp cube.cpp lastlayer.cpp pattern.cpp -o generate_lastlayer
+//   ./generate_lastlayer algorithms lastlayer_tables.cpp
+//
+// ZBLL has no list of its own: each case is solved by an OLL algorithm
+// that keeps the edges oriented, then a PLL.
+/////////////////////////////////////////////////////////////////////////////
+
+#define LAST_LAYER_OLL          0      // Orienting the last layer; only which stickers are the U colour counts.
+#define LAST_LAYER_PLL          1      // Permuting the oriented last layer.
+#define LAST_LAYER_ZBLL         2      // Solving a last layer whose edges are oriented.
+#define NUM_OF_LAST_LAYER_SETS  3
+
+#define LAST_LAYER_STICKERS     20     // The U face around its centre, then the top row of F, L, B and R.
+
+struct LastLayerCase {
+    const char* name;
+    const char* algorithm;      // In standard notation, starting with the cube held the usual way.
+};
+
+// A slot of a table. Signatures are never 0, so an empty slot has signature 0.
+struct LastLayerEntry {
+    uint64_t signature;
+    unsigned short caseIndex;
+    unsigned char turns;        // Clockwise U turns that gave the case's algorithm this signature.
+};
+
+struct LastLayerTable {
+    const LastLayerEntry* entries;      // Open addressing, 1 << bits of them.
+    int bits;
+    const LastLayerCase* cases;
+    int numCases;
+};
+
+extern const LastLayerTable lastLayerTables[NUM_OF_LAST_LAYER_SETS];
+
+// The signature of the last layer as it is, for a LAST_LAYER_ set. Colours are told apart by the centres.
+uint64_t LastLayerSignature(const Cube& cube, int set);
+
+// The smallest signature of the last layer turned 0 to 3 times clockwise, and the turns that gave it.
+uint64_t LastLayerKey(const Cube& cube, int set, int* turns);
+
+// The slot of a table for a key, as used by the generator: the first of its probe sequence.
+int LastLayerSlot(uint64_t key, int bits);
+
+// The case of a LAST_LAYER_ set the last layer is in, or -1 if there isn't one (e.g. the first two
+// layers aren't solved). Sets preTurns to the clockwise U turns to make before its algorithm; the
+// layer may still need turning after it.
+int RecogniseLastLayer(const Cube& cube, int set, int* preTurns);
@@ -0,0 +1,1817 @@
+// Generated by tools/generate_lastlayer.cpp from the lists in algorithms/. Don't edit.
+
+#include "lastlayer.h"
+
+static const LastLayerCase ollCases[58] = {
+    { "OLL skip", "" },
+    { "OLL 1", "R U2 R2 F R F' U2 R' F R F'" },
+    { "OLL 2", "F R U R' U' F' f R U R' U' f'" },
+    { "OLL 3", "f R U R' U' f' U' F R U R' U' F'" },
+    { "OLL 4", "f R U R' U' f' U F R U R' U' F'" },
+    { "OLL 5", "r' U2 R U R' U r" },
+    { "OLL 6", "r U2 R' U' R U' r'" },
+    { "OLL 7", "r U R' U R U2 r'" },
+    { "OLL 8", "r' U' R U' R' U2 r" },
+    { "OLL 9", "R U R' U' R' F R2 U R' U' F'" },
+    { "OLL 10", "R U R' U R' F R F' R U2 R'" },
+    { "OLL 11", "r U R' U R' F R F' R U2 r'" },
+    { "OLL 12", "M' R' U' R U' R' U2 R U' R r'" },
+    { "OLL 13", "F U R U' R2 F' R U R U' R'" },
+    { "OLL 14", "R' F R U R' F' R F U' F'" },
+    { "OLL 15", "r' U' r R' U' R U r' U r" },
+    { "OLL 16", "r U r' R U R' U' r U' r'" },
+    { "OLL 17", "R U R' U R' F R F' U2 R' F R F'" },
+    { "OLL 18", "r U R' U R U2 r2 U' R U' R' U2 r" },
+    { "OLL 19", "r' R U R U R' U' M' R' F R F'" },
+    { "OLL 20", "r U R' U' M2 U R U' R' U' M'" },
+    { "OLL 21", "R U2 R' U' R U R' U' R U' R'" },
+    { "OLL 22", "R U2 R2 U' R2 U' R2 U2 R" },
+    { "OLL 23", "R2 D' R U2 R' D R U2 R" },
+    { "OLL 24", "r U R' U' r' F R F'" },
+    { "OLL 25", "F' r U R' U' r' F R" },
+    { "OLL 26", "R U2 R' U' R U' R'" },
+    { "OLL 27", "R U R' U R U2 R'" },
+    { "OLL 28", "r U R' U' M U R U' R'" },
+    { "OLL 29", "R U R' U' R U' R' F' U' F R U R'" },
+    { "OLL 30", "F R' F R2 U' R' U' R U R' F2" },
+    { "OLL 31", "R' U' F U R U' R' F' R" },
+    { "OLL 32", "L U F' U' L' U L F L'" },
+    { "OLL 33", "R U R' U' R' F R F'" },
+    { "OLL 34", "R U R2 U' R' F R U R U' F'" },
+    { "OLL 35", "R U2 R2 F R F' R U2 R'" },
+    { "OLL 36", "L' U' L U' L' U L U L F' L' F" },
+    { "OLL 37", "F R' F' R U R U' R'" },
+    { "OLL 38", "R U R' U R U' R' U' R' F R F'" },
+    { "OLL 39", "L F' L' U' L U F U' L'" },
+    { "OLL 40", "R' F R U R' U' F' U R" },
+    { "OLL 41", "R U R' U R U2 R' F R U R' U' F'" },
+    { "OLL 42", "R' U' R U' R' U2 R F R U R' U' F'" },
+    { "OLL 43", "F' U' L' U L F" },
+    { "OLL 44", "F U R U' R' F'" },
+    { "OLL 45", "F R U R' U' F'" },
+    { "OLL 46", "R' U' R' F R F' U R" },
+    { "OLL 47", "R' U' R' F R F' R' F R F' U R" },
+    { "OLL 48", "F R U R' U' R U R' U' F'" },
+    { "OLL 49", "r U' r2 U r2 U r2 U' r" },
+    { "OLL 50", "r' U r2 U' r2 U' r2 U r'" },
+    { "OLL 51", "F U R U' R' U R U' R' F'" },
+    { "OLL 52", "R U R' U R U' B U' B' R'" },
+    { "OLL 53", "l' U2 L U L' U' L U L' U l" },
+    { "OLL 54", "r U2 R' U' R U R' U' R U' r'" },
+    { "OLL 55", "R' F R U R U' R2 F' R2 U' R' U R U R'" },
+    { "OLL 56", "r' U' r U' R' U R U' R' U R r' U r" },
+    { "OLL 57", "R U R' U' M' U R U' r'" },
+};
+
+static const LastLayerEntry ollEntries[128] = {
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0104020120000920ULL, 11, 0 },
+    { 0x0004900124004800ULL, 55, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0100924920000000ULL, 2, 0 },
+    { 0x0000104824804020ULL, 8, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0004104020824020ULL, 42, 2 },
+    { 0x0000000104104924ULL, 23, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000800124004904ULL, 46, 1 },
+    { 0x0000904100124004ULL, 29, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000004020824124ULL, 28, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000804900124100ULL, 38, 2 },
+    { 0x0020104024004024ULL, 12, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0004020100104920ULL, 27, 2 },
+    { 0x0000104120024024ULL, 30, 1 },
+    { 0x0000124020804024ULL, 36, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000924900104000ULL, 50, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0004820120004900ULL, 13, 2 },
+    { 0x0024004020024120ULL, 35, 3 },
+    { 0x0104104104100020ULL, 56, 1 },
+    { 0x0000024820804120ULL, 43, 0 },
+    { 0x0000004920024120ULL, 37, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0104904124000000ULL, 1, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0024124020004020ULL, 48, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000124920004020ULL, 49, 0 },
+    { 0x0000100804904820ULL, 26, 1 },
+    { 0x0100920900100800ULL, 47, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0100804124000104ULL, 18, 0 },
+    { 0x0000900824804800ULL, 14, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0004804004904100ULL, 32, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000924924ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0104024100100120ULL, 15, 3 },
+    { 0x0004904104104000ULL, 54, 2 },
+    { 0x0000800020824904ULL, 57, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0104824120000100ULL, 3, 3 },
+    { 0x0000100100124824ULL, 24, 2 },
+    { 0x0004004024804120ULL, 31, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000900120024804ULL, 33, 2 },
+    { 0x0000920020804804ULL, 40, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000900124920ULL, 25, 0 },
+    { 0x0020800824004900ULL, 16, 0 },
+    { 0x0000804104104104ULL, 41, 2 },
+    { 0x0004104124004020ULL, 53, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000820820804900ULL, 45, 0 },
+    { 0x0000800920024900ULL, 39, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000120900104820ULL, 22, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0024920020004800ULL, 52, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0100904824800000ULL, 4, 1 },
+    { 0x0000004124004124ULL, 44, 1 },
+    { 0x0000920920004800ULL, 51, 2 },
+    { 0x0020104820024020ULL, 9, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0004824100104100ULL, 7, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0020820020004904ULL, 34, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0100804020820104ULL, 20, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0004024120004120ULL, 5, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0104820100100900ULL, 10, 0 },
+    { 0x0100904120020004ULL, 19, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000904804904000ULL, 6, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0100804920020100ULL, 17, 3 },
+    { 0x0004100104104820ULL, 21, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+};
+
+static const LastLayerCase pllCases[22] = {
+    { "PLL skip", "" },
+    { "Aa", "x R' U R' D2 R U' R' D2 R2 x'" },
+    { "Ab", "x R2 D2 R U R' D2 R U' R x'" },
+    { "E", "x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "F", "R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "Ga", "R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "Gb", "R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "Gc", "R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "Gd", "R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "H", "M2 U M2 U2 M2 U M2" },
+    { "Ja", "R' U L' U2 R U' R' U2 R L U'" },
+    { "Jb", "R U R' F' R U R' U' R' F R2 U' R'" },
+    { "Na", "R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "Nb", "R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "Ra", "R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "Rb", "R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "T", "R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "Ua", "M2 U M U2 M' U M2" },
+    { "Ub", "M2 U' M U2 M' U' M2" },
+    { "V", "R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "Y", "F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "Z", "M' U M2 U M2 U M' U2 M2" },
+};
+
+static const LastLayerEntry pllEntries[64] = {
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0052201488924924ULL, 3, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0291043298924924ULL, 7, 1 },
+    { 0x0291241280924924ULL, 10, 2 },
+    { 0x0251641298924924ULL, 16, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0012400490924924ULL, 12, 0 },
+    { 0x0211441288924924ULL, 14, 1 },
+    { 0x0211643290924924ULL, 6, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02180430c8924924ULL, 15, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000924924ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02984410d8924924ULL, 5, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0012003488924924ULL, 19, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02582410c8924924ULL, 2, 2 },
+    { 0x0080402010924924ULL, 9, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02d1642280924924ULL, 8, 1 },
+    { 0x0251240290924924ULL, 11, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02184400d0924924ULL, 4, 0 },
+    { 0x0211040280924924ULL, 1, 0 },
+    { 0x0040601018924924ULL, 21, 1 },
+    { 0x0012601480924924ULL, 20, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000401008924924ULL, 18, 1 },
+    { 0x0000603010924924ULL, 17, 1 },
+    { 0x0092002480924924ULL, 13, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+};
+
+static const LastLayerCase zbllCases[494] = {
+    { "ZBLL 1", "" },
+    { "ZBLL 2", "x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 3", "x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 4", "x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 5", "R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 6", "R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 7", "R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 8", "R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 9", "R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 10", "M2 U M2 U2 M2 U M2" },
+    { "ZBLL 11", "R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 12", "R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 13", "R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "ZBLL 14", "R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 15", "R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 16", "R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 17", "R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 18", "M2 U M U2 M' U M2" },
+    { "ZBLL 19", "M2 U' M U2 M' U' M2" },
+    { "ZBLL 20", "R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 21", "F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 22", "M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 23", "R U2 R' U' R U R' U' R U' R'" },
+    { "ZBLL 24", "R U2 R' U' R U R' U' R U' R' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 25", "R U2 R' U' R U R' U' R U' R' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 26", "R U2 R' U' R U R' U' R U' R' x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 27", "R U2 R' U' R U R' U' R U' R' U' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 28", "R U2 R' U' R U R' U' R U' R' U2 R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 29", "R U2 R' U' R U R' U' R U' R' U R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 30", "R U2 R' U' R U R' U' R U' R' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 31", "R U2 R' U' R U R' U' R U' R' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 32", "R U2 R' U' R U R' U' R U' R' M2 U M2 U2 M2 U M2" },
+    { "ZBLL 33", "R U2 R' U' R U R' U' R U' R' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 34", "R U2 R' U' R U R' U' R U' R' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 35", "R U2 R' U' R U R' U' R U' R' R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 36", "R U2 R' U' R U R' U' R U' R' U2 R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 37", "R U2 R' U' R U R' U' R U' R' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 38", "R U2 R' U' R U R' U' R U' R' M2 U M U2 M' U M2" },
+    { "ZBLL 39", "R U2 R' U' R U R' U' R U' R' M2 U' M U2 M' U' M2" },
+    { "ZBLL 40", "R U2 R' U' R U R' U' R U' R' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 41", "R U2 R' U' R U R' U' R U' R' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 42", "R U2 R' U' R U R' U' R U' R' U x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 43", "R U2 R' U' R U R' U' R U' R' U x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 44", "R U2 R' U' R U R' U' R U' R' U R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 45", "R U2 R' U' R U R' U' R U' R' U R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 46", "R U2 R' U' R U R' U' R U' R' U R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 47", "R U2 R' U' R U R' U' R U' R' U' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 48", "R U2 R' U' R U R' U' R U' R' U R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 49", "R U2 R' U' R U R' U' R U' R' U R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 50", "R U2 R' U' R U R' U' R U' R' U2 R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 51", "R U2 R' U' R U R' U' R U' R' U M2 U M U2 M' U M2" },
+    { "ZBLL 52", "R U2 R' U' R U R' U' R U' R' U R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 53", "R U2 R' U' R U R' U' R U' R' U2 x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 54", "R U2 R' U' R U R' U' R U' R' U2 x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 55", "R U2 R' U' R U R' U' R U' R' U' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 56", "R U2 R' U' R U R' U' R U' R' U2 M2 U M U2 M' U M2" },
+    { "ZBLL 57", "R U2 R' U' R U R' U' R U' R' U2 M2 U' M U2 M' U' M2" },
+    { "ZBLL 58", "R U2 R' U' R U R' U' R U' R' U2 R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 59", "R U2 R' U' R U R' U' R U' R' U2 F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 60", "R U2 R' U' R U R' U' R U' R' U' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 61", "R U2 R' U' R U R' U' R U' R' U' M2 U M U2 M' U M2" },
+    { "ZBLL 62", "R U2 R' U' R U R' U' R U' R' U' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 63", "R U2 R2 U' R2 U' R2 U2 R" },
+    { "ZBLL 64", "R U2 R2 U' R2 U' R2 U2 R x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 65", "R U2 R2 U' R2 U' R2 U2 R x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 66", "R U2 R2 U' R2 U' R2 U2 R x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 67", "R U2 R2 U' R2 U' R2 U2 R R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 68", "R U2 R2 U' R2 U' R2 U2 R R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 69", "R U2 R2 U' R2 U' R2 U2 R R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 70", "R U2 R2 U' R2 U' R2 U2 R R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 71", "R U2 R2 U' R2 U' R2 U2 R R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 72", "R U2 R2 U' R2 U' R2 U2 R M2 U M2 U2 M2 U M2" },
+    { "ZBLL 73", "R U2 R2 U' R2 U' R2 U2 R R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 74", "R U2 R2 U' R2 U' R2 U2 R R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 75", "R U2 R2 U' R2 U' R2 U2 R R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "ZBLL 76", "R U2 R2 U' R2 U' R2 U2 R R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 77", "R U2 R2 U' R2 U' R2 U2 R R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 78", "R U2 R2 U' R2 U' R2 U2 R R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 79", "R U2 R2 U' R2 U' R2 U2 R R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 80", "R U2 R2 U' R2 U' R2 U2 R M2 U M U2 M' U M2" },
+    { "ZBLL 81", "R U2 R2 U' R2 U' R2 U2 R M2 U' M U2 M' U' M2" },
+    { "ZBLL 82", "R U2 R2 U' R2 U' R2 U2 R R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 83", "R U2 R2 U' R2 U' R2 U2 R F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 84", "R U2 R2 U' R2 U' R2 U2 R M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 85", "R U2 R2 U' R2 U' R2 U2 R U x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 86", "R U2 R2 U' R2 U' R2 U2 R U x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 87", "R U2 R2 U' R2 U' R2 U2 R U x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 88", "R U2 R2 U' R2 U' R2 U2 R U R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 89", "R U2 R2 U' R2 U' R2 U2 R U R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 90", "R U2 R2 U' R2 U' R2 U2 R U R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 91", "R U2 R2 U' R2 U' R2 U2 R U R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 92", "R U2 R2 U' R2 U' R2 U2 R U R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 93", "R U2 R2 U' R2 U' R2 U2 R U R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 94", "R U2 R2 U' R2 U' R2 U2 R U R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 95", "R U2 R2 U' R2 U' R2 U2 R U R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 96", "R U2 R2 U' R2 U' R2 U2 R U R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 97", "R U2 R2 U' R2 U' R2 U2 R U R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 98", "R U2 R2 U' R2 U' R2 U2 R U M2 U M U2 M' U M2" },
+    { "ZBLL 99", "R U2 R2 U' R2 U' R2 U2 R U M2 U' M U2 M' U' M2" },
+    { "ZBLL 100", "R U2 R2 U' R2 U' R2 U2 R U R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 101", "R U2 R2 U' R2 U' R2 U2 R U F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 102", "R U2 R2 U' R2 U' R2 U2 R U M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 103", "R U2 R2 U' R2 U' R2 U2 R U2 x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 104", "R U2 R2 U' R2 U' R2 U2 R U2 x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 105", "R U2 R2 U' R2 U' R2 U2 R U2 R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 106", "R U2 R2 U' R2 U' R2 U2 R U2 R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 107", "R U2 R2 U' R2 U' R2 U2 R U2 R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 108", "R U2 R2 U' R2 U' R2 U2 R U2 R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 109", "R U2 R2 U' R2 U' R2 U2 R U2 R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 110", "R U2 R2 U' R2 U' R2 U2 R U2 R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 111", "R U2 R2 U' R2 U' R2 U2 R U2 R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 112", "R U2 R2 U' R2 U' R2 U2 R U2 R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 113", "R U2 R2 U' R2 U' R2 U2 R U2 R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 114", "R U2 R2 U' R2 U' R2 U2 R U2 R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 115", "R U2 R2 U' R2 U' R2 U2 R U2 M2 U M U2 M' U M2" },
+    { "ZBLL 116", "R U2 R2 U' R2 U' R2 U2 R U2 M2 U' M U2 M' U' M2" },
+    { "ZBLL 117", "R U2 R2 U' R2 U' R2 U2 R U2 R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 118", "R U2 R2 U' R2 U' R2 U2 R U2 F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 119", "R U2 R2 U' R2 U' R2 U2 R U' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 120", "R U2 R2 U' R2 U' R2 U2 R U' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 121", "R U2 R2 U' R2 U' R2 U2 R U' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 122", "R U2 R2 U' R2 U' R2 U2 R U' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 123", "R U2 R2 U' R2 U' R2 U2 R U' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 124", "R U2 R2 U' R2 U' R2 U2 R U' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 125", "R U2 R2 U' R2 U' R2 U2 R U' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 126", "R U2 R2 U' R2 U' R2 U2 R U' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 127", "R U2 R2 U' R2 U' R2 U2 R U' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 128", "R U2 R2 U' R2 U' R2 U2 R U' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 129", "R U2 R2 U' R2 U' R2 U2 R U' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 130", "R U2 R2 U' R2 U' R2 U2 R U' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 131", "R U2 R2 U' R2 U' R2 U2 R U' M2 U M U2 M' U M2" },
+    { "ZBLL 132", "R U2 R2 U' R2 U' R2 U2 R U' M2 U' M U2 M' U' M2" },
+    { "ZBLL 133", "R U2 R2 U' R2 U' R2 U2 R U' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 134", "R U2 R2 U' R2 U' R2 U2 R U' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 135", "R2 D' R U2 R' D R U2 R" },
+    { "ZBLL 136", "R2 D' R U2 R' D R U2 R x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 137", "R2 D' R U2 R' D R U2 R x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 138", "R2 D' R U2 R' D R U2 R x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 139", "R2 D' R U2 R' D R U2 R R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 140", "R2 D' R U2 R' D R U2 R R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 141", "R2 D' R U2 R' D R U2 R R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 142", "R2 D' R U2 R' D R U2 R R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 143", "R2 D' R U2 R' D R U2 R R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 144", "R2 D' R U2 R' D R U2 R M2 U M2 U2 M2 U M2" },
+    { "ZBLL 145", "R2 D' R U2 R' D R U2 R R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 146", "R2 D' R U2 R' D R U2 R R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 147", "R2 D' R U2 R' D R U2 R R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "ZBLL 148", "R2 D' R U2 R' D R U2 R R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 149", "R2 D' R U2 R' D R U2 R R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 150", "R2 D' R U2 R' D R U2 R R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 151", "R2 D' R U2 R' D R U2 R R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 152", "R2 D' R U2 R' D R U2 R M2 U M U2 M' U M2" },
+    { "ZBLL 153", "R2 D' R U2 R' D R U2 R M2 U' M U2 M' U' M2" },
+    { "ZBLL 154", "R2 D' R U2 R' D R U2 R R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 155", "R2 D' R U2 R' D R U2 R F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 156", "R2 D' R U2 R' D R U2 R M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 157", "R2 D' R U2 R' D R U2 R U x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 158", "R2 D' R U2 R' D R U2 R U x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 159", "R2 D' R U2 R' D R U2 R U x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 160", "R2 D' R U2 R' D R U2 R U R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 161", "R2 D' R U2 R' D R U2 R U R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 162", "R2 D' R U2 R' D R U2 R U R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 163", "R2 D' R U2 R' D R U2 R U R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 164", "R2 D' R U2 R' D R U2 R U R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 165", "R2 D' R U2 R' D R U2 R U R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 166", "R2 D' R U2 R' D R U2 R U R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 167", "R2 D' R U2 R' D R U2 R U R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 168", "R2 D' R U2 R' D R U2 R U R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 169", "R2 D' R U2 R' D R U2 R U R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 170", "R2 D' R U2 R' D R U2 R U M2 U M U2 M' U M2" },
+    { "ZBLL 171", "R2 D' R U2 R' D R U2 R U M2 U' M U2 M' U' M2" },
+    { "ZBLL 172", "R2 D' R U2 R' D R U2 R U R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 173", "R2 D' R U2 R' D R U2 R U F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 174", "R2 D' R U2 R' D R U2 R U M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 175", "R2 D' R U2 R' D R U2 R U2 x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 176", "R2 D' R U2 R' D R U2 R U2 x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 177", "R2 D' R U2 R' D R U2 R U2 R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 178", "R2 D' R U2 R' D R U2 R U2 R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 179", "R2 D' R U2 R' D R U2 R U2 R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 180", "R2 D' R U2 R' D R U2 R U2 R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 181", "R2 D' R U2 R' D R U2 R U2 R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 182", "R2 D' R U2 R' D R U2 R U2 R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 183", "R2 D' R U2 R' D R U2 R U2 R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 184", "R2 D' R U2 R' D R U2 R U2 R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 185", "R2 D' R U2 R' D R U2 R U2 R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 186", "R2 D' R U2 R' D R U2 R U2 R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 187", "R2 D' R U2 R' D R U2 R U2 M2 U M U2 M' U M2" },
+    { "ZBLL 188", "R2 D' R U2 R' D R U2 R U2 M2 U' M U2 M' U' M2" },
+    { "ZBLL 189", "R2 D' R U2 R' D R U2 R U2 R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 190", "R2 D' R U2 R' D R U2 R U2 F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 191", "R2 D' R U2 R' D R U2 R U' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 192", "R2 D' R U2 R' D R U2 R U' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 193", "R2 D' R U2 R' D R U2 R U' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 194", "R2 D' R U2 R' D R U2 R U' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 195", "R2 D' R U2 R' D R U2 R U' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 196", "R2 D' R U2 R' D R U2 R U' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 197", "R2 D' R U2 R' D R U2 R U' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 198", "R2 D' R U2 R' D R U2 R U' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 199", "R2 D' R U2 R' D R U2 R U' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 200", "R2 D' R U2 R' D R U2 R U' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 201", "R2 D' R U2 R' D R U2 R U' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 202", "R2 D' R U2 R' D R U2 R U' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 203", "R2 D' R U2 R' D R U2 R U' M2 U M U2 M' U M2" },
+    { "ZBLL 204", "R2 D' R U2 R' D R U2 R U' M2 U' M U2 M' U' M2" },
+    { "ZBLL 205", "R2 D' R U2 R' D R U2 R U' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 206", "R2 D' R U2 R' D R U2 R U' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 207", "r U R' U' r' F R F'" },
+    { "ZBLL 208", "r U R' U' r' F R F' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 209", "r U R' U' r' F R F' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 210", "r U R' U' r' F R F' x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 211", "r U R' U' r' F R F' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 212", "r U R' U' r' F R F' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 213", "r U R' U' r' F R F' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 214", "r U R' U' r' F R F' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 215", "r U R' U' r' F R F' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 216", "r U R' U' r' F R F' M2 U M2 U2 M2 U M2" },
+    { "ZBLL 217", "r U R' U' r' F R F' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 218", "r U R' U' r' F R F' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 219", "r U R' U' r' F R F' R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "ZBLL 220", "r U R' U' r' F R F' R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 221", "r U R' U' r' F R F' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 222", "r U R' U' r' F R F' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 223", "r U R' U' r' F R F' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 224", "r U R' U' r' F R F' M2 U M U2 M' U M2" },
+    { "ZBLL 225", "r U R' U' r' F R F' M2 U' M U2 M' U' M2" },
+    { "ZBLL 226", "r U R' U' r' F R F' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 227", "r U R' U' r' F R F' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 228", "r U R' U' r' F R F' M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 229", "r U R' U' r' F R F' U x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 230", "r U R' U' r' F R F' U x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 231", "r U R' U' r' F R F' U x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 232", "r U R' U' r' F R F' U R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 233", "r U R' U' r' F R F' U R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 234", "r U R' U' r' F R F' U R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 235", "r U R' U' r' F R F' U R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 236", "r U R' U' r' F R F' U R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 237", "r U R' U' r' F R F' U R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 238", "r U R' U' r' F R F' U R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 239", "r U R' U' r' F R F' U R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 240", "r U R' U' r' F R F' U R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 241", "r U R' U' r' F R F' U R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 242", "r U R' U' r' F R F' U M2 U M U2 M' U M2" },
+    { "ZBLL 243", "r U R' U' r' F R F' U M2 U' M U2 M' U' M2" },
+    { "ZBLL 244", "r U R' U' r' F R F' U R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 245", "r U R' U' r' F R F' U F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 246", "r U R' U' r' F R F' U M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 247", "r U R' U' r' F R F' U2 x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 248", "r U R' U' r' F R F' U2 x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 249", "r U R' U' r' F R F' U2 R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 250", "r U R' U' r' F R F' U2 R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 251", "r U R' U' r' F R F' U2 R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 252", "r U R' U' r' F R F' U2 R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 253", "r U R' U' r' F R F' U2 R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 254", "r U R' U' r' F R F' U2 R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 255", "r U R' U' r' F R F' U2 R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 256", "r U R' U' r' F R F' U2 R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 257", "r U R' U' r' F R F' U2 R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 258", "r U R' U' r' F R F' U2 R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 259", "r U R' U' r' F R F' U2 M2 U M U2 M' U M2" },
+    { "ZBLL 260", "r U R' U' r' F R F' U2 M2 U' M U2 M' U' M2" },
+    { "ZBLL 261", "r U R' U' r' F R F' U2 R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 262", "r U R' U' r' F R F' U2 F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 263", "r U R' U' r' F R F' U' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 264", "r U R' U' r' F R F' U' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 265", "r U R' U' r' F R F' U' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 266", "r U R' U' r' F R F' U' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 267", "r U R' U' r' F R F' U' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 268", "r U R' U' r' F R F' U' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 269", "r U R' U' r' F R F' U' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 270", "r U R' U' r' F R F' U' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 271", "r U R' U' r' F R F' U' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 272", "r U R' U' r' F R F' U' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 273", "r U R' U' r' F R F' U' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 274", "r U R' U' r' F R F' U' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 275", "r U R' U' r' F R F' U' M2 U M U2 M' U M2" },
+    { "ZBLL 276", "r U R' U' r' F R F' U' M2 U' M U2 M' U' M2" },
+    { "ZBLL 277", "r U R' U' r' F R F' U' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 278", "r U R' U' r' F R F' U' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 279", "F' r U R' U' r' F R" },
+    { "ZBLL 280", "F' r U R' U' r' F R x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 281", "F' r U R' U' r' F R x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 282", "F' r U R' U' r' F R x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 283", "F' r U R' U' r' F R R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 284", "F' r U R' U' r' F R R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 285", "F' r U R' U' r' F R R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 286", "F' r U R' U' r' F R R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 287", "F' r U R' U' r' F R R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 288", "F' r U R' U' r' F R M2 U M2 U2 M2 U M2" },
+    { "ZBLL 289", "F' r U R' U' r' F R R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 290", "F' r U R' U' r' F R R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 291", "F' r U R' U' r' F R R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "ZBLL 292", "F' r U R' U' r' F R R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 293", "F' r U R' U' r' F R R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 294", "F' r U R' U' r' F R R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 295", "F' r U R' U' r' F R R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 296", "F' r U R' U' r' F R M2 U M U2 M' U M2" },
+    { "ZBLL 297", "F' r U R' U' r' F R M2 U' M U2 M' U' M2" },
+    { "ZBLL 298", "F' r U R' U' r' F R R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 299", "F' r U R' U' r' F R F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 300", "F' r U R' U' r' F R M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 301", "F' r U R' U' r' F R U x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 302", "F' r U R' U' r' F R U x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 303", "F' r U R' U' r' F R U x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 304", "F' r U R' U' r' F R U R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 305", "F' r U R' U' r' F R U R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 306", "F' r U R' U' r' F R U R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 307", "F' r U R' U' r' F R U R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 308", "F' r U R' U' r' F R U R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 309", "F' r U R' U' r' F R U R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 310", "F' r U R' U' r' F R U R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 311", "F' r U R' U' r' F R U R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 312", "F' r U R' U' r' F R U R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 313", "F' r U R' U' r' F R U R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 314", "F' r U R' U' r' F R U M2 U M U2 M' U M2" },
+    { "ZBLL 315", "F' r U R' U' r' F R U M2 U' M U2 M' U' M2" },
+    { "ZBLL 316", "F' r U R' U' r' F R U R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 317", "F' r U R' U' r' F R U F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 318", "F' r U R' U' r' F R U M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 319", "F' r U R' U' r' F R U2 x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 320", "F' r U R' U' r' F R U2 x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 321", "F' r U R' U' r' F R U2 R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 322", "F' r U R' U' r' F R U2 R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 323", "F' r U R' U' r' F R U2 R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 324", "F' r U R' U' r' F R U2 R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 325", "F' r U R' U' r' F R U2 R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 326", "F' r U R' U' r' F R U2 R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 327", "F' r U R' U' r' F R U2 R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 328", "F' r U R' U' r' F R U2 R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 329", "F' r U R' U' r' F R U2 R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 330", "F' r U R' U' r' F R U2 R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 331", "F' r U R' U' r' F R U2 M2 U M U2 M' U M2" },
+    { "ZBLL 332", "F' r U R' U' r' F R U2 M2 U' M U2 M' U' M2" },
+    { "ZBLL 333", "F' r U R' U' r' F R U2 R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 334", "F' r U R' U' r' F R U2 F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 335", "F' r U R' U' r' F R U' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 336", "F' r U R' U' r' F R U' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 337", "F' r U R' U' r' F R U' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 338", "F' r U R' U' r' F R U' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 339", "F' r U R' U' r' F R U' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 340", "F' r U R' U' r' F R U' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 341", "F' r U R' U' r' F R U' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 342", "F' r U R' U' r' F R U' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 343", "F' r U R' U' r' F R U' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 344", "F' r U R' U' r' F R U' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 345", "F' r U R' U' r' F R U' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 346", "F' r U R' U' r' F R U' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 347", "F' r U R' U' r' F R U' M2 U M U2 M' U M2" },
+    { "ZBLL 348", "F' r U R' U' r' F R U' M2 U' M U2 M' U' M2" },
+    { "ZBLL 349", "F' r U R' U' r' F R U' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 350", "F' r U R' U' r' F R U' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 351", "R U2 R' U' R U' R'" },
+    { "ZBLL 352", "R U2 R' U' R U' R' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 353", "R U2 R' U' R U' R' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 354", "R U2 R' U' R U' R' x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 355", "R U2 R' U' R U' R' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 356", "R U2 R' U' R U' R' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 357", "R U2 R' U' R U' R' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 358", "R U2 R' U' R U' R' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 359", "R U2 R' U' R U' R' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 360", "R U2 R' U' R U' R' M2 U M2 U2 M2 U M2" },
+    { "ZBLL 361", "R U2 R' U' R U' R' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 362", "R U2 R' U' R U' R' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 363", "R U2 R' U' R U' R' R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "ZBLL 364", "R U2 R' U' R U' R' R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 365", "R U2 R' U' R U' R' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 366", "R U2 R' U' R U' R' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 367", "R U2 R' U' R U' R' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 368", "R U2 R' U' R U' R' M2 U M U2 M' U M2" },
+    { "ZBLL 369", "R U2 R' U' R U' R' M2 U' M U2 M' U' M2" },
+    { "ZBLL 370", "R U2 R' U' R U' R' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 371", "R U2 R' U' R U' R' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 372", "R U2 R' U' R U' R' M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 373", "R U2 R' U' R U' R' U x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 374", "R U2 R' U' R U' R' U x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 375", "R U2 R' U' R U' R' U x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 376", "R U2 R' U' R U' R' U R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 377", "R U2 R' U' R U' R' U R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 378", "R U2 R' U' R U' R' U R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 379", "R U2 R' U' R U' R' U R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 380", "R U2 R' U' R U' R' U R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 381", "R U2 R' U' R U' R' U R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 382", "R U2 R' U' R U' R' U R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 383", "R U2 R' U' R U' R' U R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 384", "R U2 R' U' R U' R' U R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 385", "R U2 R' U' R U' R' U R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 386", "R U2 R' U' R U' R' U M2 U M U2 M' U M2" },
+    { "ZBLL 387", "R U2 R' U' R U' R' U M2 U' M U2 M' U' M2" },
+    { "ZBLL 388", "R U2 R' U' R U' R' U R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 389", "R U2 R' U' R U' R' U F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 390", "R U2 R' U' R U' R' U M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 391", "R U2 R' U' R U' R' U2 x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 392", "R U2 R' U' R U' R' U2 x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 393", "R U2 R' U' R U' R' U2 R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 394", "R U2 R' U' R U' R' U2 R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 395", "R U2 R' U' R U' R' U2 R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 396", "R U2 R' U' R U' R' U2 R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 397", "R U2 R' U' R U' R' U2 R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 398", "R U2 R' U' R U' R' U2 R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 399", "R U2 R' U' R U' R' U2 R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 400", "R U2 R' U' R U' R' U2 R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 401", "R U2 R' U' R U' R' U2 R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 402", "R U2 R' U' R U' R' U2 R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 403", "R U2 R' U' R U' R' U2 M2 U M U2 M' U M2" },
+    { "ZBLL 404", "R U2 R' U' R U' R' U2 M2 U' M U2 M' U' M2" },
+    { "ZBLL 405", "R U2 R' U' R U' R' U2 R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 406", "R U2 R' U' R U' R' U2 F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 407", "R U2 R' U' R U' R' U' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 408", "R U2 R' U' R U' R' U' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 409", "R U2 R' U' R U' R' U' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 410", "R U2 R' U' R U' R' U' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 411", "R U2 R' U' R U' R' U' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 412", "R U2 R' U' R U' R' U' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 413", "R U2 R' U' R U' R' U' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 414", "R U2 R' U' R U' R' U' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 415", "R U2 R' U' R U' R' U' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 416", "R U2 R' U' R U' R' U' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 417", "R U2 R' U' R U' R' U' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 418", "R U2 R' U' R U' R' U' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 419", "R U2 R' U' R U' R' U' M2 U M U2 M' U M2" },
+    { "ZBLL 420", "R U2 R' U' R U' R' U' M2 U' M U2 M' U' M2" },
+    { "ZBLL 421", "R U2 R' U' R U' R' U' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 422", "R U2 R' U' R U' R' U' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 423", "R U R' U R U2 R'" },
+    { "ZBLL 424", "R U R' U R U2 R' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 425", "R U R' U R U2 R' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 426", "R U R' U R U2 R' x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 427", "R U R' U R U2 R' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 428", "R U R' U R U2 R' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 429", "R U R' U R U2 R' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 430", "R U R' U R U2 R' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 431", "R U R' U R U2 R' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 432", "R U R' U R U2 R' M2 U M2 U2 M2 U M2" },
+    { "ZBLL 433", "R U R' U R U2 R' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 434", "R U R' U R U2 R' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 435", "R U R' U R U2 R' R U R' U R U R' F' R U R' U' R' F R2 U' R' U2 R U' R'" },
+    { "ZBLL 436", "R U R' U R U2 R' R' U R U' R' F' U' F R U R' F R' F' R U' R" },
+    { "ZBLL 437", "R U R' U R U2 R' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 438", "R U R' U R U2 R' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 439", "R U R' U R U2 R' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 440", "R U R' U R U2 R' M2 U M U2 M' U M2" },
+    { "ZBLL 441", "R U R' U R U2 R' M2 U' M U2 M' U' M2" },
+    { "ZBLL 442", "R U R' U R U2 R' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 443", "R U R' U R U2 R' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 444", "R U R' U R U2 R' M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 445", "R U R' U R U2 R' U x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 446", "R U R' U R U2 R' U x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 447", "R U R' U R U2 R' U x' R U' R' D R U R' D' R U R' D R U' R' D' x" },
+    { "ZBLL 448", "R U R' U R U2 R' U R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 449", "R U R' U R U2 R' U R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 450", "R U R' U R U2 R' U R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 451", "R U R' U R U2 R' U R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 452", "R U R' U R U2 R' U R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 453", "R U R' U R U2 R' U R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 454", "R U R' U R U2 R' U R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 455", "R U R' U R U2 R' U R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 456", "R U R' U R U2 R' U R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 457", "R U R' U R U2 R' U R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 458", "R U R' U R U2 R' U M2 U M U2 M' U M2" },
+    { "ZBLL 459", "R U R' U R U2 R' U M2 U' M U2 M' U' M2" },
+    { "ZBLL 460", "R U R' U R U2 R' U R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 461", "R U R' U R U2 R' U F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 462", "R U R' U R U2 R' U M' U M2 U M2 U M' U2 M2" },
+    { "ZBLL 463", "R U R' U R U2 R' U2 x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 464", "R U R' U R U2 R' U2 x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 465", "R U R' U R U2 R' U2 R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 466", "R U R' U R U2 R' U2 R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 467", "R U R' U R U2 R' U2 R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 468", "R U R' U R U2 R' U2 R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 469", "R U R' U R U2 R' U2 R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 470", "R U R' U R U2 R' U2 R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 471", "R U R' U R U2 R' U2 R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 472", "R U R' U R U2 R' U2 R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 473", "R U R' U R U2 R' U2 R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 474", "R U R' U R U2 R' U2 R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 475", "R U R' U R U2 R' U2 M2 U M U2 M' U M2" },
+    { "ZBLL 476", "R U R' U R U2 R' U2 M2 U' M U2 M' U' M2" },
+    { "ZBLL 477", "R U R' U R U2 R' U2 R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 478", "R U R' U R U2 R' U2 F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+    { "ZBLL 479", "R U R' U R U2 R' U' x R' U R' D2 R U' R' D2 R2 x'" },
+    { "ZBLL 480", "R U R' U R U2 R' U' x R2 D2 R U R' D2 R U' R x'" },
+    { "ZBLL 481", "R U R' U R U2 R' U' R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+    { "ZBLL 482", "R U R' U R U2 R' U' R2 U R' U R' U' R U' R2 U' D R' U R D'" },
+    { "ZBLL 483", "R U R' U R U2 R' U' R' U' R U D' R2 U R' U R U' R U' R2 D" },
+    { "ZBLL 484", "R U R' U R U2 R' U' R2 U' R U' R U R' U R2 U D' R U' R' D" },
+    { "ZBLL 485", "R U R' U R U2 R' U' R U R' U' D R2 U' R U' R' U R' U R2 D'" },
+    { "ZBLL 486", "R U R' U R U2 R' U' R' U L' U2 R U' R' U2 R L U'" },
+    { "ZBLL 487", "R U R' U R U2 R' U' R U R' F' R U R' U' R' F R2 U' R'" },
+    { "ZBLL 488", "R U R' U R U2 R' U' R U' R' U' R U R D R' U' R D' R' U2 R'" },
+    { "ZBLL 489", "R U R' U R U2 R' U' R2 F R U R U' R' F' R U2 R' U2 R" },
+    { "ZBLL 490", "R U R' U R U2 R' U' R U R' U' R' F R2 U' R' U' R U R' F'" },
+    { "ZBLL 491", "R U R' U R U2 R' U' M2 U M U2 M' U M2" },
+    { "ZBLL 492", "R U R' U R U2 R' U' M2 U' M U2 M' U' M2" },
+    { "ZBLL 493", "R U R' U R U2 R' U' R' U R' U' y R' F' R2 U' R' U R' F R F" },
+    { "ZBLL 494", "R U R' U R U2 R' U' F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+};
+
+static const LastLayerEntry zbllEntries[1024] = {
+    { 0x005b11071a324824ULL, 224, 2 },
+    { 0x029c062103314920ULL, 432, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0011023889904920ULL, 161, 3 },
+    { 0x006011809c70c824ULL, 383, 3 },
+    { 0x0010611104104924ULL, 145, 2 },
+    { 0x0094211084904920ULL, 253, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00206230d1104924ULL, 211, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x065112290a10c8e0ULL, 120, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006161a85450c920ULL, 370, 0 },
+    { 0x005c02210831c920ULL, 427, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0024721043514820ULL, 76, 1 },
+    { 0x00e350a64c51c824ULL, 399, 3 },
+    { 0x004c22110a70c920ULL, 471, 2 },
+    { 0x060c7011047148e0ULL, 27, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001b41170c304924ULL, 170, 2 },
+    { 0x04047111045048a0ULL, 55, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x049152191b1148a0ULL, 108, 0 },
+    { 0x0052201488924924ULL, 3, 1 },
+    { 0x006310865c51c824ULL, 395, 3 },
+    { 0x0013721683914824ULL, 314, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001b613714304924ULL, 169, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x000400300c914920ULL, 238, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005b712712324824ULL, 258, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005411009a924820ULL, 142, 0 },
+    { 0x006071a09470c824ULL, 390, 3 },
+    { 0x0084502114514820ULL, 61, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0011709301124824ULL, 214, 2 },
+    { 0x00dc30810431c820ULL, 23, 2 },
+    { 0x0099502310324824ULL, 209, 2 },
+    { 0x0010110102124824ULL, 229, 2 },
+    { 0x029c46111b314920ULL, 456, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006160181c314920ULL, 415, 0 },
+    { 0x00e1300204314824ULL, 350, 3 },
+    { 0x00a100381c314920ULL, 416, 0 },
+    { 0x06044e011051c920ULL, 440, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001441108c904920ULL, 271, 0 },
+    { 0x02c466210250c920ULL, 435, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00dc50a10c31c820ULL, 45, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0040301108524824ULL, 263, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a4122043514820ULL, 77, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006370a65451c824ULL, 352, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e150220c314824ULL, 403, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04914a2893914920ULL, 135, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04841121045048a0ULL, 38, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0014613094904920ULL, 266, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x024426011250c920ULL, 434, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005c10811c31c820ULL, 48, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0251641298924924ULL, 16, 1 },
+    { 0x0291043298924924ULL, 7, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06c46e311851c920ULL, 490, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006110021c314824ULL, 418, 3 },
+    { 0x009b5226d290c824ULL, 318, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0291241280924924ULL, 10, 2 },
+    { 0x045132190b1148a0ULL, 105, 0 },
+    { 0x045c1180db9248a0ULL, 181, 0 },
+    { 0x0083309701524824ULL, 252, 2 },
+    { 0x064c0e210b714920ULL, 484, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009110a301124824ULL, 210, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00583210c9904824ULL, 319, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009041111c104924ULL, 140, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x025912290b314860ULL, 101, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x025c26110b314920ULL, 448, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a452105b514820ULL, 84, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002140180c314920ULL, 409, 0 },
+    { 0x005c70a11431c820ULL, 42, 2 },
+    { 0x000912324a90c824ULL, 338, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0022621441504924ULL, 256, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x000c42011270c920ULL, 470, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0061702214314824ULL, 359, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009352169b914824ULL, 346, 1 },
+    { 0x0021603814314920ULL, 351, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e472208270c820ULL, 65, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0012400490924924ULL, 12, 0 },
+    { 0x020406010250c920ULL, 492, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0211441288924924ULL, 14, 1 },
+    { 0x0003509709524824ULL, 250, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x044009210c504924ULL, 183, 2 },
+    { 0x0019400910324920ULL, 312, 0 },
+    { 0x006432009270c820ULL, 86, 1 },
+    { 0x04647210db1148a0ULL, 106, 1 },
+    { 0x008410311c514820ULL, 25, 2 },
+    { 0x004470111c514820ULL, 51, 0 },
+    { 0x020112390a50c860ULL, 72, 0 },
+    { 0x00642090c9124920ULL, 302, 2 },
+    { 0x00cc62311a70c920ULL, 467, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00dc62210031c920ULL, 426, 2 },
+    { 0x0059701318324824ULL, 219, 2 },
+    { 0x04a43210c31148a0ULL, 107, 1 },
+    { 0x0084203014914920ULL, 233, 0 },
+    { 0x0099103318324824ULL, 260, 2 },
+    { 0x0211643290924924ULL, 6, 1 },
+    { 0x000370b711524824ULL, 254, 2 },
+    { 0x004812204b914824ULL, 322, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0099301300324824ULL, 243, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005021110c104924ULL, 175, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02c426310a50c920ULL, 459, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x065132091210c8e0ULL, 121, 0 },
+    { 0x002350168c714824ULL, 353, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000500110524824ULL, 240, 2 },
+    { 0x00a2022441504924ULL, 248, 3 },
+    { 0x006111a24c50c824ULL, 357, 3 },
+    { 0x006432104b514820ULL, 68, 1 },
+    { 0x005c22011031c920ULL, 438, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002101b84c50c920ULL, 405, 0 },
+    { 0x044431110c5048a0ULL, 60, 0 },
+    { 0x062452104851c8e0ULL, 129, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06c42e010051c920ULL, 422, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0011621881904920ULL, 163, 3 },
+    { 0x04912a1883914920ULL, 196, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005332168b914824ULL, 287, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02180430c8924924ULL, 15, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04115209131148a0ULL, 92, 0 },
+    { 0x0011008901124920ULL, 300, 0 },
+    { 0x02c446011a50c920ULL, 460, 2 },
+    { 0x06c44e210851c920ULL, 491, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00c0703118524824ULL, 246, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005c10a0c9924820ULL, 144, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001b11370a324824ULL, 275, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00185200d1904824ULL, 294, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002412008270c820ULL, 81, 1 },
+    { 0x000450110c514820ULL, 34, 0 },
+    { 0x002011b08c70c824ULL, 384, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06440e011851c920ULL, 439, 2 },
+    { 0x021c460113314920ULL, 449, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0019501308324824ULL, 244, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0004601004914920ULL, 216, 0 },
+    { 0x0011120281904824ULL, 281, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x061c1101043048e0ULL, 30, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04247230d31148a0ULL, 111, 1 },
+    { 0x0004703114514820ULL, 57, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x004902284a90c920ULL, 153, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x061112090210c8e0ULL, 123, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0019703310324824ULL, 226, 2 },
+    { 0x001c02010031c920ULL, 433, 2 },
+    { 0x06cc6e2103714920ULL, 489, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002310b64c51c824ULL, 401, 3 },
+    { 0x008932325290c824ULL, 342, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e432308a70c820ULL, 116, 1 },
+    { 0x0091022881904920ULL, 159, 3 },
+    { 0x04114a188b914920ULL, 194, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02dc66311b314920ULL, 455, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x044411200a9248a0ULL, 182, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001411308a924820ULL, 139, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x064c2e0113714920ULL, 480, 2 },
+    { 0x02d9722903314860ULL, 97, 0 },
+    { 0x00cc22010270c920ULL, 478, 2 },
+    { 0x06446e211051c920ULL, 431, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04116a3893914920ULL, 198, 3 },
+    { 0x00244080d1124920ULL, 290, 2 },
+    { 0x001b5216ca90c824ULL, 305, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06d132390a10c8e0ULL, 126, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00dc22310831c920ULL, 436, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00cc42210a70c920ULL, 472, 2 },
+    { 0x0259320913314860ULL, 80, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e452009a70c820ULL, 99, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001b7236d290c824ULL, 309, 1 },
+    { 0x028132391250c860ULL, 87, 0 },
+    { 0x0010410114104924ULL, 138, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x028446211250c920ULL, 477, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0024520053514820ULL, 67, 1 },
+    { 0x00600220c9104924ULL, 269, 3 },
+    { 0x004c02011a70c920ULL, 465, 2 },
+    { 0x060c5001147148e0ULL, 29, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001c10b10c31c820ULL, 52, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04045101145048a0ULL, 50, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005071111a124824ULL, 264, 2 },
+    { 0x002110320c314824ULL, 371, 3 },
+    { 0x00dc42011831c920ULL, 437, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0013520693914824ULL, 299, 1 },
+    { 0x00c8722043914824ULL, 327, 1 },
+    { 0x0090311102124824ULL, 265, 2 },
+    { 0x000972124290c824ULL, 340, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0059000918324920ULL, 311, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005b01270c304924ULL, 187, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e472305b514820ULL, 125, 1 },
+    { 0x060c0e0103714920ULL, 469, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0011508311124824ULL, 222, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0048320053914824ULL, 323, 1 },
+    { 0x04c471311c5048a0ULL, 56, 0 },
+    { 0x00e171a24450c824ULL, 366, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x004c62211270c920ULL, 424, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0219120903314860ULL, 131, 0 },
+    { 0x009b313712324824ULL, 274, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a031b09470c824ULL, 360, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006131825450c824ULL, 354, 3 },
+    { 0x020172190250c860ULL, 96, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06cc2e310b714920ULL, 488, 2 },
+    { 0x04d152290b1148a0ULL, 118, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02dc260103314920ULL, 479, 2 },
+    { 0x0059602910324920ULL, 307, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a452209270c820ULL, 133, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x008912224290c824ULL, 336, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001051110a124824ULL, 268, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x045112091b1148a0ULL, 64, 0 },
+    { 0x02d932390b314860ULL, 114, 0 },
+    { 0x069c5121143048e0ULL, 33, 0 },
+    { 0x00a330b65451c824ULL, 396, 3 },
+    { 0x02dc46210b314920ULL, 451, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002161984450c920ULL, 362, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005c3080d1924820ULL, 166, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0400090104504924ULL, 190, 2 },
+    { 0x0010713112124824ULL, 272, 2 },
+    { 0x0040702110524824ULL, 234, 2 },
+    { 0x009c42211031c920ULL, 430, 2 },
+    { 0x06cc4e011b714920ULL, 486, 2 },
+    { 0x00c962284290c920ULL, 171, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x025c06011b314920ULL, 453, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0008120043914824ULL, 280, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x024466111a50c920ULL, 442, 2 },
+    { 0x028406311a50c920ULL, 446, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0022420451504924ULL, 257, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02d952091b314860ULL, 83, 0 },
+    { 0x028112290250c860ULL, 90, 0 },
+    { 0x004922085290c920ULL, 154, 3 },
+    { 0x001b711702324824ULL, 259, 2 },
+    { 0x028426110250c920ULL, 493, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002071908470c824ULL, 377, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002111824450c824ULL, 365, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x008952125a90c824ULL, 325, 1 },
+    { 0x04c029310c504924ULL, 185, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000924924ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009c30b11431c820ULL, 47, 0 },
+    { 0x00587220d1904824ULL, 285, 1 },
+    { 0x00c832304b914824ULL, 329, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e4320043514820ULL, 66, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e070a00431c824ULL, 408, 3 },
+    { 0x06cc3001047148e0ULL, 53, 2 },
+    { 0x025c662113314920ULL, 462, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a1303214314824ULL, 385, 3 },
+    { 0x00a101a84450c920ULL, 421, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002370964451c824ULL, 398, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06040e310851c920ULL, 461, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00e131b24c50c824ULL, 413, 3 },
+    { 0x00e452204b514820ULL, 73, 1 },
+    { 0x001c1080c1924820ULL, 174, 0 },
+    { 0x0024018043524920ULL, 278, 2 },
+    { 0x006030801431c824ULL, 417, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0014711082924820ULL, 141, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x028152191a50c860ULL, 89, 0 },
+    { 0x005001011c104924ULL, 148, 2 },
+    { 0x004310a709524824ULL, 251, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00c852005b914824ULL, 308, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0051609919124920ULL, 282, 0 },
+    { 0x006412005b514820ULL, 70, 1 },
+    { 0x00602200d1104924ULL, 220, 3 },
+    { 0x009b112702324824ULL, 227, 2 },
+    { 0x064c10011c7148e0ULL, 54, 2 },
+    { 0x009100b919124920ULL, 284, 0 },
+    { 0x00d352268b914824ULL, 295, 1 },
+    { 0x00a011a08470c824ULL, 381, 3 },
+    { 0x020446110a50c920ULL, 425, 2 },
+    { 0x068c4e2113714920ULL, 482, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x000902084290c920ULL, 137, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00db612704304924ULL, 151, 2 },
+    { 0x00a412309a70c820ULL, 75, 1 },
+    { 0x006472109a70c820ULL, 100, 1 },
+    { 0x0011420891904920ULL, 168, 3 },
+    { 0x006460a0d1124920ULL, 316, 2 },
+    { 0x00e151825c50c824ULL, 364, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x004932124a90c824ULL, 279, 1 },
+    { 0x005312069b914824ULL, 347, 1 },
+    { 0x020466311250c920ULL, 441, 2 },
+    { 0x00a432108270c820ULL, 132, 1 },
+    { 0x00a141985c50c920ULL, 420, 0 },
+    { 0x0051721299904824ULL, 291, 1 },
+    { 0x0091123299904824ULL, 315, 1 },
+    { 0x0299522913314860ULL, 79, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x065c71111c3048e0ULL, 35, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001c70910431c820ULL, 46, 2 },
+    { 0x005b210714304924ULL, 203, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x066412204851c8e0ULL, 128, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a310a64451c824ULL, 393, 3 },
+    { 0x0051108319124824ULL, 213, 2 },
+    { 0x069112391a10c8e0ULL, 122, 0 },
+    { 0x065172191a10c8e0ULL, 124, 0 },
+    { 0x02984410d8924924ULL, 5, 0 },
+    { 0x0021701204314824ULL, 368, 3 },
+    { 0x005c62111831c920ULL, 429, 2 },
+    { 0x041c7190c39248a0ULL, 200, 0 },
+    { 0x0064722053514820ULL, 78, 1 },
+    { 0x00c922384a90c920ULL, 146, 3 },
+    { 0x009c02311831c920ULL, 444, 2 },
+    { 0x064c7021147148e0ULL, 41, 2 },
+    { 0x069132190210c8e0ULL, 63, 0 },
+    { 0x009c22110031c920ULL, 485, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04447121145048a0ULL, 22, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009b51171a324824ULL, 223, 2 },
+    { 0x002010800431c824ULL, 414, 3 },
+    { 0x000c02310a70c920ULL, 464, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a051909c70c824ULL, 375, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x024132190a50c860ULL, 91, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x004410210c514820ULL, 39, 0 },
+    { 0x0011409909124920ULL, 341, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0012003488924924ULL, 19, 2 },
+    { 0x0480492114504924ULL, 136, 2 },
+    { 0x00200200c1104924ULL, 228, 3 },
+    { 0x0059102308324824ULL, 276, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00c942085a90c920ULL, 205, 3 },
+    { 0x0054210094904920ULL, 270, 0 },
+    { 0x005170a311124824ULL, 221, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0019003908324920ULL, 310, 0 },
+    { 0x0088522053914824ULL, 334, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002452108a70c820ULL, 74, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001160b911124920ULL, 286, 0 },
+    { 0x00a350965c51c824ULL, 392, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009c10a10431c820ULL, 44, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0011521289904824ULL, 298, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x061c51110c3048e0ULL, 26, 2 },
+    { 0x00a1102204314824ULL, 367, 3 },
+    { 0x009451109a924820ULL, 149, 0 },
+    { 0x002472309270c820ULL, 117, 1 },
+    { 0x001b010704304924ULL, 134, 2 },
+    { 0x049c11a0c39248a0ULL, 192, 0 },
+    { 0x04510a288b914920ULL, 195, 3 },
+    { 0x00a151a25450c824ULL, 355, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x061152190a10c8e0ULL, 109, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02582410c8924924ULL, 2, 2 },
+    { 0x0080402010924924ULL, 9, 0 },
+    { 0x0000103108524824ULL, 237, 2 },
+    { 0x0011723291904824ULL, 349, 1 },
+    { 0x001c42110831c920ULL, 463, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06842e311051c920ULL, 474, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0062020459504924ULL, 236, 3 },
+    { 0x005b1226ca90c824ULL, 306, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005b31170a324824ULL, 215, 2 },
+    { 0x061172391210c8e0ULL, 85, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006031908c70c824ULL, 378, 3 },
+    { 0x068c0e311b714920ULL, 423, 2 },
+    { 0x001c62311031c920ULL, 428, 2 },
+    { 0x064c6e111b714920ULL, 481, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00db21370c304924ULL, 155, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x068c2e1103714920ULL, 487, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009c50a0d1924820ULL, 191, 0 },
+    { 0x041112390b1148a0ULL, 110, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0061200814314920ULL, 397, 0 },
+    { 0x009c50911c31c820ULL, 59, 0 },
+    { 0x000952025290c824ULL, 345, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0014010084904920ULL, 207, 0 },
+    { 0x025972191b314860ULL, 98, 0 },
+    { 0x029912391b314860ULL, 115, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a150121c314824ULL, 389, 3 },
+    { 0x00181230c9904824ULL, 289, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02d1642280924924ULL, 8, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0299321903314860ULL, 71, 0 },
+    { 0x006330964c51c824ULL, 380, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x021c06310b314920ULL, 447, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x008942285290c920ULL, 158, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00db41071c304924ULL, 202, 2 },
+    { 0x005431108a924820ULL, 156, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0251240290924924ULL, 11, 1 },
+    { 0x0043308711524824ULL, 249, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00c972325a90c824ULL, 301, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x020152091250c860ULL, 94, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06046e110051c920ULL, 458, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x008c22311270c920ULL, 466, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x044069111c504924ULL, 176, 2 },
+    { 0x048009311c504924ULL, 178, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0051020899904920ULL, 162, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x060c4e110b714920ULL, 445, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0063300694714824ULL, 363, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x004872105b914824ULL, 320, 1 },
+    { 0x008812305b914824ULL, 326, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002400b0c9124920ULL, 297, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a050a01431c824ULL, 412, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0088321043914824ULL, 321, 1 },
+    { 0x005c30910c31c820ULL, 49, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002141885450c920ULL, 369, 0 },
+    { 0x02c172391a50c860ULL, 93, 0 },
+    { 0x060c6e3113714920ULL, 483, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x021952190b314860ULL, 130, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006130120c314824ULL, 386, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006171925c50c824ULL, 356, 3 },
+    { 0x001001310c104924ULL, 197, 2 },
+    { 0x00a04220d1104924ULL, 247, 3 },
+    { 0x00a111b25c50c824ULL, 372, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02184400d0924924ULL, 4, 0 },
+    { 0x0040601018924924ULL, 21, 1 },
+    { 0x00a131924450c824ULL, 361, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0219723913314860ULL, 62, 0 },
+    { 0x002412304b514820ULL, 103, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x060c10310c7148e0ULL, 24, 0 },
+    { 0x0051622891904920ULL, 167, 3 },
+    { 0x00d9702300324824ULL, 225, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x040411310c5048a0ULL, 31, 0 },
+    { 0x0211040280924924ULL, 1, 0 },
+    { 0x0003108701524824ULL, 208, 2 },
+    { 0x06840e210051c920ULL, 457, 2 },
+    { 0x001b510712324824ULL, 245, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0080303110524824ULL, 232, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002051809470c824ULL, 379, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001312368b914824ULL, 331, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0059300310324824ULL, 277, 2 },
+    { 0x009b412714304924ULL, 143, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006461905b524920ULL, 317, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x000c62110270c920ULL, 452, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x040049110c504924ULL, 164, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a4219043524920ULL, 296, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001110b309124824ULL, 212, 2 },
+    { 0x0023100684714824ULL, 388, 3 },
+    { 0x000852104b914824ULL, 324, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0044602014914920ULL, 235, 0 },
+    { 0x04913239131148a0ULL, 113, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0012601480924924ULL, 20, 0 },
+    { 0x00db71371a324824ULL, 206, 2 },
+    { 0x002350865451c824ULL, 400, 3 },
+    { 0x0400693114504924ULL, 180, 2 },
+    { 0x00e071b09c70c824ULL, 382, 3 },
+    { 0x04512a0893914920ULL, 193, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x062412004051c8e0ULL, 127, 1 },
+    { 0x004962185a90c920ULL, 147, 3 },
+    { 0x008902385a90c920ULL, 204, 3 },
+    { 0x0019601900324920ULL, 288, 0 },
+    { 0x00983230d1904824ULL, 283, 1 },
+    { 0x00c932024290c824ULL, 337, 1 },
+    { 0x0014510092924820ULL, 150, 0 },
+    { 0x0008723053914824ULL, 328, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002151924c50c824ULL, 391, 3 },
+    { 0x008922184290c920ULL, 188, 3 },
+    { 0x06844e111851c920ULL, 443, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x029c263113314920ULL, 454, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000401008924924ULL, 18, 1 },
+    { 0x005b3206d290c824ULL, 304, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00c952224a90c824ULL, 343, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x048411301a9248a0ULL, 177, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00c3508719524824ULL, 255, 2 },
+    { 0x002171b25450c824ULL, 358, 3 },
+    { 0x00e370b65c51c824ULL, 394, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000701100524824ULL, 239, 2 },
+    { 0x0000603010924924ULL, 17, 1 },
+    { 0x0004100104514820ULL, 58, 0 },
+    { 0x04241200c31148a0ULL, 112, 1 },
+    { 0x008c02210270c920ULL, 468, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x004912025a90c824ULL, 339, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0019100300324824ULL, 230, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02c132090250c860ULL, 88, 0 },
+    { 0x001c5090c9924820ULL, 165, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x006070901c31c824ULL, 411, 3 },
+    { 0x024406210a50c920ULL, 476, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001c50811431c820ULL, 32, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0092002480924924ULL, 13, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0021500214314824ULL, 419, 3 },
+    { 0x00a420b0d1124920ULL, 348, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x02c152290a50c860ULL, 102, 0 },
+    { 0x04117219031148a0ULL, 104, 0 },
+    { 0x001c70b0d1924820ULL, 160, 0 },
+    { 0x041c5180d39248a0ULL, 201, 0 },
+    { 0x0099002900324920ULL, 303, 0 },
+    { 0x002461b053524920ULL, 313, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00c430310c514820ULL, 40, 0 },
+    { 0x04110a0883914920ULL, 157, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x000942184a90c920ULL, 189, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00d9303308324824ULL, 218, 2 },
+    { 0x00187210c1904824ULL, 293, 1 },
+    { 0x00e121884450c920ULL, 387, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x024112091a50c860ULL, 119, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x06442e110851c920ULL, 475, 2 },
+    { 0x004972225290c824ULL, 344, 1 },
+    { 0x00dc70b11c31c820ULL, 43, 0 },
+    { 0x021c661103314920ULL, 450, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x001b1206c290c824ULL, 335, 1 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00a4323053514820ULL, 69, 1 },
+    { 0x000962385290c920ULL, 172, 3 },
+    { 0x008c42111a70c920ULL, 473, 2 },
+    { 0x068c3031147148e0ULL, 36, 2 },
+    { 0x040451100a9248a0ULL, 184, 0 },
+    { 0x00e170321c314824ULL, 402, 3 },
+    { 0x005b61171c304924ULL, 173, 2 },
+    { 0x04843131145048a0ULL, 37, 0 },
+    { 0x009b01371c304924ULL, 186, 2 },
+    { 0x0080102100524824ULL, 231, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x009b211704304924ULL, 152, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00db310702324824ULL, 242, 2 },
+    { 0x0093323693914824ULL, 330, 1 },
+    { 0x04047130129248a0ULL, 179, 0 },
+    { 0x00d9500318324824ULL, 261, 2 },
+    { 0x006101885c50c920ULL, 374, 0 },
+    { 0x00e031808470c824ULL, 407, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x005100a909124920ULL, 292, 0 },
+    { 0x008350a711524824ULL, 262, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x002050900c31c824ULL, 373, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x024172291250c860ULL, 95, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00db51270a324824ULL, 241, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0050310112124824ULL, 267, 2 },
+    { 0x00e051a08c70c824ULL, 376, 3 },
+    { 0x006412208a70c820ULL, 82, 1 },
+    { 0x00246090c1124920ULL, 333, 2 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x00204210c9104924ULL, 217, 3 },
+    { 0x002070b01431c824ULL, 410, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x04d14a089b914920ULL, 199, 3 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0000000000000000ULL, 0, 0 },
+    { 0x0051122289904824ULL, 332, 1 },
+    { 0x005461109c904920ULL, 273, 0 },
+    { 0x00e330864451c824ULL, 406, 3 },
+    { 0x00a3502694714824ULL, 404, 3 },
+    { 0x065c11210c3048e0ULL, 28, 2 },
+};
+
+const LastLayerTable lastLayerTables[NUM_OF_LAST_LAYER_SETS] = {
+    { ollEntries, 7, ollCases, 58 },
+    { pllEntries, 6, pllCases, 22 },
+    { zbllEntries, 10, zbllCases, 494 },
+};
@@ -0,0 +1,101 @@
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "latency.h"
+
+#define LATENCY_NUM_BUCKETS     10     // Histogram buckets: under 1 ms, then doubling up to 256 ms and over.
+#define LATENCY_BAR_LENGTH      40     // Characters in the longest bar of a histogram.
+
+struct PendingInput {
+    int kind;
+    double inputTime;
+};
+
+static PendingInput pendingInputs[LATENCY_MAX_PENDING];
+static int numPendingInputs = 0;
+
+// Every latency measured, in milliseconds.
+static std::vector<double> latencies[NUM_OF_LATENCY_KINDS];
+
+double LatencyNow()
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() + 1.0;
+}
+
+void LatencyInputApplied(int kind, double inputTime)
+{
+    if (inputTime == 0.0)
+        return;
+    // Nothing has been swapped for a while (e.g. the window is hidden). Those inputs' latency
+    // would say more about the window than the viewer, so the oldest is forgotten.
+    if (numPendingInputs == LATENCY_MAX_PENDING) {
+        std::copy(pendingInputs + 1, pendingInputs + numPendingInputs, pendingInputs);
+        numPendingInputs--;
+    }
+    pendingInputs[numPendingInputs].kind = kind;
+    pendingInputs[numPendingInputs].inputTime = inputTime;
+    numPendingInputs++;
+}
+
+void LatencyFrameSwapped()
+{
+    if (numPendingInputs == 0)
+        return;
+    double now = LatencyNow();
+    for (int i = 0; i < numPendingInputs; i++) {
+        latencies[pendingInputs[i].kind].push_back((now - pendingInputs[i].inputTime) / 1000.0);
+    }
+    numPendingInputs = 0;
+}
+
+double LatencyPercentile(int kind, double percentile)
+{
+    if (latencies[kind].empty())
+        return -1.0;
+    std::vector<double> sorted = latencies[kind];
+    size_t index = (size_t)(percentile / 100.0 * (sorted.size() - 1) + 0.5);
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+void PrintLatencyReport(void)
+{
+    const char* kindNames[NUM_OF_LATENCY_KINDS] = { "Moves", "Camera" };
+
+    printf("--------------LATENCY--------------\n");
+    for (int kind = 0; kind < NUM_OF_LATENCY_KINDS; kind++) {
+        const std::vector<double>& samples = latencies[kind];
+        if (samples.empty()) {
+            printf("%s: no inputs\n", kindNames[kind]);
+            continue;
+        }
+        printf("%s: %d inputs, p50 %.1f ms, p99 %.1f ms, max %.1f ms\n", kindNames[kind], (int)samples.size(),
+               LatencyPercentile(kind, 50.0), LatencyPercentile(kind, 99.0), *std::max_element(samples.begin(), samples.end()));
+
+        int counts[LATENCY_NUM_BUCKETS] = { 0 };
+        for (size_t i = 0; i < samples.size(); i++) {
+            int bucket = 0;
+            for (double limit = 1.0; bucket < LATENCY_NUM_BUCKETS - 1 && samples[i] >= limit; limit *= 2.0) {
+                bucket++;
+            }
+            counts[bucket]++;
+        }
+        int largest = *std::max_element(counts, counts + LATENCY_NUM_BUCKETS);
+        for (int bucket = 0; bucket < LATENCY_NUM_BUCKETS; bucket++) {
+            char range[32];
+            if (bucket == 0)
+                snprintf(range, sizeof(range), "< 1 ms");
+            else if (bucket == LATENCY_NUM_BUCKETS - 1)
+                snprintf(range, sizeof(range), ">= %d ms", 1 << (bucket - 1));
+            else
+                snprintf(range, sizeof(range), "%d-%d ms", 1 << (bucket - 1), 1 << bucket);
+            int length = (counts[bucket] * LATENCY_BAR_LENGTH + largest - 1) / largest;
+            printf("  %-10s %6d %.*s\n", range, counts[bucket], length, "########################################");
+        }
+    }
+    printf("-----------------------------------\n");
+}
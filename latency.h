@@ -0,0 +1,33 @@
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////
+// INPUT LATENCY
+//
+// Measures the time from a key press to the swap of the first frame that
+// shows its effect. The viewer timestamps every input, carries the stamp
+// along with whatever the input queued (e.g. a move waiting for an earlier
+// animation), reports when the effect is applied, and reports every swap.
+/////////////////////////////////////////////////////////////////////////////
+
+#define LATENCY_MOVE            0      // Turning a face or rotating the cube.
+#define LATENCY_CAMERA          1      // Moving the eye.
+#define NUM_OF_LATENCY_KINDS    2
+
+#define LATENCY_MAX_PENDING     64     // Most inputs applied but not yet swapped to the screen.
+
+// Current time in microseconds, for timestamping inputs. Never 0, which means no input.
+double LatencyNow();
+
+// Reports that the effect of an input made at inputTime is in the state the next frame
+// will show. Inputs with an inputTime of 0 (e.g. moves read from a file) are ignored.
+void LatencyInputApplied(int kind, double inputTime);
+
+// Reports that a frame was swapped, which completes every applied input.
+void LatencyFrameSwapped();
+
+// The given percentile of the latencies of a LATENCY_ kind, in milliseconds, or -1 if none
+// were measured.
+double LatencyPercentile(int kind, double percentile);
+
+// Prints histograms of the measured latencies.
+void PrintLatencyReport(void);
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+
+/////////////////////////////////////////////////////////////////////////////
+// LOCK-FREE QUEUES AND BUFFERS
+/////////////////////////////////////////////////////////////////////////////
+
+// A bounded queue that any number of threads may push to and pop from without locking.
+// Every cell carries a sequence number saying whose turn it is to use it (Vyukov's design).
+// Capacity must be a power of two.
+template <typename T, size_t Capacity>
+class LockFreeQueue {
+public:
+    LockFreeQueue()
+    {
+        for (size_t i = 0; i < Capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    // Adds a value to the back of the queue. Returns false if the queue is full.
+    bool Push(const T& value)
+    {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & (Capacity - 1)];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Removes the value at the front of the queue. Returns false if the queue is empty.
+    bool Pop(T& value)
+    {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & (Capacity - 1)];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = cell->value;
+        cell->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static_assert((Capacity & (Capacity - 1)) == 0, "LockFreeQueue capacity must be a power of two");
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    Cell cells[Capacity];
+    alignas(64) std::atomic<size_t> enqueuePos;     // Kept on separate cache lines so producers
+    alignas(64) std::atomic<size_t> dequeuePos;     // and consumers don't contend.
+};
+
+// A bounded queue for exactly one pushing thread and one popping thread. Each side owns its own
+// index and only reads the other's, so a push or pop is a couple of loads and one release store.
+// Capacity must be a power of two.
+template <typename T, size_t Capacity>
+class SpscQueue {
+public:
+    SpscQueue()
+    {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+    // Adds a value to the back of the queue. Only call from the producer. Returns false if the queue is full.
+    bool Push(const T& value)
+    {
+        size_t back = tail.load(std::memory_order_relaxed);
+        if (back - head.load(std::memory_order_acquire) == Capacity)
+            return false;
+        cells[back & (Capacity - 1)] = value;
+        tail.store(back + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Removes the value at the front of the queue. Only call from the consumer. Returns false if the queue is empty.
+    bool Pop(T& value)
+    {
+        size_t front = head.load(std::memory_order_relaxed);
+        if (front == tail.load(std::memory_order_acquire))
+            return false;
+        value = cells[front & (Capacity - 1)];
+        head.store(front + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static_assert((Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+    T cells[Capacity];
+    alignas(64) std::atomic<size_t> head;       // Next cell to pop, written by the consumer.
+    alignas(64) std::atomic<size_t> tail;       // Next cell to push, written by the producer.
+};
+
+// Hands the latest version of a value from one writing thread to one reading thread. The writer fills
+// its back buffer and publishes it; the reader takes the most recently published buffer. Neither ever
+// waits for the other, and versions published while the reader wasn't looking are skipped.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer()
+    {
+        back = 0;
+        middle.store(1, std::memory_order_relaxed);
+        front = 2;
+    }
+
+    // The buffer the writer fills. Only call from the writer.
+    T& Back() { return buffers[back]; }
+
+    // Makes the back buffer the latest version, and gives the writer a new back buffer. Returns false if
+    // the version published before it was never read.
+    bool Publish()
+    {
+        int previous = middle.exchange(back | FRESH, std::memory_order_acq_rel);
+        back = previous & ~FRESH;
+        return (previous & FRESH) == 0;
+    }
+
+    // Takes the latest published version, if there is a newer one than the reader has. Only call from the reader.
+    bool Update()
+    {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0)
+            return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & ~FRESH;
+        return true;
+    }
+
+    // The version the reader has. Only call from the reader.
+    const T& Front() const { return buffers[front]; }
+
+private:
+    static const int FRESH = 4;         // Set on middle when it holds a version the reader hasn't taken.
+
+    T buffers[3];
+    int back;                           // Only used by the writer.
+    alignas(64) std::atomic<int> middle;
+    alignas(64) int front;              // Only used by the reader.
+};
@@ -1,33 +1,47 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 #ifdef __APPLE__
 #define GL_SILENCE_DEPRECATION
 #include <GLUT/glut.h>
+#include <dlfcn.h>
 #else
 #include <GL/glut.h>
+#include <GL/freeglut_ext.h>
 #endif
 
-/////////////////////////////////////////////////////////////////////////////
-// INDEXING OF CUBE
-//         ---------
-//         | 0 1 2 |
-//         | 3 4 5 |
-//         | 6 7 8 |
-// ---------------------------------
-// | 0 1 2 | 0 1 2 | 0 1 2 | 0 1 2 |
-// | 3 4 5 | 3 4 5 | 3 4 5 | 3 4 5 |
-// | 6 7 8 | 6 7 8 | 6 7 8 | 6 7 8 |
-// ---------------------------------
-//         | 0 1 2 |
-//         | 3 4 5 |
-//         | 6 7 8 |
-//         ---------
-// 
-/////////////////////////////////////////////////////////////////////////////
-
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
+#include "anytime.h"
+#include "capture.h"
+#include "cfop.h"
+#include "cube.h"
+#include "enumerate.h"
+#include "history.h"
+#include "hud.h"
+#include "image.h"
+#include "latency.h"
+#include "matrix.h"
+#include "offscreen.h"
+#include "optimize.h"
+#include "pocket.h"
+#include "puzzle.h"
+#include "script.h"
+#include "search.h"
+#include "session.h"
+#include "simulation.h"
+#include "subgroup.h"
+#include "trace.h"
 
 /////////////////////////////////////////////////////////////////////////////
 // CONSTANTS
@@ -35,31 +49,6 @@
 
 #define PI                  3.1415926535897932384626433832795
 
-#define NUM_OF_FACES            6      // Number of Faces on the Cube.
-#define NUM_OF_SQUARES          9      // Number of Squares on the Face of a Cube.
-
-#define ANTI_CLOCKWISE          1      // Anitclockwise direction.
-#define CLOCKWISE               -1     // Clockwise direction.
-
-#define FACE_NONE               -1
-#define FACE_UP                 0      // The Up Face of the Cube.
-#define FACE_FRONT              1      // The Front Face of the Cube.
-#define FACE_RIGHT              2      // The Right Face of the Cube.
-#define FACE_BACK               3      // The Back Face of the Cube.
-#define FACE_LEFT               4      // The Left Face of the Cube.
-#define FACE_DOWN               5      // The Down Face of the Cube.
-
-#define WHITE                   0      // The index for the color White.
-#define GREEN                   1      // The index for the color Green.
-#define RED                     2      // The index for the color Red.
-#define BLUE                    3      // The index for the color Blue.
-#define ORANGE                  4      // The index for the color Orange.
-#define YELLOW                  5      // The index for the color Yellow.
-
-#define X_AXIS                  0      // The x-axis of the cube
-#define Y_AXIS                  1      // The x-axis of the cube
-#define Z_AXIS                  2      // The x-axis of the cube
-
 #define CUBE_LENGTH_HALVED      95.0   // Half of the length of the Cube.
 #define SQUARE_LENGTH_HALVED    30.0   // Half of the length of the Sqaures.
 #define SQUARE_TRANSLATE_DIST   (2 * SQUARE_LENGTH_HALVED + 5.0)    // Distance to translate the Sqaure away from the center of the Cube Face.
@@ -78,8 +67,30 @@
 #define VERT_FOV                45.0                            // Vertical FOV (in degrees) of the perspective camera.
 
 #define DESIRED_FPS             60                              // Approximate desired number of frames per second.
-#define NUM_OF_FRAMES           10                               // Number of frames in an animation.
-#define CUBE_ANGLE_INCR         (90.0 / (double) NUM_OF_FRAMES) // Amount of angle increment per frame.
+
+#define DIRTY_CAMERA            1       // The eye position or projection changed.
+#define DIRTY_STATE             2       // The stickers of the cube changed.
+#define DIRTY_ANIMATION         4       // An animation advanced to its next frame.
+#define DIRTY_SETTINGS          8       // A drawing setting (wireframe, culling, axes, colours) changed.
+#define DIRTY_WINDOW            16      // The window was resized.
+#define DIRTY_RECORDING         32      // A frame is due while recording.
+#define DIRTY_HUD               64      // The performance HUD was toggled or is due a refresh.
+#define DIRTY_SOLVER            128     // The background solver's status line changed.
+#define NUM_OF_DIRTY_REASONS    8       // Number of DIRTY_ flags.
+
+#define HUD_REFRESH_INTERVAL    500     // Milliseconds between redraws of the HUD while nothing else changes.
+#define SIMULATION_POLL_INTERVAL 2      // Milliseconds between checks for new snapshots while the simulation is busy.
+#define SOLVER_POLL_INTERVAL    100     // Milliseconds between checks of the background solver.
+#define SOLVER_STATUS_LENGTH    32
+
+#define BENCH_SCRIPT_FRAMES     600     // Frames ticked by --bench-scripts.
+#define BENCH_SOLVE_SEED        1       // Seed of the first scramble solved by --bench-solve.
+#define BENCH_SUBGROUP_MOVES    40      // Random moves of each scramble solved by --bench-subgroup.
+#define BENCH_PUZZLE_MOVES      6       // Random moves of each scramble --bench-puzzle solves when random states would take too long.
+#define BENCH_SESSION_MAX_GAP   5000    // Most milliseconds between the events --bench-session records.
+
+#define REPLAY_SKIP_TIME        5000    // Milliseconds '[' and ']' skip a replay by.
+#define REPLAY_LABEL_LENGTH     32
 
 // Transformation Matrix Values
 const GLdouble squareTranslateDistances[NUM_OF_SQUARES][3] = { { -SQUARE_TRANSLATE_DIST, SQUARE_TRANSLATE_DIST, 0.0 },
@@ -99,12 +110,25 @@ const GLdouble faceRotationValues[NUM_OF_FACES][4] = { { -90.0, 1.0, 0.0, 0.0 },
                                                        { -90.0, 0.0, 1.0, 0.0 },
                                                        { 90.0, 1.0, 0.0, 0.0 } };
 
-const GLdouble squareRotationValues[NUM_OF_FACES][NUM_OF_FACES][3] = { {{ 0.0, 1.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 1.0, 0.0 }},
-                                                                        {{ 0.0, -1.0, 0.0 }, { 0.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }},
-                                                                        {{ 1.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }},
-                                                                        {{ 0.0, 1.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0 }, { 0.0, -1.0, 0.0 }},
-                                                                        {{ -1.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0 }},
-                                                                        {{ 0.0, -1.0, 0.0 }, { 0.0, -1.0, 0.0 }, { 0.0, -1.0, 0.0 }, { 0.0, -1.0, 0.0 }, { 0.0, -1.0, 0.0 }, { 0.0, -1.0, 0.0 }} };
+// The axis each turn's layers rotate about, pointing out of the face they turn like.
+const GLdouble turnRotationValues[NUM_OF_TURNS][3] = { { 0.0, 1.0, 0.0 },        // U
+                                                       { 0.0, 0.0, 1.0 },        // F
+                                                       { 1.0, 0.0, 0.0 },        // R
+                                                       { 0.0, 0.0, -1.0 },       // B
+                                                       { -1.0, 0.0, 0.0 },       // L
+                                                       { 0.0, -1.0, 0.0 },       // D
+                                                       { -1.0, 0.0, 0.0 },       // M
+                                                       { 0.0, -1.0, 0.0 },       // E
+                                                       { 0.0, 0.0, 1.0 },        // S
+                                                       { 0.0, 1.0, 0.0 },        // Uw
+                                                       { 0.0, 0.0, 1.0 },        // Fw
+                                                       { 1.0, 0.0, 0.0 },        // Rw
+                                                       { 0.0, 0.0, -1.0 },       // Bw
+                                                       { -1.0, 0.0, 0.0 },       // Lw
+                                                       { 0.0, -1.0, 0.0 },       // Dw
+                                                       { 1.0, 0.0, 0.0 },        // x
+                                                       { 0.0, 1.0, 0.0 },        // y
+                                                       { 0.0, 0.0, 1.0 } };      // z
 
 // Cube color.
 const GLubyte cubeColor[NUM_OF_FACES][3] = { { 255, 255, 255 },
@@ -137,463 +161,276 @@ bool backfaceCulling = true;
 bool drawWireframe = false; // Draw polygons in wireframe if true, otherwise polygons are filled.
 bool drawAxes = false;       // Draw world coordinate frame axes if true.
 
-// For animating cube rotations
-bool playingAnimation = false;
-int frameNumber = 0;
-int rotatingFace = -1;
-int rotatingDirection;
 bool colourOverride = false;
 
-// The Cube
-int cube[NUM_OF_FACES][NUM_OF_SQUARES];
+// Whether snapshots are being checked for while the simulation is busy.
+bool pollingSimulation = false;
+
+// Render on demand. A frame is only drawn when one of the DIRTY_ flags has been raised.
+unsigned int dirtyFlags = 0;
+bool windowVisible = true;
+
+// Redraw statistics, reported on exit when measuring redraws.
+bool measureRedraws = false;
+int measureStartTime = 0;           // GLUT_ELAPSED_TIME at which measuring started (ms).
+int framesRendered = 0;             // Calls to DisplayFunc.
+int framesNeeded = 0;               // Frames rendered because something changed.
+int redrawRequests = 0;             // Calls to MarkDirty.
+int dirtyReasonCounts[NUM_OF_DIRTY_REASONS] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+// Input latency.
+bool measureLatency = false;
+double keyPressTime = 0.0;          // LatencyNow() of the key press being handled.
+
+// Screenshots and recordings.
+const char* captureDir = ".";       // Directory the captured frames are written to.
+bool screenshotRequested = false;
+int screenshotNumber = 0;
+bool recording = false;
+int recordingNumber = 0;            // Recordings so far, used to name their frames.
+int recordingFrame = 0;             // Frames captured in the current recording.
+
+// Timeline tracing.
+const char* traceFile = NULL;       // File the trace is written to on exit, if any.
+int traceNumber = 0;                // Traces saved with the key so far.
+
+// Performance HUD.
+bool showHud = false;
+int hudNumber = 0;                  // Times the HUD was shown, to tell its refresh timers apart.
+
+// Session recording and replay.
+bool recordingSession = false;
+int sessionNumber = 0;              // Sessions recorded so far, used to name their files.
+double sessionStartTime = 0.0;      // LatencyNow() when the session started.
+SessionWriter sessionWriter;
+Session replaySession;
+bool replaying = false;             // Replaying a session with --replay; moves are ignored.
+bool scrubbing = false;             // The mouse is dragging the scrub bar.
+
+// Undo history of the moves posted to the simulation.
+MoveHistory history;
+bool showHistory = false;           // Show the history as a scrub bar.
+
+// Solution being played with F6, a move at a time.
+std::vector<Move> solutionMoves;
+bool playingSolution = false;
+size_t solutionMove = 0;            // The next move to post.
+int solutionNumber = 0;             // Solutions played so far, to tell their timers apart.
+
+// The anytime solver working on the cube in the background, and the status line it shows.
+double anytimeSeconds = ANYTIME_DEFAULT_TIME;
+bool backgroundSolving = false;
+PackedCube backgroundCube;          // The cube it was last given.
+char solverStatus[SOLVER_STATUS_LENGTH] = "";
+bool pollingSolver = false;         // Whether the solver is being checked on until it finishes.
+
+// Sticker transforms. Every sticker's model matrix is built once by InitStickerMatrices. The clip
+// coordinates of the sticker corners are kept between frames, and only the stickers of the turning
+// layers are transformed again while the camera stays put.
+double stickerMatrices[NUM_OF_FACES][NUM_OF_SQUARES][16];
+bool stickerTurned[NUM_OF_FACES][NUM_OF_SQUARES];      // The cached corners include a layer rotation.
+double cachedViewProjection[16];
+bool cachedColourOverride = false;
+bool stickerCornersValid = false;
+GLfloat stickerCorners[NUM_OF_STICKERS * 4][4];
+GLubyte stickerColors[NUM_OF_STICKERS * 4][3];
+bool useImmediateDrawing = false;   // Draw with the matrix stack instead, for --bench-render.
 
 /////////////////////////////////////////////////////////////////////////////
-// CUBE FUNCTIONS
+// REDRAW FUNCTIONS
 /////////////////////////////////////////////////////////////////////////////
 
-void PrintCube()
+// Records why the displayed frame is out of date, and schedules a redraw if one isn't already pending.
+// While the window is hidden the redraw is held back until it becomes visible again.
+void MarkDirty(unsigned int flags)
 {
-    /*
-        printf("---------START---------\n");
-        for (int face = 0; face < NUM_OF_FACES; face++) {
-            printf("---FACE %d---", face);
-            for (int square = 0; square < NUM_OF_SQUARES; square++) {
-                if (square % 3 == 0)
-                    printf("\n");
-                printf("%d ", cube[face][square]);
-            }
-            printf("\n");
-        }
-        printf("---------END---------\n");
-        */
-    printf("--------------START--------------\n");
-    // printing FACE_UP
-    for (int i = 0; i < 8; i++) {
-        printf("- ");
-    }
-    for (int square = 0; square < NUM_OF_SQUARES; square++) {
-        if (square % 3 == 0)
-            printf("\n- - - | ");
-        printf("%d ", cube[FACE_UP][square]);
-        if ((square + 1) % 3 == 0)
-            printf("|");
-    }
-    printf("\n");
+    redrawRequests++;
+    if (dirtyFlags == 0 && windowVisible)
+        glutPostRedisplay();
+    dirtyFlags |= flags;
+}
 
-    // printing FACE_LEFT, FACE_FRONT, FACE_RIGHT, FACE_BACK
-    for (int i = 0; i < 16; i++) {
-        printf("- ");
-    }
-    for (int i = 0; i < 3; i++) {
-        printf("\n");
-        for (int j = 0; j < 3; j++) {
-            printf("%d ", cube[FACE_LEFT][i * 3 + j]);
-        }
-        printf("| ");
-        for (int j = 0; j < 3; j++) {
-            for (int k = 0; k < 3; k++) {
-                printf("%d ", cube[FACE_FRONT + j][i * 3 + k]);
-            }
-            printf("| ");
-        }
-    }
-    printf("\n");
-    for (int i = 0; i < 16; i++) {
-        printf("- ");
+// Print how many frames were rendered against how many were actually needed.
+void PrintRedrawReport(void)
+{
+    const char* reasonNames[NUM_OF_DIRTY_REASONS] = { "camera", "state", "animation", "settings", "window", "recording", "hud", "solver" };
+    double seconds = (glutGet(GLUT_ELAPSED_TIME) - measureStartTime) / 1000.0;
+
+    printf("--------------REDRAWS--------------\n");
+    printf("Session length:      %.1f s\n", seconds);
+    printf("Frames rendered:     %d\n", framesRendered);
+    printf("Frames needed:       %d\n", framesNeeded);
+    for (int i = 0; i < NUM_OF_DIRTY_REASONS; i++) {
+        printf("  %-18s %d\n", reasonNames[i], dirtyReasonCounts[i]);
     }
+    printf("Unrequested frames:  %d\n", framesRendered - framesNeeded);
+    printf("Redraw requests:     %d (%d merged into a pending frame)\n", redrawRequests, redrawRequests - framesNeeded);
+    printf("Continuous %d fps:   %d frames\n", DESIRED_FPS, (int)(seconds * DESIRED_FPS));
+    printf("-----------------------------------\n");
+}
 
-    //printing FACE_DOWN
-    for (int square = 0; square < NUM_OF_SQUARES; square++) {
-        if (square % 3 == 0)
-            printf("\n- - - | ");
-        printf("%d ", cube[FACE_DOWN][square]);
-        if ((square + 1) % 3 == 0)
-            printf("|");
-    }
-    printf("\n");
-    for (int i = 0; i < 8; i++) {
-        printf("- ");
-    }
-    printf("\n");
-    printf("---------------END---------------\n");
+/////////////////////////////////////////////////////////////////////////////
+// DRAWING FUNCTIONS
+/////////////////////////////////////////////////////////////////////////////
+
+// Draw a Square based on the given colour.
+void DrawSquare(const GLubyte* squareColor)
+{
+    glColor3ubv(squareColor);
+    glBegin(GL_POLYGON);
+    glVertex3d(-SQUARE_LENGTH_HALVED, -SQUARE_LENGTH_HALVED, 0);
+    glVertex3d(SQUARE_LENGTH_HALVED, -SQUARE_LENGTH_HALVED, 0);
+    glVertex3d(SQUARE_LENGTH_HALVED, SQUARE_LENGTH_HALVED, 0);
+    glVertex3d(-SQUARE_LENGTH_HALVED, SQUARE_LENGTH_HALVED, 0);
+    glEnd();
 }
 
-// Initializes the cube in the solved state.
-void InitCube() {
+// Builds the model matrix of every sticker from faceRotationValues and squareTranslateDistances.
+void InitStickerMatrices()
+{
     for (int face = 0; face < NUM_OF_FACES; face++) {
+        double faceMatrix[16];
+        MatrixRotation(faceRotationValues[face][0], faceRotationValues[face][1], faceRotationValues[face][2], faceRotationValues[face][3], faceMatrix);
         for (int square = 0; square < NUM_OF_SQUARES; square++) {
-            cube[face][square] = face;
+            double translation[16], squareMatrix[16];
+            MatrixTranslation(squareTranslateDistances[square][0], squareTranslateDistances[square][1], squareTranslateDistances[square][2] + CUBE_LENGTH_HALVED, translation);
+            MatrixMultiply(faceMatrix, translation, squareMatrix);
+            memcpy(stickerMatrices[face][square], squareMatrix, sizeof(squareMatrix));
         }
     }
+    stickerCornersValid = false;
 }
 
-// Rotate a single face (face rotation is using FACE_UP)
-void RotateFace() {
-    int orderOfFaceRotation[4] = { FACE_FRONT, FACE_RIGHT, FACE_BACK, FACE_LEFT };
-    int temp[] = { cube[orderOfFaceRotation[0]][0], cube[orderOfFaceRotation[0]][1], cube[orderOfFaceRotation[0]][2] };
-    for (int i = 0; i < 3; i++) {
-        if (rotatingDirection == CLOCKWISE) {
-            for (int j = 0; j < 3; j++) {
-                cube[orderOfFaceRotation[j]][i] = cube[orderOfFaceRotation[j + 1]][i];
-            }
-            cube[orderOfFaceRotation[3]][i] = temp[i];
-        }
-        else if (rotatingDirection == ANTI_CLOCKWISE)
-        {
-            for (int j = 3; j > 0; j--) {
-                cube[orderOfFaceRotation[(j + 1) % 4]][i] = cube[orderOfFaceRotation[j]][i];
-            }
-            cube[orderOfFaceRotation[1]][i] = temp[i];
+// Stores the clip coordinates of a sticker's corners, given its model-view-projection matrix.
+void TransformStickerCorners(int face, int square, const double* modelViewProjection)
+{
+    const double cornerSigns[4][2] = { { -1.0, -1.0 }, { 1.0, -1.0 }, { 1.0, 1.0 }, { -1.0, 1.0 } };
+    double zOffset = colourOverride ? CUBE_LENGTH_HALVED * 0.05 : 0.0;
+    int first = (face * NUM_OF_SQUARES + square) * 4;
+    for (int corner = 0; corner < 4; corner++) {
+        double clip[4];
+        MatrixTransformPoint(modelViewProjection, cornerSigns[corner][0] * SQUARE_LENGTH_HALVED, cornerSigns[corner][1] * SQUARE_LENGTH_HALVED, zOffset, clip);
+        for (int i = 0; i < 4; i++) {
+            stickerCorners[first + corner][i] = (GLfloat)clip[i];
         }
     }
+}
 
-    int tempFace[NUM_OF_SQUARES] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    for (int i = 0; i < NUM_OF_SQUARES; i++) {
-        tempFace[i] = cube[FACE_UP][i];
-    }
-
-    if (rotatingDirection == CLOCKWISE) {
-        cube[FACE_UP][0] = tempFace[6];
-        cube[FACE_UP][1] = tempFace[3];
-        cube[FACE_UP][2] = tempFace[0];
-        cube[FACE_UP][3] = tempFace[7];
-        cube[FACE_UP][4] = tempFace[4];
-        cube[FACE_UP][5] = tempFace[1];
-        cube[FACE_UP][6] = tempFace[8];
-        cube[FACE_UP][7] = tempFace[5];
-        cube[FACE_UP][8] = tempFace[2];
-    }
-    else if (rotatingDirection == ANTI_CLOCKWISE) {
-        cube[FACE_UP][0] = tempFace[2];
-        cube[FACE_UP][1] = tempFace[5];
-        cube[FACE_UP][2] = tempFace[8];
-        cube[FACE_UP][3] = tempFace[1];
-        cube[FACE_UP][4] = tempFace[4];
-        cube[FACE_UP][5] = tempFace[7];
-        cube[FACE_UP][6] = tempFace[0];
-        cube[FACE_UP][7] = tempFace[3];
-        cube[FACE_UP][8] = tempFace[6];
+// Builds the rotation from the cube's own axes to how it is held in the given orientation.
+void CubeOrientationMatrix(int orientation, double m[16])
+{
+    int rotation[3][3];
+    OrientationMatrix(orientation, rotation);
+    MatrixIdentity(m);
+    for (int row = 0; row < 3; row++) {
+        for (int column = 0; column < 3; column++) {
+            m[column * 4 + row] = rotation[row][column];
+        }
     }
 }
 
-// Rotate the entire cube orientation
-void RotateCube(int axis, int direction) {
-    int tempFace[NUM_OF_SQUARES];
-    int orderOfFaceRotation[4] = {0, 0, 0, 0};
-    int currFace = 0;
-    switch (axis)
-    {
-    case X_AXIS:
-        // 4 main faces
-        orderOfFaceRotation[0] = FACE_BACK; 
-        orderOfFaceRotation[1] = FACE_UP; 
-        orderOfFaceRotation[2] = FACE_FRONT; 
-        orderOfFaceRotation[3] = FACE_DOWN;
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            tempFace[i] = cube[orderOfFaceRotation[0]][NUM_OF_SQUARES - (i + 1)];
-        }
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            if (direction == CLOCKWISE) {
-                cube[orderOfFaceRotation[0]][NUM_OF_SQUARES - (i + 1)] = cube[orderOfFaceRotation[1]][i];
-                for (int j = 1; j < 3; j++) {
-                    cube[orderOfFaceRotation[j]][i] = cube[orderOfFaceRotation[j + 1]][i];
-                }
-                cube[orderOfFaceRotation[3]][i] = tempFace[i];
-            }
-            else if (direction == ANTI_CLOCKWISE) {
-                cube[orderOfFaceRotation[0]][NUM_OF_SQUARES - (i + 1)] = cube[orderOfFaceRotation[3]][i];
-                for (int j = 2; j > 0; j--) {
-                    cube[orderOfFaceRotation[j + 1]][i] = cube[orderOfFaceRotation[j]][i];
-                }
-                cube[orderOfFaceRotation[1]][i] = tempFace[i];
+// Draw the entire Cube as a single array of quads, already transformed to clip coordinates.
+// The view projection includes the cube's orientation, so turning the whole cube redraws it as a camera move does.
+void DrawCube(const double* viewProjection, const CubeSnapshot& snapshot)
+{
+    TRACE_SCOPE("DrawCube");
+    double startTime = HudNow();
+
+    // Every corner has to be transformed again when the camera moved.
+    if (!stickerCornersValid || cachedColourOverride != colourOverride || memcmp(cachedViewProjection, viewProjection, sizeof(cachedViewProjection)) != 0) {
+        for (int face = 0; face < NUM_OF_FACES; face++) {
+            for (int square = 0; square < NUM_OF_SQUARES; square++) {
+                double modelViewProjection[16];
+                MatrixMultiply(viewProjection, stickerMatrices[face][square], modelViewProjection);
+                TransformStickerCorners(face, square, modelViewProjection);
+                stickerTurned[face][square] = false;
             }
         }
-        
-        // 2 remaining faces (the faces along the same axis)
-        if (direction == CLOCKWISE)
-            currFace = FACE_RIGHT;
-        else if (direction == ANTI_CLOCKWISE)
-            currFace = FACE_LEFT;
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            tempFace[i] = cube[currFace][i];
-        }
-        cube[currFace][0] = tempFace[6];
-        cube[currFace][1] = tempFace[3];
-        cube[currFace][2] = tempFace[0];
-        cube[currFace][3] = tempFace[7];
-        cube[currFace][4] = tempFace[4];
-        cube[currFace][5] = tempFace[1];
-        cube[currFace][6] = tempFace[8];
-        cube[currFace][7] = tempFace[5];
-        cube[currFace][8] = tempFace[2];
-
-
-        if (direction == CLOCKWISE)
-            currFace = FACE_LEFT;
-        else if (direction == ANTI_CLOCKWISE)
-            currFace = FACE_RIGHT;
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            tempFace[i] = cube[currFace][i];
-        }
-        cube[currFace][0] = tempFace[2];
-        cube[currFace][1] = tempFace[5];
-        cube[currFace][2] = tempFace[8];
-        cube[currFace][3] = tempFace[1];
-        cube[currFace][4] = tempFace[4];
-        cube[currFace][5] = tempFace[7];
-        cube[currFace][6] = tempFace[0];
-        cube[currFace][7] = tempFace[3];
-        cube[currFace][8] = tempFace[6];
-        break;
-    case Y_AXIS:
-        // 4 main faces
-        orderOfFaceRotation[0] = FACE_FRONT;
-        orderOfFaceRotation[1] = FACE_RIGHT;
-        orderOfFaceRotation[2] = FACE_BACK;
-        orderOfFaceRotation[3] = FACE_LEFT;
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            tempFace[i] = cube[orderOfFaceRotation[0]][i];
-        }
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            if (direction == CLOCKWISE) {
-                for (int j = 0; j < 3; j++) {
-                    cube[orderOfFaceRotation[j]][i] = cube[orderOfFaceRotation[j + 1]][i];
-                }
-                cube[orderOfFaceRotation[3]][i] = tempFace[i];
+        memcpy(cachedViewProjection, viewProjection, sizeof(cachedViewProjection));
+        cachedColourOverride = colourOverride;
+        stickerCornersValid = true;
+    }
+
+    // Otherwise only the turning layers change, plus the stickers they left behind when they stopped.
+    // Every turning sticker shares the one rotation, whichever layers turn.
+    int rotatingTurn = snapshot.rotatingTurn;
+    // A half turn's direction is -2, so it sweeps 180 degrees in the frames a quarter turn takes.
+    double angle = ((double)snapshot.rotatingDirection * snapshot.frameNumber) * (90.0 / snapshot.animationFrames);
+    bool turning = (rotatingTurn != TURN_NONE && snapshot.frameNumber != 0);
+    double layerViewProjection[16];
+    if (turning) {
+        double rotation[16];
+        MatrixRotation(angle, turnRotationValues[rotatingTurn][0], turnRotationValues[rotatingTurn][1], turnRotationValues[rotatingTurn][2], rotation);
+        MatrixMultiply(viewProjection, rotation, layerViewProjection);
+    }
+    for (int face = 0; face < NUM_OF_FACES; face++) {
+        for (int square = 0; square < NUM_OF_SQUARES; square++) {
+            bool inLayer = turning && IsStickerTurning(rotatingTurn, face, square);
+            if (!inLayer && !stickerTurned[face][square])
+                continue;
+
+            double modelViewProjection[16];
+            if (inLayer) {
+                MatrixMultiply(layerViewProjection, stickerMatrices[face][square], modelViewProjection);
             }
-            else if (direction == ANTI_CLOCKWISE)
-            {
-                for (int j = 3; j > 0; j--) {
-                    cube[orderOfFaceRotation[(j + 1) % 4]][i] = cube[orderOfFaceRotation[j]][i];
-                }
-                cube[orderOfFaceRotation[1]][i] = tempFace[i];
+            else {
+                MatrixMultiply(viewProjection, stickerMatrices[face][square], modelViewProjection);
             }
+            TransformStickerCorners(face, square, modelViewProjection);
+            stickerTurned[face][square] = inLayer;
         }
+    }
 
-        // 2 remaining faces (the faces along the same axis)
-        if (direction == CLOCKWISE)
-            currFace = FACE_UP;
-        else if (direction == ANTI_CLOCKWISE)
-            currFace = FACE_DOWN;
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            tempFace[i] = cube[currFace][i];
-        }
-        cube[currFace][0] = tempFace[6];
-        cube[currFace][1] = tempFace[3];
-        cube[currFace][2] = tempFace[0];
-        cube[currFace][3] = tempFace[7];
-        cube[currFace][4] = tempFace[4];
-        cube[currFace][5] = tempFace[1];
-        cube[currFace][6] = tempFace[8];
-        cube[currFace][7] = tempFace[5];
-        cube[currFace][8] = tempFace[2];
-
-
-        if (direction == CLOCKWISE)
-            currFace = FACE_DOWN;
-        else if (direction == ANTI_CLOCKWISE)
-            currFace = FACE_UP;
-        for (int i = 0; i < NUM_OF_SQUARES; i++) {
-            tempFace[i] = cube[currFace][i];
+    for (int face = 0; face < NUM_OF_FACES; face++) {
+        for (int square = 0; square < NUM_OF_SQUARES; square++) {
+            const GLubyte* color = colourOverride ? overrideColor : cubeColor[snapshot.cube.stickers[face][square]];
+            int first = (face * NUM_OF_SQUARES + square) * 4;
+            for (int corner = 0; corner < 4; corner++) {
+                memcpy(stickerColors[first + corner], color, 3);
+            }
         }
-        cube[currFace][0] = tempFace[2];
-        cube[currFace][1] = tempFace[5];
-        cube[currFace][2] = tempFace[8];
-        cube[currFace][3] = tempFace[1];
-        cube[currFace][4] = tempFace[4];
-        cube[currFace][5] = tempFace[7];
-        cube[currFace][6] = tempFace[0];
-        cube[currFace][7] = tempFace[3];
-        cube[currFace][8] = tempFace[6];
-        break;
     }
-}
 
-// Update the cube's state from the given move.
-void UpdateCube()
-{
-    switch (rotatingFace)
-    {
-    case FACE_UP:
-        RotateFace();
-        break;
-    case FACE_FRONT:
-        RotateCube(X_AXIS, CLOCKWISE);
-        RotateFace();
-        RotateCube(X_AXIS, ANTI_CLOCKWISE);
-        break;
-    case FACE_RIGHT:
-        RotateCube(Y_AXIS, CLOCKWISE);
-        RotateCube(X_AXIS, CLOCKWISE);
-        RotateFace();
-        RotateCube(X_AXIS, ANTI_CLOCKWISE);
-        RotateCube(Y_AXIS, ANTI_CLOCKWISE);
-        break;
-    case FACE_BACK:
-        RotateCube(X_AXIS, ANTI_CLOCKWISE);
-        RotateFace();
-        RotateCube(X_AXIS, CLOCKWISE);
-        break;
-    case FACE_LEFT:
-        RotateCube(Y_AXIS, ANTI_CLOCKWISE);
-        RotateCube(X_AXIS, CLOCKWISE);
-        RotateFace();
-        RotateCube(X_AXIS, ANTI_CLOCKWISE);
-        RotateCube(Y_AXIS, CLOCKWISE);
-        break;
-    case FACE_DOWN:
-        RotateCube(X_AXIS, CLOCKWISE);
-        RotateCube(X_AXIS, CLOCKWISE);
-        RotateFace();
-        RotateCube(X_AXIS, ANTI_CLOCKWISE);
-        RotateCube(X_AXIS, ANTI_CLOCKWISE);
-        break;
-    default:
-        break;
-    }
-}
+    double drawStartTime = HudNow();
+    HudAddPhaseTime(HUD_PHASE_MATRICES, drawStartTime - startTime);
 
-// Print the number of incorrect stickers (e.g. U move from solved state is 12 incorrect stickers)
-void PrintIncorrectCount()
-{
-    int incorrectCount = 0;
-    for (int i = 0; i < NUM_OF_FACES; i++) {
-        for (int j = 0; j < NUM_OF_SQUARES; j++) {
-            if (cube[i][j] != cube[i][4])
-                incorrectCount++;
-        }
-    }
-    printf("Incorrect count: %d\n", incorrectCount);
-}
+    // The corners are already in clip coordinates.
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
 
-// Checks if the current Square on the Face is affected by the current move.
-bool isRotating(int face, int square)
-{
-    switch (rotatingFace)
-    {
-    case FACE_UP:
-        switch (face)
-        {
-        case FACE_FRONT:
-            return (square == 0 || square == 1 || square == 2);
-        case FACE_RIGHT:
-            return (square == 0 || square == 1 || square == 2);
-        case FACE_BACK:
-            return (square == 0 || square == 1 || square == 2);
-        case FACE_LEFT:
-            return (square == 0 || square == 1 || square == 2);
-        }
-        break;
-    case FACE_FRONT:
-        switch (face)
-        {
-        case FACE_UP:
-            return (square == 6 || square == 7 || square == 8);
-        case FACE_LEFT:
-            return (square == 2 || square == 5 || square == 8);
-        case FACE_DOWN:
-            return (square == 0 || square == 1 || square == 2);
-        case FACE_RIGHT:
-            return (square == 0 || square == 3 || square == 6);
-        }
-        break;
-    case FACE_RIGHT:
-        switch (face)
-        {
-        case FACE_UP:
-            return (square == 2 || square == 5 || square == 8);
-        case FACE_FRONT:
-            return (square == 2 || square == 5 || square == 8);
-        case FACE_DOWN:
-            return (square == 2 || square == 5 || square == 8);
-        case FACE_BACK:
-            return (square == 0 || square == 3 || square == 6);
-        }
-        break;
-    case FACE_BACK:
-        switch (face)
-        {
-        case FACE_UP:
-            return (square == 0 || square == 1 || square == 2);
-        case FACE_RIGHT:
-            return (square == 2 || square == 5 || square == 8);
-        case FACE_DOWN:
-            return (square == 6 || square == 7 || square == 8);
-        case FACE_LEFT:
-            return (square == 0 || square == 3 || square == 6);
-        }
-        break;
-    case FACE_LEFT:
-        switch (face)
-        {
-        case FACE_UP:
-            return (square == 0 || square == 3 || square == 6);
-        case FACE_BACK:
-            return (square == 2 || square == 5 || square == 8);
-        case FACE_DOWN:
-            return (square == 0 || square == 3 || square == 6);
-        case FACE_FRONT:
-            return (square == 0 || square == 3 || square == 6);
-        }
-        break;
-    case FACE_DOWN:
-        switch (face)
-        {
-        case FACE_FRONT:
-            return (square == 6 || square == 7 || square == 8);
-        case FACE_LEFT:
-            return (square == 6 || square == 7 || square == 8);
-        case FACE_BACK:
-            return (square == 6 || square == 7 || square == 8);
-        case FACE_RIGHT:
-            return (square == 6 || square == 7 || square == 8);
-        }
-        break;
-    }
-    return false;
-}
-
-void ScrambleCube() 
-{
-    int numMoves = rand() % 41 + 20;
-    for (int i = 0; i < numMoves; i++) {
-        int move = rand() % 7;
-        int direction = rand() % 2;
-
-        rotatingFace = move;
-        rotatingDirection = direction ? 1 : -1;
-        UpdateCube();
-    }
-}
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(4, GL_FLOAT, 0, stickerCorners);
+    glColorPointer(3, GL_UNSIGNED_BYTE, 0, stickerColors);
+    glDrawArrays(GL_QUADS, 0, NUM_OF_STICKERS * 4);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
 
-/////////////////////////////////////////////////////////////////////////////
-// DRAWING FUNCTIONS
-/////////////////////////////////////////////////////////////////////////////
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
 
-// Draw a Square based on the given colour.
-void DrawSquare(const GLubyte* squareColor)
-{
-    glColor3ubv(squareColor);
-    glBegin(GL_POLYGON);
-    glVertex3d(-SQUARE_LENGTH_HALVED, -SQUARE_LENGTH_HALVED, 0);
-    glVertex3d(SQUARE_LENGTH_HALVED, -SQUARE_LENGTH_HALVED, 0);
-    glVertex3d(SQUARE_LENGTH_HALVED, SQUARE_LENGTH_HALVED, 0);
-    glVertex3d(-SQUARE_LENGTH_HALVED, SQUARE_LENGTH_HALVED, 0);
-    glEnd();
+    HudAddPhaseTime(HUD_PHASE_DRAW, HudNow() - drawStartTime);
+    HudCountDrawCalls(1);
 }
 
-// Draw a single Face of the Cube.
-void DrawFace(int face)
+// Draw a single Face of the Cube, rebuilding every sticker's transform on the matrix stack.
+// DrawCube draws the same picture; this is kept as the reference for --bench-render.
+void DrawFace(int face, const CubeSnapshot& snapshot)
 {
+    int rotatingTurn = snapshot.rotatingTurn;
+    double angle = ((double)snapshot.rotatingDirection * snapshot.frameNumber) * (90.0 / snapshot.animationFrames);
     for (int square = 0; square < NUM_OF_SQUARES; square++) {
         glPushMatrix();
-        glRotated(faceRotationValues[face][0], faceRotationValues[face][1], faceRotationValues[face][2], faceRotationValues[face][3]);
-        if (face == rotatingFace) {
-            glRotated((((double)rotatingDirection * frameNumber) * CUBE_ANGLE_INCR), 0.0, 0.0, 1.0);
-        }
-        else if (isRotating(face, square)) {
-            glRotated((((double)rotatingDirection * frameNumber) * CUBE_ANGLE_INCR), squareRotationValues[rotatingFace][face][0], squareRotationValues[rotatingFace][face][1], squareRotationValues[rotatingFace][face][2]);
+        if (IsStickerTurning(rotatingTurn, face, square)) {
+            glRotated(angle, turnRotationValues[rotatingTurn][0], turnRotationValues[rotatingTurn][1], turnRotationValues[rotatingTurn][2]);
         }
+        glRotated(faceRotationValues[face][0], faceRotationValues[face][1], faceRotationValues[face][2], faceRotationValues[face][3]);
         glTranslated(squareTranslateDistances[square][0], squareTranslateDistances[square][1], squareTranslateDistances[square][2]);
         glTranslated(0.0, 0.0, CUBE_LENGTH_HALVED);
         if (colourOverride) {
@@ -601,17 +438,20 @@ void DrawFace(int face)
             DrawSquare(overrideColor);
         }
         else
-            DrawSquare(cubeColor[cube[face][square]]);
+            DrawSquare(cubeColor[snapshot.cube.stickers[face][square]]);
         glPopMatrix();
     }
 }
 
-// Draw the entire Cube
-void DrawCube()
+// Draw the entire Cube with the matrix stack.
+void DrawCubeImmediate(const CubeSnapshot& snapshot)
 {
+    double startTime = HudNow();
     for (int face = 0; face < NUM_OF_FACES; face++) {
-        DrawFace(face);
+        DrawFace(face, snapshot);
     }
+    HudAddPhaseTime(HUD_PHASE_DRAW, HudNow() - startTime);
+    HudCountDrawCalls(NUM_OF_STICKERS);
 }
 
 // Draw the x, y, z axes. Each is drawn with the input length.
@@ -636,6 +476,7 @@ void DrawAxes(double length)
     glVertex3d(0.0, 0.0, length);
     glEnd();
     glPopAttrib();
+    HudCountDrawCalls(1);
 }
 
 
@@ -643,295 +484,854 @@ void DrawAxes(double length)
 // CALLBACK FUNCTIONS
 /////////////////////////////////////////////////////////////////////////////
 
+void RenderScene(const CubeSnapshot& snapshot);
+
+// The screenshot timer callback function. Hands a screenshot to the encoders a frame after its
+// read was queued, when the copy has finished, so neither the read nor the write holds up drawing.
+void ScreenshotTimerFunc(int v) {
+    RetireCapture();
+}
+
 // The display callback function.
 void DisplayFunc(void) {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    TRACE_SCOPE("DisplayFunc");
+
+    // Frames drawn with no dirty flags were requested by the window system (e.g. the window was uncovered).
+    framesRendered++;
+    if (dirtyFlags != 0) {
+        framesNeeded++;
+        for (int i = 0; i < NUM_OF_DIRTY_REASONS; i++) {
+            if (dirtyFlags & (1 << i))
+                dirtyReasonCounts[i]++;
+        }
+    }
+    dirtyFlags = 0;
+
+    HudBeginFrame();
+    RenderScene(GetSnapshot());
+
+    // Read the back buffer before it is swapped.
+    char filename[CAPTURE_MAX_FILENAME];
+    if (screenshotRequested) {
+        snprintf(filename, sizeof(filename), "%s/screenshot_%03d.png", captureDir, ++screenshotNumber);
+        CaptureScreenshot(winWidth, winHeight, IMAGE_FORMAT_PNG, filename);
+        glutTimerFunc(1000 / DESIRED_FPS, ScreenshotTimerFunc, 0);
+        screenshotRequested = false;
+    }
+    if (recording) {
+        snprintf(filename, sizeof(filename), "%s/recording_%03d_%05d.png", captureDir, recordingNumber, recordingFrame++);
+        CaptureFrame(winWidth, winHeight, IMAGE_FORMAT_PNG, filename);
+    }
 
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
+    // Drawn after capturing, so the HUD and scrub bar never show up in screenshots or recordings.
+    if (replaying) {
+        const CubeSnapshot& snapshot = GetSnapshot();
+        char label[REPLAY_LABEL_LENGTH];
+        snprintf(label, sizeof(label), "%u:%02u / %u:%02u%s", snapshot.replayTime / 60000, snapshot.replayTime / 1000 % 60,
+                 replaySession.duration / 60000, replaySession.duration / 1000 % 60, snapshot.replayPlaying ? "" : " ||");
+        DrawScrubBar(winWidth, winHeight, (replaySession.duration > 0) ? (double)snapshot.replayTime / replaySession.duration : 1.0, label);
+    }
+    else if (showHistory) {
+        char label[REPLAY_LABEL_LENGTH];
+        int length = (int)history.codes.size();
+        snprintf(label, sizeof(label), "MOVE %d / %d", history.position, length);
+        DrawScrubBar(winWidth, winHeight, (length > 0) ? (double)history.position / length : 1.0, label);
+    }
+    if (solverStatus[0] != '\0')
+        DrawStatusText(winWidth, winHeight, solverStatus);
+    if (showHud) {
+        TRACE_SCOPE("DrawHud");
+        DrawHud(winWidth, winHeight);
+    }
+
+    double swapStartTime = HudNow();
+    {
+        TRACE_SCOPE("glutSwapBuffers");
+        glutSwapBuffers();
+    }
+    HudAddPhaseTime(HUD_PHASE_SWAP, HudNow() - swapStartTime);
+    HudEndFrame();
+    LatencyFrameSwapped();
+}
+
+// Draws the cube of the snapshot and axes as seen from the eye into the current buffer.
+void RenderScene(const CubeSnapshot& snapshot) {
+    TRACE_SCOPE("RenderScene");
+    double startTime = HudNow();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    double matricesStartTime = HudNow();
+    HudAddPhaseTime(HUD_PHASE_DRAW, matricesStartTime - startTime);
 
     double zNear = eyeDistance - CLIP_PLANE_DIST;
     double zFar = eyeDistance + CLIP_PLANE_DIST;
-    gluPerspective(VERT_FOV, (double)winWidth / winHeight, zNear, zFar);
-
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
+    double projection[16];
+    MatrixPerspective(VERT_FOV, (double)winWidth / winHeight, zNear, zFar, projection);
+    glMatrixMode(GL_PROJECTION);
+    glLoadMatrixd(projection);
 
     // Convert spherical coordinates in terms of eyeDistance, eyeLatitude and eyeLongitude 
     // into cartesian coordinates.
     double eyeX = eyeDistance * cos((eyeLatitude / 180.0) * PI) * sin((eyeLongitude / 180.0) * PI);
     double eyeY = eyeDistance * sin((eyeLatitude / 180.0) * PI);
     double eyeZ = eyeDistance * cos((eyeLatitude / 180.0) * PI) * cos((eyeLongitude / 180.0) * PI);
-    gluLookAt(eyeX, eyeY, eyeZ, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0);
+    double view[16];
+    MatrixLookAt(eyeX, eyeY, eyeZ, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, view);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadMatrixd(view);
+    HudAddPhaseTime(HUD_PHASE_MATRICES, HudNow() - matricesStartTime);
 
     // Draw axes.
     if (drawAxes) {
+        double axesStartTime = HudNow();
         DrawAxes(2 * CUBE_LENGTH_HALVED);
+        HudAddPhaseTime(HUD_PHASE_DRAW, HudNow() - axesStartTime);
     }
 
-    // Draw cube
-    DrawCube();
-
-    glutSwapBuffers();
-}
-
-// The timer callback function.
-void TimerFunc(int v) {
-    if (frameNumber > 0 && frameNumber <= NUM_OF_FRAMES) {
-        glutPostRedisplay();
-        frameNumber++;
-        glutTimerFunc(1000 / DESIRED_FPS, TimerFunc, 0);
+    // Draw cube, turned the way it is held.
+    double orientation[16];
+    CubeOrientationMatrix(snapshot.cube.orientation, orientation);
+    if (useImmediateDrawing) {
+        glPushMatrix();
+        glMultMatrixd(orientation);
+        DrawCubeImmediate(snapshot);
+        glPopMatrix();
     }
     else {
-        playingAnimation = false;
-        frameNumber = 0;
-        UpdateCube(); 
-        PrintIncorrectCount();
-        glutPostRedisplay();
+        double viewProjection[16], heldViewProjection[16];
+        MatrixMultiply(projection, view, viewProjection);
+        MatrixMultiply(viewProjection, orientation, heldViewProjection);
+        DrawCube(heldViewProjection, snapshot);
     }
 }
 
-
-// Plays the animation of the current move.
-void playAnimation()
+// Takes the newest snapshot from the simulation, if there is one, and schedules a redraw for it.
+void ReceiveSnapshot()
 {
-    playingAnimation = true;
-    frameNumber = 1;
-    glutTimerFunc(0, TimerFunc, 0);
-}
-
-
-// The keyboard callback function.
-void KeyboardFunc(unsigned char key, int x, int y) {
-    if (!playingAnimation) {
-        switch (key) {
-            // Quit program.
-        case 'q':
-        case 'Q':
-            exit(0);
-            break;
-
-            // Toggle between wireframe and filled polygons.
-        case 'w':
-        case 'W':
-            drawWireframe = !drawWireframe;
-            if (drawWireframe)
-                glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-            else
-                glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-            glutPostRedisplay();
-            break;
+    unsigned int previousSequence = GetSnapshot().sequence;
+    int previousMoves = GetSnapshot().movesApplied;
+    double previousUpdateTime = GetSnapshot().updateTime;
+    Cube previousCube = GetSnapshot().cube;
+    if (!UpdateSnapshot())
+        return;
+
+    const CubeSnapshot& snapshot = GetSnapshot();
+    for (int i = 0; i < snapshot.numAppliedInputs; i++) {
+        if (snapshot.appliedInputs[i].sequence > previousSequence)
+            LatencyInputApplied(snapshot.appliedInputs[i].kind, snapshot.appliedInputs[i].inputTime);
+    }
+    for (int i = previousMoves; i < snapshot.movesApplied; i++) {
+        HudCountMove();
+    }
+    HudAddPhaseTime(HUD_PHASE_UPDATE, snapshot.updateTime - previousUpdateTime);
 
-            // Toggle back-face culling.
-        case 'b':
-        case 'B':
-            backfaceCulling = !backfaceCulling;
-            if (backfaceCulling)
-                glEnable(GL_CULL_FACE);
-            else
-                glDisable(GL_CULL_FACE);
-            glutPostRedisplay();
-            break;
+    if (memcmp(&previousCube, &snapshot.cube, sizeof(Cube)) != 0)
+        MarkDirty(DIRTY_STATE);
+    else
+        MarkDirty(DIRTY_ANIMATION);
+}
 
-            // Toggle axes.
-        case 'x':
-        case 'X':
-            drawAxes = !drawAxes;
-            glutPostRedisplay();
-            break;
+// The simulation timer callback function. Checks for snapshots until the simulation has
+// caught up with every command and finished animating.
+void PollSimulationFunc(int v) {
+    ReceiveSnapshot();
+    if (IsSimulationBusy())
+        glutTimerFunc(SIMULATION_POLL_INTERVAL, PollSimulationFunc, 0);
+    else
+        pollingSimulation = false;
+}
 
-            // Reset to initial view.
-        case 'r':
-        case 'R':
-            eyeLatitude = 0.0;
-            eyeLongitude = 0.0;
-            eyeDistance = EYE_INIT_DIST;
-            glutPostRedisplay();
-            break;
+// The solver timer callback function. Gives the background solver the cube if it has changed,
+// and updates the status line as shorter solutions come in, until the solve has finished.
+void SolverTimerFunc(int v)
+{
+    if (!replaying && !playingSolution) {
+        PackedCube packed;
+        PackCube(history.cube, packed);
+        if (!backgroundSolving || memcmp(&packed, &backgroundCube, sizeof(packed)) != 0) {
+            StartBackgroundSolve(history.cube, anytimeSeconds);
+            backgroundCube = packed;
+            backgroundSolving = true;
+        }
+    }
 
-            // Reset the cube.
-        case 'i':
-        case 'I':
-            InitCube();
-            glutPostRedisplay();
-            break;
+    // Nothing is shown for a solved cube, or while a solution plays.
+    char text[SOLVER_STATUS_LENGTH] = "";
+    bool running = false;
+    if (backgroundSolving && !playingSolution) {
+        AnytimeStatus status;
+        GetBackgroundSolve(status);
+        running = status.running;
+        if (status.found && !status.solution.empty())
+            snprintf(text, sizeof(text), "BEST %d MOVES%s", (int)status.solution.size(), status.running ? " ..." : status.optimal ? " OPTIMAL" : "");
+    }
+    if (strcmp(text, solverStatus) != 0) {
+        strcpy(solverStatus, text);
+        MarkDirty(DIRTY_SOLVER);
+    }
+    if (running)
+        glutTimerFunc(SOLVER_POLL_INTERVAL, SolverTimerFunc, v);
+    else
+        pollingSolver = false;
+}
 
-            // Scramble the cube.
-        case '0':
-            ScrambleCube();
-            PrintIncorrectCount();
-            glutPostRedisplay();
-            break;
+// Checks on the background solver until it has finished with the cube as it is now. Called
+// whenever the cube or the solution playing may have changed.
+void WakeSolver()
+{
+    if (!replaying && !pollingSolver) {
+        pollingSolver = true;
+        glutTimerFunc(0, SolverTimerFunc, 0);
+    }
+}
 
-            // Override Cube colour.
-        case 'm':
-        case 'M':
-            colourOverride = !colourOverride;
-            glutPostRedisplay();
-            break;
+// Adds a command that changes the cube to the session being recorded.
+void RecordSessionCommand(const SimulationCommand& command)
+{
+    unsigned int time = (unsigned int)((keyPressTime - sessionStartTime) / 1000.0);
+    if (command.type == SIMULATION_QUEUE_MOVE)
+        RecordSessionMove(sessionWriter, command.move, time);
+    else if (command.type == SIMULATION_RESET)
+        RecordSessionReset(sessionWriter, time);
+    else if (command.type == SIMULATION_SCRAMBLE)
+        RecordSessionScramble(sessionWriter, command.seed, time);
+    else if (command.type == SIMULATION_SET_STATE)
+        RecordSessionState(sessionWriter, command.cube, time);
+}
 
-            // X in anti-clockwise direction
-        case 'o':
-        case 'O':
-            rotatingFace = FACE_NONE;
-            RotateCube(X_AXIS, ANTI_CLOCKWISE);
-            playAnimation();
-            break;
+// Sends a command to the simulation thread, and watches for its result. Returns false if
+// the command was dropped.
+bool PostCommand(const SimulationCommand& command)
+{
+    // A replay can only be scrubbed through.
+    if (replaying && command.type != SIMULATION_SEEK && command.type != SIMULATION_PLAY)
+        return false;
+    if (!PostSimulationCommand(command)) {
+        printf("Too many commands waiting for the simulation; input dropped.\n");
+        return false;
+    }
+    if (!pollingSimulation) {
+        pollingSimulation = true;
+        glutTimerFunc(0, PollSimulationFunc, 0);
+    }
+    if (recordingSession)
+        RecordSessionCommand(command);
+    WakeSolver();
+    return true;
+}
 
-            // X in clockwise direction
-        case 'p':
-        case 'P':
-            rotatingFace = FACE_NONE;
-            RotateCube(X_AXIS, CLOCKWISE);
-            playAnimation();
-            break;
+// Queues a move to be animated, without adding it to the undo history.
+bool PostMove(const Move& move)
+{
+    SimulationCommand command = {};
+    command.type = SIMULATION_QUEUE_MOVE;
+    command.move = move;
+    return PostCommand(command);
+}
 
-            // X in anti-clockwise direction
-        case 'k':
-        case 'K':
-            rotatingFace = FACE_NONE;
-            RotateCube(Y_AXIS, ANTI_CLOCKWISE);
-            playAnimation();
-            break;
+// Sets the cube's state at once, without adding it to the undo history.
+void PostState(const Cube& cube)
+{
+    SimulationCommand command = {};
+    command.type = SIMULATION_SET_STATE;
+    command.cube = cube;
+    PostCommand(command);
+}
 
-            // X in clockwise direction
-        case 'l':
-        case 'L':
-            rotatingFace = FACE_NONE;
-            RotateCube(Y_AXIS, CLOCKWISE);
-            playAnimation();
-            break;
+// Queues a turn of a face, slice or wide layer, or a rotation of the entire cube. The faces
+// and axes are those of the cube as it will be held once the moves already queued are done.
+void QueueTurn(int turn, int direction)
+{
+    playingSolution = false;
+    Move move = { turn, direction, keyPressTime };
+    move = OrientMove(history.cube, move);
+    if (PostMove(move))
+        RecordHistoryMove(history, move);
+}
 
-            // Rotate Up face in anti-clockwise direction
-        case '1':
-            rotatingFace = FACE_UP;
-            rotatingDirection = ANTI_CLOCKWISE;
-            playAnimation();
-            break;
+// Returns the cube to the solved state.
+void ResetCube()
+{
+    playingSolution = false;
+    SimulationCommand command = {};
+    command.type = SIMULATION_RESET;
+    if (PostCommand(command)) {
+        Cube cube;
+        InitCube(cube);
+        RecordHistoryState(history, cube);
+    }
+}
 
-            // Rotate Up face in clockwise direction
-        case 'a':
-        case 'A':
-            rotatingFace = FACE_UP;
-            rotatingDirection = CLOCKWISE;
-            playAnimation();
-            break;
+// Scrambles the cube.
+void ScrambleCubeState()
+{
+    playingSolution = false;
+    SimulationCommand command = {};
+    command.type = SIMULATION_SCRAMBLE;
+    command.seed = (unsigned int)rand();
+    if (PostCommand(command)) {
+        Cube cube = history.cube;
+        ScrambleCube(cube, command.seed);
+        RecordHistoryState(history, cube);
+    }
+}
 
-            // Rotate Front face in anti-clockwise direction
-        case '2':
-            rotatingFace = FACE_FRONT;
-            rotatingDirection = ANTI_CLOCKWISE;
-            playAnimation();
-            break;
+// Undoes or redoes the last move, reset or scramble. Moves are animated backwards.
+void StepHistory(bool undo)
+{
+    if (replaying)
+        return;
+    playingSolution = false;
+    Move move;
+    Cube cube;
+    int result = undo ? UndoHistory(history, &move, &cube) : RedoHistory(history, &move, &cube);
+    if (result == HISTORY_MOVE) {
+        move.inputTime = keyPressTime;
+        PostMove(move);
+    }
+    else if (result == HISTORY_STATE) {
+        PostState(cube);
+    }
+    if (showHistory)
+        MarkDirty(DIRTY_SETTINGS);
+}
 
-            // Rotate Front face in clockwise direction
-        case 's':
-        case 'S':
-            rotatingFace = FACE_FRONT;
-            rotatingDirection = CLOCKWISE;
-            playAnimation();
-            break;
+// Prints each step of a solution of the cube with its moves, relative to how the cube is held, or
+// "(none)" for a step that was already done.
+void PrintCfopSolution(const Cube& cube, const CfopSolution& solution)
+{
+    Cube held = cube;
+    for (int step = 0; step < CFOP_STEPS; step++) {
+        const CfopStep& current = solution.steps[step];
+        printf("%-9s ", current.name);
+        if (current.length == 0)
+            printf("(none)");
+        PrintMoves(held, solution.moves.data() + current.start, current.length);
+        printf("\n");
+        for (int i = 0; i < current.length; i++) {
+            ApplyMove(held, solution.moves[current.start + i]);
+        }
+    }
+    std::vector<Move> optimized;
+    OptimizeMoves(solution.moves, optimized);
+    printf("%d moves, %d once those that cancel between steps are merged.\n", (int)solution.moves.size(), (int)optimized.size());
+}
 
-            // Rotate Left face in anti-clockwise direction
-        case '3':
-            rotatingFace = FACE_LEFT;
-            rotatingDirection = ANTI_CLOCKWISE;
-            playAnimation();
-            break;
+// Posts the next move of the solution once the simulation has finished the ones before it.
+void PlaySolutionFunc(int number)
+{
+    if (!playingSolution || number != solutionNumber)
+        return;
+    // A move the simulation had no room for is posted again on the next tick.
+    if (!IsSimulationBusy() && PostMove(solutionMoves[solutionMove])) {
+        RecordHistoryMove(history, solutionMoves[solutionMove]);
+        if (++solutionMove == solutionMoves.size()) {
+            playingSolution = false;
+            return;
+        }
+    }
+    glutTimerFunc(SIMULATION_POLL_INTERVAL, PlaySolutionFunc, number);
+}
 
-            // Rotate Left face in clockwise direction
-        case 'd':
-        case 'D':
-            rotatingFace = FACE_LEFT;
-            rotatingDirection = CLOCKWISE;
-            playAnimation();
-            break;
+// Plays the background solver's best solution of the cube as it will be once the queued moves are
+// done, or the CFOP solution if it hasn't found one yet; or stops the solution playing.
+void ToggleSolution()
+{
+    if (replaying)
+        return;
+    if (playingSolution) {
+        playingSolution = false;
+        WakeSolver();
+        return;
+    }
+    AnytimeStatus status;
+    GetBackgroundSolve(status);
+    PackedCube packed, solving;
+    PackCube(history.cube, packed);
+    PackCube(status.cube, solving);
+    if (backgroundSolving && status.found && memcmp(&packed, &solving, sizeof(packed)) == 0) {
+        PrintMoves(history.cube, status.solution.data(), status.solution.size());
+        printf("(%d%s)\n", (int)status.solution.size(), status.optimal ? ", optimal" : "");
+        solutionMoves = status.solution;
+    }
+    else {
+        CfopSolution cfopSolution;
+        if (!SolveCfop(history.cube, cfopSolution)) {
+            printf("The cube can't be solved.\n");
+            return;
+        }
+        PrintCfopSolution(history.cube, cfopSolution);
+        solutionMoves = cfopSolution.moves;
+    }
+    if (solutionMoves.empty())
+        return;
+    playingSolution = true;
+    solutionMove = 0;
+    solutionNumber++;
+    glutTimerFunc(0, PlaySolutionFunc, solutionNumber);
+}
 
-            // Rotate Back face in anti-clockwise direction
-        case '4':
-            rotatingFace = FACE_BACK;
-            rotatingDirection = ANTI_CLOCKWISE;
-            playAnimation();
-            break;
+// Starts or stops recording the session to captureDir. Sessions start from the solved cube.
+void ToggleSessionRecording()
+{
+    if (replaying)
+        return;
+    if (!recordingSession) {
+        ResetCube();
+        Cube cube;
+        InitCube(cube);
+        BeginSession(sessionWriter, cube);
+        sessionStartTime = keyPressTime;
+        recordingSession = true;
+        printf("Recording session %s/session_%03d.cses from the solved cube.\n", captureDir, sessionNumber + 1);
+    }
+    else {
+        recordingSession = false;
+        char filename[CAPTURE_MAX_FILENAME];
+        snprintf(filename, sizeof(filename), "%s/session_%03d.cses", captureDir, ++sessionNumber);
+        if (SaveSession(sessionWriter, filename))
+            printf("Saved session %s (%d events, %d bytes).\n", filename, sessionWriter.numEvents, (int)sessionWriter.data.size());
+    }
+}
 
-            // Rotate Back face in clockwise direction
-        case 'f':
-        case 'F':
-            rotatingFace = FACE_BACK;
-            rotatingDirection = CLOCKWISE;
-            playAnimation();
-            break;
+// Moves the replay to the given time, carrying on playing if it was.
+void SeekReplay(long long time)
+{
+    time = std::clamp<long long>(time, 0, replaySession.duration);
+    SimulationCommand command = {};
+    command.type = GetSnapshot().replayPlaying ? SIMULATION_PLAY : SIMULATION_SEEK;
+    command.time = (unsigned int)time;
+    PostCommand(command);
+}
 
-            // Rotate Right face in anti-clockwise direction
-        case '5':
-            rotatingFace = FACE_RIGHT;
-            rotatingDirection = ANTI_CLOCKWISE;
-            playAnimation();
-            break;
+// Pauses the replay, or plays it (from the start once it has ended).
+void ToggleReplayPlaying()
+{
+    const CubeSnapshot& snapshot = GetSnapshot();
+    SimulationCommand command = {};
+    command.type = snapshot.replayPlaying ? SIMULATION_SEEK : SIMULATION_PLAY;
+    command.time = (!snapshot.replayPlaying && snapshot.replayTime >= replaySession.duration) ? 0 : snapshot.replayTime;
+    PostCommand(command);
+}
 
-            // Rotate Right face in clockwise direction
-        case 'g':
-        case 'G':
-            rotatingFace = FACE_RIGHT;
-            rotatingDirection = CLOCKWISE;
-            playAnimation();
-            break;
+// Looks up OpenGL functions newer than the platform's headers, for the capture subsystem.
+void* ViewerGetProcAddress(const char* name)
+{
+#ifdef __APPLE__
+    return dlsym(RTLD_DEFAULT, name);
+#else
+    return (void*)glutGetProcAddress(name);
+#endif
+}
 
-            // Rotate Down face in anti-clockwise direction
-        case '6':
-            rotatingFace = FACE_DOWN;
-            rotatingDirection = ANTI_CLOCKWISE;
-            playAnimation();
-            break;
+// Starts the capture subsystem the first time a frame is captured.
+void EnsureCaptureStarted()
+{
+    if (!IsCaptureRunning()) {
+        int numThreads = (int)std::thread::hardware_concurrency() - 1;
+        StartCapture(ViewerGetProcAddress, numThreads, true);
+    }
+}
 
-            // Rotate Down face in clockwise direction
-        case 'h':
-        case 'H':
-            rotatingFace = FACE_DOWN;
-            rotatingDirection = CLOCKWISE;
-            playAnimation();
-            break;
-        }
+// The recording timer callback function. Keeps frames coming at DESIRED_FPS while recording,
+// even when nothing on screen changes.
+void RecordingTimerFunc(int v) {
+    if (recording && v == recordingNumber) {
+        MarkDirty(DIRTY_RECORDING);
+        glutTimerFunc(1000 / DESIRED_FPS, RecordingTimerFunc, recordingNumber);
     }
 }
 
-// The special key callback function.
-void SpecialKeyFunc(int key, int x, int y) {
-    switch (key) {
+// Starts or stops recording every frame to captureDir.
+void ToggleRecording()
+{
+    if (!recording) {
+        EnsureCaptureStarted();
+        recording = true;
+        recordingNumber++;
+        recordingFrame = 0;
+        printf("Recording to %s/recording_%03d_*.png\n", captureDir, recordingNumber);
+        glutTimerFunc(0, RecordingTimerFunc, recordingNumber);
+    }
+    else {
+        recording = false;
+        FlushCapture();
+        CaptureStats stats = GetCaptureStats();
+        printf("Recording stopped. %d frame(s) written, %d dropped, %d failed in this session.\n", stats.framesWritten, stats.framesDropped, stats.writeErrors);
+    }
+}
+
+// The HUD timer callback function. Keeps the HUD's statistics up to date while it is shown,
+// even when nothing on screen changes.
+void HudTimerFunc(int v) {
+    if (showHud && v == hudNumber) {
+        MarkDirty(DIRTY_HUD);
+        glutTimerFunc(HUD_REFRESH_INTERVAL, HudTimerFunc, hudNumber);
+    }
+}
+
+// Shows or hides the performance HUD.
+void ToggleHud()
+{
+    showHud = !showHud;
+    if (showHud) {
+        hudNumber++;
+        glutTimerFunc(HUD_REFRESH_INTERVAL, HudTimerFunc, hudNumber);
+    }
+    MarkDirty(DIRTY_HUD);
+}
+
+// Writes the trace recorded so far to the given file.
+void SaveTrace(const char* filename)
+{
+    if (!TraceEnabled())
+        printf("Tracing is disabled. Build with CUBE_TRACE defined to record a trace.\n");
+    else if (TraceWriteJson(filename))
+        printf("Saved trace %s\n", filename);
+    else
+        printf("Couldn't write trace %s\n", filename);
+}
+
+void SaveTraceOnExit(void)
+{
+    SaveTrace(traceFile);
+}
+
+// The keyboard callback function.
+void KeyboardFunc(unsigned char key, int x, int y) {
+    TRACE_SCOPE("KeyboardFunc");
+    keyPressTime = LatencyNow();
+
+    // SHIFT makes the face keys wide turns. Letter case isn't used for that, so caps lock leaves
+    // them as face turns.
+    int wide = (glutGetModifiers() & GLUT_ACTIVE_SHIFT) ? TURN_WIDE : 0;
+
+    switch (key) {
+        // Quit program.
+    case 'q':
+    case 'Q':
+        StopCapture();
+        StopBackgroundSolve();
+        StopSimulation();
+        exit(0);
+        break;
+
+        // Save a screenshot.
+    case 'c':
+    case 'C':
+        EnsureCaptureStarted();
+        screenshotRequested = true;
+        MarkDirty(DIRTY_SETTINGS);
+        break;
+
+        // Save a timeline trace.
+    case 't':
+    case 'T': {
+        char filename[CAPTURE_MAX_FILENAME];
+        snprintf(filename, sizeof(filename), "%s/trace_%03d.json", captureDir, ++traceNumber);
+        SaveTrace(filename);
+        break;
+    }
+
+        // Start or stop recording.
+    case 'v':
+    case 'V':
+        ToggleRecording();
+        break;
+
+        // Toggle between wireframe and filled polygons.
+    case 'w':
+    case 'W':
+        drawWireframe = !drawWireframe;
+        if (drawWireframe)
+            glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+        else
+            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        MarkDirty(DIRTY_SETTINGS);
+        break;
+
+        // Toggle back-face culling.
+    case 'b':
+    case 'B':
+        backfaceCulling = !backfaceCulling;
+        if (backfaceCulling)
+            glEnable(GL_CULL_FACE);
+        else
+            glDisable(GL_CULL_FACE);
+        MarkDirty(DIRTY_SETTINGS);
+        break;
+
+        // Toggle axes.
+    case 'x':
+    case 'X':
+        drawAxes = !drawAxes;
+        MarkDirty(DIRTY_SETTINGS);
+        break;
+
+        // Reset to initial view.
+    case 'r':
+    case 'R':
+        if (eyeLatitude != 0.0 || eyeLongitude != 0.0 || eyeDistance != EYE_INIT_DIST) {
+            LatencyInputApplied(LATENCY_CAMERA, keyPressTime);
+            MarkDirty(DIRTY_CAMERA);
+        }
+        eyeLatitude = 0.0;
+        eyeLongitude = 0.0;
+        eyeDistance = EYE_INIT_DIST;
+        break;
+
+        // Reset the cube.
+    case 'i':
+    case 'I':
+        ResetCube();
+        break;
+
+        // Scramble the cube.
+    case '0':
+        ScrambleCubeState();
+        break;
+
+        // Undo (also CTRL+Z).
+    case 'z':
+    case 'Z':
+    case 26:
+        StepHistory(true);
+        break;
+
+        // Redo (also CTRL+Y).
+    case 'y':
+    case 'Y':
+    case 25:
+        StepHistory(false);
+        break;
+
+        // Show or hide the history timeline.
+    case 'j':
+    case 'J':
+        showHistory = !showHistory;
+        MarkDirty(DIRTY_SETTINGS);
+        break;
+
+        // Pause or play the replay.
+    case ' ':
+        if (replaying)
+            ToggleReplayPlaying();
+        break;
+
+        // Skip the replay back or forward.
+    case '[':
+        if (replaying)
+            SeekReplay((long long)GetSnapshot().replayTime - REPLAY_SKIP_TIME);
+        break;
+
+    case ']':
+        if (replaying)
+            SeekReplay((long long)GetSnapshot().replayTime + REPLAY_SKIP_TIME);
+        break;
+
+        // Override Cube colour.
+    case 'm':
+    case 'M':
+        colourOverride = !colourOverride;
+        MarkDirty(DIRTY_SETTINGS);
+        break;
+
+        // X in anti-clockwise direction
+    case 'o':
+    case 'O':
+        QueueTurn(TURN_X, ANTI_CLOCKWISE);
+        break;
+
+        // X in clockwise direction
+    case 'p':
+    case 'P':
+        QueueTurn(TURN_X, CLOCKWISE);
+        break;
+
+        // Y in anti-clockwise direction
+    case 'k':
+    case 'K':
+        QueueTurn(TURN_Y, ANTI_CLOCKWISE);
+        break;
+
+        // Y in clockwise direction
+    case 'l':
+    case 'L':
+        QueueTurn(TURN_Y, CLOCKWISE);
+        break;
+
+        // Z in anti-clockwise direction
+    case ',':
+        QueueTurn(TURN_Z, ANTI_CLOCKWISE);
+        break;
+
+        // Z in clockwise direction
+    case '.':
+        QueueTurn(TURN_Z, CLOCKWISE);
+        break;
+
+        // Rotate Up face (with SHIFT, and the middle layer behind it) in anti-clockwise direction
+    case '1':
+    case '!':
+        QueueTurn(wide + TURN_U, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Up face (with SHIFT, and the middle layer behind it) in clockwise direction
+    case 'a':
+    case 'A':
+        QueueTurn(wide + TURN_U, CLOCKWISE);
+        break;
+
+        // Rotate Front face (with SHIFT, and the middle layer behind it) in anti-clockwise direction
+    case '2':
+    case '@':
+        QueueTurn(wide + TURN_F, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Front face (with SHIFT, and the middle layer behind it) in clockwise direction
+    case 's':
+    case 'S':
+        QueueTurn(wide + TURN_F, CLOCKWISE);
+        break;
+
+        // Rotate Left face (with SHIFT, and the middle layer behind it) in anti-clockwise direction
+    case '3':
+    case '#':
+        QueueTurn(wide + TURN_L, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Left face (with SHIFT, and the middle layer behind it) in clockwise direction
+    case 'd':
+    case 'D':
+        QueueTurn(wide + TURN_L, CLOCKWISE);
+        break;
+
+        // Rotate Back face (with SHIFT, and the middle layer behind it) in anti-clockwise direction
+    case '4':
+    case '$':
+        QueueTurn(wide + TURN_B, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Back face (with SHIFT, and the middle layer behind it) in clockwise direction
+    case 'f':
+    case 'F':
+        QueueTurn(wide + TURN_B, CLOCKWISE);
+        break;
+
+        // Rotate Right face (with SHIFT, and the middle layer behind it) in anti-clockwise direction
+    case '5':
+    case '%':
+        QueueTurn(wide + TURN_R, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Right face (with SHIFT, and the middle layer behind it) in clockwise direction
+    case 'g':
+    case 'G':
+        QueueTurn(wide + TURN_R, CLOCKWISE);
+        break;
+
+        // Rotate Down face (with SHIFT, and the middle layer behind it) in anti-clockwise direction
+    case '6':
+    case '^':
+        QueueTurn(wide + TURN_D, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Down face (with SHIFT, and the middle layer behind it) in clockwise direction
+    case 'h':
+    case 'H':
+        QueueTurn(wide + TURN_D, CLOCKWISE);
+        break;
+
+        // Rotate Middle layer (like Left) in anti-clockwise direction
+    case '7':
+        QueueTurn(TURN_M, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Middle layer (like Left) in clockwise direction
+    case 'u':
+    case 'U':
+        QueueTurn(TURN_M, CLOCKWISE);
+        break;
+
+        // Rotate Equator layer (like Down) in anti-clockwise direction
+    case '8':
+        QueueTurn(TURN_E, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Equator layer (like Down) in clockwise direction
+    case 'e':
+    case 'E':
+        QueueTurn(TURN_E, CLOCKWISE);
+        break;
+
+        // Rotate Standing layer (like Front) in anti-clockwise direction
+    case '9':
+        QueueTurn(TURN_S, ANTI_CLOCKWISE);
+        break;
+
+        // Rotate Standing layer (like Front) in clockwise direction
+    case 'n':
+    case 'N':
+        QueueTurn(TURN_S, CLOCKWISE);
+        break;
+    }
+}
+
+// The special key callback function.
+void SpecialKeyFunc(int key, int x, int y) {
+    TRACE_SCOPE("SpecialKeyFunc");
+    keyPressTime = LatencyNow();
+
+    double oldLatitude = eyeLatitude;
+    double oldLongitude = eyeLongitude;
+    double oldDistance = eyeDistance;
+
+    switch (key) {
     case GLUT_KEY_LEFT:
         eyeLongitude -= EYE_LONGITUDE_INCR;
         if (eyeLongitude < -360.0) eyeLongitude += 360.0;
-        glutPostRedisplay();
         break;
 
     case GLUT_KEY_RIGHT:
         eyeLongitude += EYE_LONGITUDE_INCR;
         if (eyeLongitude > 360.0) eyeLongitude -= 360.0;
-        glutPostRedisplay();
         break;
 
     case GLUT_KEY_DOWN:
         eyeLatitude -= EYE_LATITUDE_INCR;
         if (eyeLatitude < EYE_MIN_LATITUDE) eyeLatitude = EYE_MIN_LATITUDE;
-        glutPostRedisplay();
         break;
 
     case GLUT_KEY_UP:
         eyeLatitude += EYE_LATITUDE_INCR;
         if (eyeLatitude > EYE_MAX_LATITUDE) eyeLatitude = EYE_MAX_LATITUDE;
-        glutPostRedisplay();
         break;
 
     case GLUT_KEY_PAGE_UP:
         eyeDistance -= EYE_DIST_INCR;
         if (eyeDistance < EYE_MIN_DIST) eyeDistance = EYE_MIN_DIST;
-        glutPostRedisplay();
         break;
 
     case GLUT_KEY_PAGE_DOWN:
         eyeDistance += EYE_DIST_INCR;
-        glutPostRedisplay();
         break;
+
+    case GLUT_KEY_F3:
+        ToggleHud();
+        break;
+
+    case GLUT_KEY_F5:
+        ToggleSessionRecording();
+        break;
+
+    case GLUT_KEY_F6:
+        ToggleSolution();
+        break;
+    }
+
+    // Keys pressed against a limit leave the camera where it was.
+    if (eyeLatitude != oldLatitude || eyeLongitude != oldLongitude || eyeDistance != oldDistance) {
+        LatencyInputApplied(LATENCY_CAMERA, keyPressTime);
+        MarkDirty(DIRTY_CAMERA);
     }
 }
 
@@ -941,6 +1341,49 @@ void ReshapeFunc(int w, int h)
     winWidth = w;
     winHeight = h;
     glViewport(0, 0, w, h);
+    MarkDirty(DIRTY_WINDOW);
+}
+
+// Seeks the replay, or jumps through the history, to a point on the scrub bar from 0 to 1.
+void Scrub(double position)
+{
+    if (replaying) {
+        SeekReplay((long long)(position * replaySession.duration));
+    }
+    else {
+        int target = (int)(position * history.codes.size() + 0.5);
+        if (target == history.position)
+            return;
+        Cube cube;
+        JumpHistory(history, target, &cube);
+        PostState(cube);
+        MarkDirty(DIRTY_SETTINGS);
+    }
+}
+
+// The mouse button callback function. Clicking the scrub bar seeks to that point.
+void MouseFunc(int button, int state, int x, int y) {
+    double position;
+    scrubbing = false;
+    if ((replaying || showHistory) && button == GLUT_LEFT_BUTTON && state == GLUT_DOWN && ScrubBarHit(winWidth, winHeight, x, y, &position)) {
+        scrubbing = true;
+        Scrub(position);
+    }
+}
+
+// The mouse motion callback function. Dragging along the scrub bar keeps seeking.
+void MotionFunc(int x, int y) {
+    double position;
+    if (scrubbing && (replaying || showHistory) && ScrubBarHit(winWidth, winHeight, x, y, &position))
+        Scrub(position);
+}
+
+// The visibility callback function.
+void VisibilityFunc(int state)
+{
+    windowVisible = (state == GLUT_VISIBLE);
+    if (windowVisible && dirtyFlags != 0)
+        glutPostRedisplay();
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -955,22 +1398,1185 @@ void Init(void)
     glShadeModel(GL_SMOOTH);
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// HEADLESS RENDERING
+/////////////////////////////////////////////////////////////////////////////
+
+// Options for rendering a move file to images without a window.
+struct HeadlessOptions {
+    const char* moveFile;
+    const char* outputDir;
+    int format;             // IMAGE_FORMAT_ of the frames.
+    int numWorkers;         // Number of processes rendering frames in parallel.
+    bool lastFrameOnly;     // Only render the final state, e.g. for a thumbnail.
+};
+
+// Renders the snapshot and queues it to be written to outputDir as the given frame number.
+void WriteHeadlessFrame(const HeadlessOptions& options, const CubeSnapshot& snapshot, int frame)
+{
+    TRACE_SCOPE("WriteHeadlessFrame");
+    RenderScene(snapshot);
+
+    char filename[CAPTURE_MAX_FILENAME];
+    snprintf(filename, sizeof(filename), "%s/frame_%05d.%s", options.outputDir, frame, ImageFormatExtension(options.format));
+    CaptureFrame(winWidth, winHeight, options.format, filename);
+}
+
+// Replays the moves from the solved state, rendering every frame of their animations.
+// Frames are numbered from 0 (the solved cube), and this worker only renders the frames
+// numbered worker, worker + numWorkers, worker + 2 * numWorkers, ...
+// The frames don't depend on time, so the moves are stepped through here rather than by
+// the simulation thread.
+bool RenderHeadlessFrames(const HeadlessOptions& options, const std::vector<Move>& moves, int worker)
+{
+    if (!CreateOffscreenContext(winWidth, winHeight))
+        return false;
+    Init();
+    glViewport(0, 0, winWidth, winHeight);
+    InitStickerMatrices();
+
+    CubeSnapshot snapshot;
+    InitCube(snapshot.cube);
+    snapshot.rotatingTurn = TURN_NONE;
+    snapshot.rotatingDirection = CLOCKWISE;
+    snapshot.frameNumber = 0;
+    snapshot.animationFrames = NUM_OF_FRAMES;
+
+    // Frames are read back and written while the following ones render.
+    StartCapture(OffscreenGetProcAddress, 1, false);
+
+    int frame = 0;
+    if (!options.lastFrameOnly && frame % options.numWorkers == worker)
+        WriteHeadlessFrame(options, snapshot, frame);
+    frame++;
+
+    for (size_t i = 0; i < moves.size(); i++) {
+        if (options.lastFrameOnly) {
+            ApplyMove(snapshot.cube, moves[i]);
+            continue;
+        }
+
+        snapshot.rotatingTurn = moves[i].turn;
+        snapshot.rotatingDirection = moves[i].direction;
+        for (snapshot.frameNumber = 1; snapshot.frameNumber <= snapshot.animationFrames; snapshot.frameNumber++) {
+            if (frame % options.numWorkers == worker)
+                WriteHeadlessFrame(options, snapshot, frame);
+            frame++;
+        }
+        snapshot.rotatingTurn = TURN_NONE;
+        snapshot.frameNumber = 0;
+        ApplyMove(snapshot.cube, moves[i]);
+    }
+
+    if (options.lastFrameOnly && worker == 0)
+        WriteHeadlessFrame(options, snapshot, 0);
+
+    StopCapture();
+    DestroyOffscreenContext();
+
+    CaptureStats stats = GetCaptureStats();
+    if (stats.writeErrors > 0)
+        printf("Unable to write %d frame(s) to '%s'.\n", stats.writeErrors, options.outputDir);
+    return stats.writeErrors == 0;
+}
+
+// Renders a move file to images without opening a window. Returns the process exit code.
+int RunHeadless(const HeadlessOptions& options)
+{
+    std::vector<Move> moves;
+    if (!ReadMoveFile(options.moveFile, moves))
+        return 1;
+
+    // Workers without a frame of their own would only make a context, so there are never more
+    // workers than frames.
+    HeadlessOptions run = options;
+    int numFrames = options.lastFrameOnly ? 1 : 1 + (int)moves.size() * NUM_OF_FRAMES;
+    if (run.numWorkers > numFrames)
+        run.numWorkers = numFrames;
+#if defined(_WIN32)
+    if (run.numWorkers > 1) {
+        printf("--workers needs fork(), so frames are rendered by one worker on Windows.\n");
+        run.numWorkers = 1;
+    }
+#endif
+
+    printf("Rendering %d moves at %dx%d with %s and %d worker(s).\n", (int)moves.size(), winWidth, winHeight, OffscreenBackendName(), run.numWorkers);
+
+#if defined(_WIN32)
+    return RenderHeadlessFrames(run, moves, 0) ? 0 : 1;
+#else
+    // Every worker is its own process with its own context and its own copy of the cube,
+    // so the workers share nothing while rendering.
+    if (run.numWorkers == 1)
+        return RenderHeadlessFrames(run, moves, 0) ? 0 : 1;
+
+    std::vector<pid_t> workers;
+    for (int worker = 0; worker < run.numWorkers; worker++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            bool rendered = RenderHeadlessFrames(run, moves, worker);
+            // Workers exit without running atexit handlers, so each saves its own trace.
+            if (traceFile != NULL) {
+                char filename[CAPTURE_MAX_FILENAME];
+                snprintf(filename, sizeof(filename), "%s.%d", traceFile, worker);
+                SaveTrace(filename);
+            }
+            _exit(rendered ? 0 : 1);
+        }
+        if (pid < 0) {
+            printf("Unable to start render worker %d.\n", worker);
+            break;
+        }
+        workers.push_back(pid);
+    }
+
+    bool ok = ((int)workers.size() == run.numWorkers);
+    for (size_t i = 0; i < workers.size(); i++) {
+        int status = 0;
+        waitpid(workers[i], &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            ok = false;
+    }
+    return ok ? 0 : 1;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// BENCHMARKS
+/////////////////////////////////////////////////////////////////////////////
+
+// Returns the mean and median CPU time (in microseconds) of rendering numFrames frames of a turning layer.
+void TimeRenderFrames(CubeSnapshot& snapshot, int numFrames, double* mean, double* median)
+{
+    std::vector<double> times;
+    snapshot.rotatingTurn = TURN_R;
+    snapshot.rotatingDirection = CLOCKWISE;
+    snapshot.animationFrames = NUM_OF_FRAMES;
+    for (int i = 0; i < numFrames; i++) {
+        snapshot.frameNumber = i % (NUM_OF_FRAMES + 1);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        RenderScene(snapshot);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+        // Keep the GPU from queueing work, which would show up in the next frame's time.
+        glFinish();
+    }
+    snapshot.frameNumber = 0;
+
+    double total = 0.0;
+    for (size_t i = 0; i < times.size(); i++) {
+        total += times[i];
+    }
+    std::sort(times.begin(), times.end());
+    *mean = total / numFrames;
+    *median = times[times.size() / 2];
+}
+
+// Compares the CPU time per frame of drawing with the matrix stack against the cached sticker
+// transforms, with a layer turning and the camera still. Needs a current OpenGL context.
+void RunRenderBenchmark(int numFrames)
+{
+    Init();
+    glViewport(0, 0, winWidth, winHeight);
+    InitStickerMatrices();
+    CubeSnapshot snapshot;
+    InitCube(snapshot.cube);
+    ScrambleCube(snapshot.cube, (unsigned int)rand());
+
+    double immediateMean, immediateMedian, cachedMean, cachedMedian;
+    useImmediateDrawing = true;
+    TimeRenderFrames(snapshot, numFrames, &immediateMean, &immediateMedian);
+    useImmediateDrawing = false;
+    TimeRenderFrames(snapshot, numFrames, &cachedMean, &cachedMedian);
+
+    printf("CPU time per frame over %d frames (%dx%d):\n", numFrames, winWidth, winHeight);
+    printf("  matrix stack:     mean %8.1f us, median %8.1f us\n", immediateMean, immediateMedian);
+    printf("  cached matrices:  mean %8.1f us, median %8.1f us\n", cachedMean, cachedMedian);
+    printf("  speed up:         %.2fx\n", immediateMean / cachedMean);
+}
+
+// Turns random faces forever, pausing now and then. seed picks the turns.
+Script RandomTurns(unsigned int seed)
+{
+    for (;;) {
+        seed = seed * 1103515245 + 12345;
+        int face = (seed >> 16) % NUM_OF_FACES;
+        co_await turn(face, (seed & 0x100) ? CLOCKWISE : ANTI_CLOCKWISE);
+        if ((seed >> 24) % 8 == 0)
+            co_await delay(std::chrono::milliseconds(50));
+    }
+}
+
+// Times ticking numCubes cubes, each running its own script, for BENCH_SCRIPT_FRAMES frames.
+// Scripts are started before timing, as their coroutine frames are the only allocations.
+void RunScriptBenchmark(int numCubes)
+{
+    std::vector<AnimatedCube> cubes(numCubes);
+    for (int i = 0; i < numCubes; i++) {
+        cubes[i].Run(RandomTurns(i + 1));
+    }
+
+    // The scripts run on a clock that advances a frame per tick, as fast as the cubes can be ticked.
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int frame = 1; frame <= BENCH_SCRIPT_FRAMES; frame++) {
+        ScriptClock::time_point now = start + std::chrono::microseconds(frame * 1000000LL / SIMULATION_FPS);
+        for (int i = 0; i < numCubes; i++) {
+            cubes[i].Tick(now);
+        }
+    }
+    double total = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    int movesApplied = 0;
+    for (int i = 0; i < numCubes; i++) {
+        movesApplied += cubes[i].movesApplied;
+    }
+    printf("%d cubes running scripts over %d frames:\n", numCubes, BENCH_SCRIPT_FRAMES);
+    printf("  per frame:  %8.1f us\n", total / BENCH_SCRIPT_FRAMES);
+    printf("  per cube:   %8.3f us\n", total / BENCH_SCRIPT_FRAMES / numCubes);
+    printf("  turns:      %d\n", movesApplied);
+}
+
+// The context of PrintSolution and PrintAnytimeSolution.
+struct SolutionPrinter {
+    Cube cube;                  // Being solved; the moves are printed relative to how it is held.
+    int numSolutions;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Prints a solution found by RunSearch and counts it.
+bool PrintSolution(const std::vector<Move>& solution, void* context)
+{
+    SolutionPrinter* printer = (SolutionPrinter*)context;
+    PrintMoves(printer->cube, solution.data(), solution.size());
+    printf("(%d)\n", (int)solution.size());
+    printer->numSolutions++;
+    return true;
+}
+
+// Prints every shortest sequence of face turns that solves the cube after the moves in a file.
+int RunSearch(const char* moveFile, size_t maxMemory)
+{
+    std::vector<Move> moves;
+    if (!ReadMoveFile(moveFile, moves))
+        return 1;
+    Cube start, goal;
+    InitCube(start);
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyMove(start, moves[i]);
+    }
+    InitCube(goal);
+
+    SearchOptions options;
+    InitSearchOptions(options);
+    if (maxMemory > 0)
+        options.maxMemory = maxMemory;
+    SolutionPrinter printer = { start, 0, std::chrono::steady_clock::now() };
+    size_t peakMemory;
+    int result = SearchOptimal(start, goal, options, PrintSolution, &printer, &peakMemory);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - printer.start).count();
+
+    if (result == SEARCH_NOT_FOUND)
+        printf("No solution within %d moves.\n", options.maxLength);
+    else if (result == SEARCH_OUT_OF_MEMORY)
+        printf("Ran out of memory before finding a solution; try a larger --search-memory.\n");
+    printf("%d solutions in %.3f s, using %.1f MB.\n", printer.numSolutions, seconds, peakMemory / 1048576.0);
+    return (result == SEARCH_FOUND) ? 0 : 1;
+}
+
+// Prints a CFOP solution of the cube after the moves in a file.
+int RunSolve(const char* moveFile)
+{
+    std::vector<Move> moves;
+    if (!ReadMoveFile(moveFile, moves))
+        return 1;
+    Cube cube;
+    InitCube(cube);
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyMove(cube, moves[i]);
+    }
+    CfopSolution solution;
+    if (!SolveCfop(cube, solution)) {
+        printf("The cube can't be solved.\n");
+        return 1;
+    }
+    PrintCfopSolution(cube, solution);
+    return 0;
+}
+
+// A random whole-cube rotation.
+static Move RandomRotation()
+{
+    int code = rand() % 9;
+    return MoveFromCode((code < 6) ? 2 * TURN_X + code : 2 * NUM_OF_TURNS + TURN_X + code - 6);
+}
+
+// Checks that moves, and their optimized form, written out with FormatMoves and parsed back with
+// ParseMoves leave a cube just as the moves themselves do.
+static bool CheckMovesReadBack(const std::vector<Move>& moves)
+{
+    std::vector<Move> optimized;
+    OptimizeMoves(moves, optimized);
+    Cube expected;
+    InitCube(expected);
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyMove(expected, moves[i]);
+    }
+    const std::vector<Move>* sequences[2] = { &moves, &optimized };
+    for (int i = 0; i < 2; i++) {
+        Cube cube;
+        InitCube(cube);
+        std::vector<char> text(4 * sequences[i]->size() + 1);
+        FormatMoves(cube, sequences[i]->data(), sequences[i]->size(), text.data());
+        std::vector<Move> parsed;
+        if (!ParseMoves(text.data(), parsed))
+            return false;
+        for (size_t j = 0; j < parsed.size(); j++) {
+            ApplyMove(cube, parsed[j]);
+        }
+        if (memcmp(&cube, &expected, sizeof(cube)) != 0)
+            return false;
+    }
+    return true;
+}
+
+// Solves scrambles with the CFOP solver and prints how fast, and how many moves each stage took.
+// Each solution is also written out with rotations among its moves, optimized and read back.
+int RunSolveBenchmark(int numScrambles)
+{
+    static const char* const stageNames[NUM_OF_CFOP_STAGES] = { "cross", "F2L", "OLL", "PLL", "AUF" };
+    CfopSolution solution;
+    Cube cube;
+    InitCube(cube);
+    SolveCfop(cube, solution);          // Builds the tables.
+
+    long long stageMoves[NUM_OF_CFOP_STAGES] = {};
+    long long totalMoves = 0;
+    long long optimizedMoves = 0;
+    std::vector<Move> optimized, rotated;
+    int failures = 0;
+    int unreadable = 0;
+    double solveTime = 0.0;
+    srand(BENCH_SOLVE_SEED);
+    for (int i = 0; i < numScrambles; i++) {
+        InitCube(cube);
+        ScrambleCube(cube, BENCH_SOLVE_SEED + i);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool solved = SolveCfop(cube, solution);
+        solveTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        for (size_t move = 0; solved && move < solution.moves.size(); move++) {
+            ApplyMove(cube, solution.moves[move]);
+        }
+        if (!solved || CountIncorrectStickers(cube) != 0) {
+            failures++;
+            continue;
+        }
+        totalMoves += solution.moves.size();
+        OptimizeMoves(solution.moves, optimized);
+        optimizedMoves += optimized.size();
+        for (int step = 0; step < CFOP_STEPS; step++) {
+            stageMoves[solution.steps[step].stage] += solution.steps[step].length;
+        }
+
+        // A rotation before the solution, one in the middle and one after.
+        size_t middle = solution.moves.size() / 2;
+        rotated.assign(1, RandomRotation());
+        rotated.insert(rotated.end(), solution.moves.begin(), solution.moves.begin() + middle);
+        rotated.push_back(RandomRotation());
+        rotated.insert(rotated.end(), solution.moves.begin() + middle, solution.moves.end());
+        rotated.push_back(RandomRotation());
+        if (!CheckMovesReadBack(rotated))
+            unreadable++;
+    }
+
+    int solved = numScrambles - failures;
+    printf("%d scrambles solved in %.3f s (%.0f a second), %d failed, %d read back wrong.\n", solved, solveTime / 1e6,
+           numScrambles / (solveTime / 1e6), failures, unreadable);
+    if (solved == 0)
+        return 1;
+    printf("  moves:      %8.2f\n", (double)totalMoves / solved);
+    printf("  optimized:  %8.2f\n", (double)optimizedMoves / solved);
+    for (int stage = 0; stage < NUM_OF_CFOP_STAGES; stage++) {
+        printf("  %-10s  %8.2f\n", stageNames[stage], (double)stageMoves[stage] / solved);
+    }
+    return (failures == 0 && unreadable == 0) ? 0 : 1;
+}
+
+// Prints the moves in a file with the redundant moves taken out.
+int RunOptimize(const char* moveFile)
+{
+    std::vector<Move> moves, optimized;
+    if (!ReadMoveFile(moveFile, moves))
+        return 1;
+    OptimizeMoves(moves, optimized);
+    Cube cube;
+    InitCube(cube);
+    PrintMoves(cube, optimized.data(), optimized.size());
+    printf("\n%d moves, from %d.\n", (int)optimized.size(), (int)moves.size());
+    return 0;
+}
+
+// Prints the states of each depth as they are found, and how fast.
+static void PrintEnumeratedDepth(const EnumerateDepth& depth, void* context)
+{
+    double rate = (depth.seconds > 0.0) ? 1.0 / depth.seconds : 0.0;
+    printf("%5d %16llu %16llu %10.3f %14.0f %14.0f%s\n", depth.depth, (unsigned long long)depth.sequences,
+           (unsigned long long)depth.states, depth.seconds, depth.sequences * rate, depth.states * rate,
+           depth.spilled ? "  (spilled)" : "");
+    fflush(stdout);
+}
+
+// Counts the states at each depth from solved, up to options.maxDepth.
+int RunEnumerate(const EnumerateOptions& options)
+{
+    printf("Enumerating to depth %d on %d threads, with %.0f MB of memory.\n", options.maxDepth, options.numThreads,
+           options.maxMemory / 1048576.0);
+    printf("%5s %16s %16s %10s %14s %14s\n", "depth", "sequences", "states", "seconds", "sequences/s", "states/s");
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int result = EnumerateStates(options, PrintEnumeratedDepth, NULL);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (result == ENUMERATE_OUT_OF_MEMORY)
+        printf("Ran out of memory; try a larger --enumerate-memory or an --enumerate-dir to spill to.\n");
+    else if (result == ENUMERATE_FILE_ERROR)
+        printf("Couldn't write or read the files in %s.\n", options.directory);
+    printf("%.3f s in all.\n", seconds);
+    return (result == ENUMERATE_DONE) ? 0 : 1;
+}
+
+// Fills a 2x2x2 table by a BFS, printing how long it took and the states at each distance.
+static void BuildPrintedPocketTable(PocketTable& table, int numThreads)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    BuildPocketTable(table, numThreads);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("Built the 2x2x2 table on %d threads in %.3f s (%.0f states a second).\n", numThreads, seconds, POCKET_STATES / seconds);
+    uint32_t counts[POCKET_MAX_DISTANCE + 1];
+    CountPocketDistances(table, counts);
+    for (int distance = 0; distance <= POCKET_MAX_DISTANCE; distance++) {
+        printf("  %2d %8u\n", distance, counts[distance]);
+    }
+}
+
+// Prints an optimal solution of the corners of the cube after the moves in a file, as a 2x2x2. The
+// table is mapped from tableFile if it holds one, and otherwise built and written to it.
+int RunPocketSolve(const char* moveFile, const char* tableFile, int numThreads)
+{
+    std::vector<Move> moves;
+    if (!ReadMoveFile(moveFile, moves))
+        return 1;
+    Cube cube;
+    InitCube(cube);
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyMove(cube, moves[i]);
+    }
+
+    PocketTable table;
+    InitPocketTable(table);
+    if (tableFile == NULL || !LoadPocketTable(table, tableFile)) {
+        BuildPrintedPocketTable(table, numThreads);
+        if (tableFile != NULL)
+            SavePocketTable(table, tableFile);
+    }
+    std::vector<Move> solution;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool solved = SolvePocket(table, cube, solution);
+    double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    FreePocketTable(table);
+    if (!solved) {
+        printf("The corners can't be solved as a 2x2x2.\n");
+        return 1;
+    }
+    PrintMoves(cube, solution.data(), solution.size());
+    printf("\n%d moves, found in %.1f us.\n", (int)solution.size(), microseconds);
+    return 0;
+}
+
+// Builds the 2x2x2 table, checking the BFS against the known number of states at each distance,
+// then times optimal solves of the corners of scrambles.
+int RunPocketBenchmark(int numScrambles, const char* tableFile, int numThreads)
+{
+    static const uint32_t expected[POCKET_MAX_DISTANCE + 1] = { 1, 9, 54, 321, 1847, 9992, 50136, 227536, 870072, 1887748, 623800, 2644 };
+    PocketTable table;
+    InitPocketTable(table);
+    BuildPrintedPocketTable(table, numThreads);
+    uint32_t counts[POCKET_MAX_DISTANCE + 1];
+    CountPocketDistances(table, counts);
+    bool correct = memcmp(counts, expected, sizeof(counts)) == 0;
+    if (!correct)
+        printf("The counts are wrong.\n");
+    if (tableFile != NULL)
+        SavePocketTable(table, tableFile);
+
+    std::vector<Move> solution;
+    long long totalMoves = 0;
+    int failures = 0;
+    double solveTime = 0.0;
+    for (int i = 0; i < numScrambles; i++) {
+        Cube cube;
+        InitCube(cube);
+        ScrambleCube(cube, BENCH_SOLVE_SEED + i);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool solved = SolvePocket(table, cube, solution);
+        solveTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        if (!solved) {
+            failures++;
+            continue;
+        }
+        totalMoves += solution.size();
+    }
+    FreePocketTable(table);
+    int solved = numScrambles - failures;
+    printf("%d scrambles solved in %.3f s (%.2f us each), %d failed, %.2f moves on average.\n", solved, solveTime / 1e6,
+           solveTime / numScrambles, failures, solved > 0 ? (double)totalMoves / solved : 0.0);
+    return (correct && failures == 0) ? 0 : 1;
+}
+
+// Builds the subgroup generated by some moves in standard notation, printing its components and
+// how long its tables took.
+static bool BuildPrintedSubgroup(const char* generators, Subgroup& subgroup)
+{
+    static const char* const kindNames[4] = { "corners", "twists", "edges", "flips" };
+    std::vector<Move> moves;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (!ParseGenerators(generators, moves) || !BuildSubgroup(moves, subgroup)) {
+        printf("'%s' are not different face turns.\n", generators);
+        return false;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("<%s>: %d moves, built in %.3f s.\n", generators, (int)moves.size(), seconds);
+    for (int i = 0; i < subgroup.numComponents; i++) {
+        const SubgroupComponent& component = subgroup.components[i];
+        printf("  %-8s %2d slots %9u values\n", kindNames[component.kind], component.numSlots, component.size);
+    }
+    for (size_t i = 0; i < subgroup.tables.size(); i++) {
+        const SubgroupTable& table = subgroup.tables[i];
+        int deepest = 0;
+        for (size_t j = 0; j < table.distances.size(); j++) {
+            if (table.distances[j] != SUBGROUP_UNREACHED && table.distances[j] > deepest)
+                deepest = table.distances[j];
+        }
+        printf("  table of");
+        for (int j = 0; j < 2 && table.components[j] >= 0; j++) {
+            const SubgroupComponent& component = subgroup.components[table.components[j]];
+            printf("%s %s %d", (j > 0) ? " by" : "", kindNames[component.kind], component.numSlots);
+        }
+        printf(": %u states, up to %d moves\n", (unsigned int)table.distances.size(), deepest);
+    }
+    return true;
+}
+
+// Prints a shortest solution of the cube after the moves in a file using only the subgroup's moves.
+int RunSubgroupSolve(const char* generators, const char* moveFile)
+{
+    std::vector<Move> moves;
+    if (!ReadMoveFile(moveFile, moves))
+        return 1;
+    Cube cube;
+    InitCube(cube);
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyMove(cube, moves[i]);
+    }
+    Subgroup subgroup;
+    if (!BuildPrintedSubgroup(generators, subgroup))
+        return 1;
+
+    std::vector<Move> solution;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int result = SolveInSubgroup(subgroup, cube, SUBGROUP_MAX_LENGTH, solution);
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (result == SUBGROUP_NOT_MEMBER) {
+        printf("The cube is not in <%s>.\n", generators);
+        return 1;
+    }
+    if (result == SUBGROUP_NOT_FOUND) {
+        printf("No solution within %d moves.\n", SUBGROUP_MAX_LENGTH);
+        return 1;
+    }
+    PrintMoves(cube, solution.data(), solution.size());
+    printf("\n%d moves, found in %.3f ms.\n", (int)solution.size(), milliseconds);
+    return 0;
+}
+
+// Solves scrambles of random moves of a subgroup, checking each is found to be in it and solved.
+int RunSubgroupBenchmark(const char* generators, int numScrambles)
+{
+    Subgroup subgroup;
+    if (!BuildPrintedSubgroup(generators, subgroup))
+        return 1;
+    srand(BENCH_SOLVE_SEED);
+    std::vector<Move> solution;
+    long long totalMoves = 0;
+    int failures = 0;
+    double solveTime = 0.0;
+    for (int i = 0; i < numScrambles; i++) {
+        Cube cube;
+        InitCube(cube);
+        for (int move = 0; move < BENCH_SUBGROUP_MOVES; move++) {
+            ApplyMove(cube, subgroup.moves[rand() % subgroup.moves.size()]);
+        }
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool solved = IsInSubgroup(subgroup, cube) && SolveInSubgroup(subgroup, cube, SUBGROUP_MAX_LENGTH, solution) == SUBGROUP_FOUND;
+        solveTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        for (size_t move = 0; solved && move < solution.size(); move++) {
+            ApplyMove(cube, solution[move]);
+        }
+        if (!solved || CountIncorrectStickers(cube) != 0) {
+            failures++;
+            continue;
+        }
+        totalMoves += solution.size();
+    }
+    int solved = numScrambles - failures;
+    printf("%d scrambles solved in %.3f s (%.3f ms each), %d failed, %.2f moves on average.\n", solved, solveTime / 1e3,
+           solveTime / numScrambles, failures, solved > 0 ? (double)totalMoves / solved : 0.0);
+    return (failures == 0) ? 0 : 1;
+}
+
+// Prints each shorter solution the anytime solver finds, with the time it was found at.
+static bool PrintAnytimeSolution(const std::vector<Move>& solution, void* context)
+{
+    const SolutionPrinter* printer = (const SolutionPrinter*)context;
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - printer->start).count();
+    printf("%10.3f ms  ", milliseconds);
+    PrintMoves(printer->cube, solution.data(), solution.size());
+    printf("(%d)\n", (int)solution.size());
+    return true;
+}
+
+// Solves the cube after the moves in a file with the anytime solver, printing every improvement.
+int RunAnytime(const char* moveFile, double seconds)
+{
+    std::vector<Move> moves;
+    if (!ReadMoveFile(moveFile, moves))
+        return 1;
+    Cube cube;
+    InitCube(cube);
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyMove(cube, moves[i]);
+    }
+
+    AnytimeOptions options;
+    InitAnytimeOptions(options);
+    options.timeLimit = seconds;
+    SolutionPrinter printer = { cube, 0, std::chrono::steady_clock::now() };
+    int result = SolveAnytime(cube, options, PrintAnytimeSolution, &printer);
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - printer.start).count();
+    switch (result) {
+    case ANYTIME_OPTIMAL:
+        printf("Optimal, proved in %.3f ms.\n", milliseconds);
+        break;
+    case ANYTIME_TIMED_OUT:
+        printf("Stopped after %.3f s without proving the last is optimal.\n", milliseconds / 1e3);
+        break;
+    case ANYTIME_UNSOLVABLE:
+        printf("The cube can't be solved.\n");
+        return 1;
+    }
+    return 0;
+}
+
+// Loads a puzzle and works out its group and tables, printing what they are and how long they took.
+static bool LoadPrintedPuzzle(const char* filename, Puzzle& puzzle, PuzzleGroup& group)
+{
+    if (!LoadPuzzle(filename, puzzle))
+        return false;
+    printf("%s: %d points, %d moves (%d with their powers), %d orbits.\n", puzzle.name.c_str(), puzzle.numPoints,
+           (int)puzzle.generators.size(), (int)puzzle.moves.size(), puzzle.numOrbits);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    BuildPuzzleGroup(puzzle, group);
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    printf("  %s states, found in %.3f ms\n", FormatGroupOrder(group).c_str(), milliseconds);
+    start = std::chrono::steady_clock::now();
+    BuildPuzzleTables(puzzle);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (size_t i = 0; i < puzzle.tables.size(); i++) {
+        const PuzzleTable& table = puzzle.tables[i];
+        printf("  table of %d points: %u patterns, %s %d moves\n", (int)table.points.size(), (unsigned int)table.distances.size(),
+               table.complete ? "up to" : "complete to", table.deepest);
+    }
+    printf("  tables built in %.3f s\n", seconds);
+    return true;
+}
+
+static void PrintPuzzleMoves(const Puzzle& puzzle, const std::vector<int>& moves)
+{
+    for (size_t i = 0; i < moves.size(); i++) {
+        printf("%s ", puzzle.moves[moves[i]].name.c_str());
+    }
+    printf("\n");
+}
+
+// Prints what a puzzle's moves make of it.
+int RunPuzzleInfo(const char* puzzleFile)
+{
+    Puzzle puzzle;
+    PuzzleGroup group;
+    return LoadPrintedPuzzle(puzzleFile, puzzle, group) ? 0 : 1;
+}
+
+// Prints a shortest solution of a puzzle after the moves in a file.
+int RunPuzzleSolve(const char* puzzleFile, const char* moveFile)
+{
+    Puzzle puzzle;
+    PuzzleGroup group;
+    std::vector<int> moves;
+    if (!LoadPrintedPuzzle(puzzleFile, puzzle, group) || !ReadPuzzleMoves(puzzle, moveFile, moves))
+        return 1;
+    std::vector<unsigned char> state;
+    InitPuzzleState(puzzle, state);
+    for (size_t i = 0; i < moves.size(); i++) {
+        ApplyPuzzleMove(puzzle, moves[i], state);
+    }
+
+    std::vector<int> solution;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int result = SolvePuzzle(puzzle, state, PUZZLE_MAX_LENGTH, solution);
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (result == PUZZLE_NOT_FOUND) {
+        printf("No solution within %d moves.\n", PUZZLE_MAX_LENGTH);
+        return 1;
+    }
+    PrintPuzzleMoves(puzzle, solution);
+    printf("%d moves, found in %.3f ms.\n", (int)solution.size(), milliseconds);
+    return 0;
+}
+
+// Prints a scramble of a puzzle.
+int RunPuzzleScramble(const char* puzzleFile, unsigned int seed)
+{
+    Puzzle puzzle;
+    PuzzleGroup group;
+    if (!LoadPrintedPuzzle(puzzleFile, puzzle, group))
+        return 1;
+    std::vector<int> scramble;
+    ScramblePuzzle(puzzle, group, seed, scramble);
+    PrintPuzzleMoves(puzzle, scramble);
+    return 0;
+}
+
+// Solves random states of a puzzle, or short scrambles if its tables aren't complete, checking
+// each is found to be in its group and solved.
+int RunPuzzleBenchmark(const char* puzzleFile, int numScrambles)
+{
+    Puzzle puzzle;
+    PuzzleGroup group;
+    if (!LoadPrintedPuzzle(puzzleFile, puzzle, group))
+        return 1;
+    bool complete = true;
+    for (size_t i = 0; i < puzzle.tables.size(); i++) {
+        complete = complete && puzzle.tables[i].complete;
+    }
+    if (complete)
+        printf("Solving random states.\n");
+    else
+        printf("Solving scrambles of %d random moves.\n", BENCH_PUZZLE_MOVES);
+
+    srand(BENCH_SOLVE_SEED);
+    uint64_t seed = BENCH_SOLVE_SEED;
+    std::vector<unsigned char> state;
+    std::vector<int> solution;
+    long long totalMoves = 0;
+    int failures = 0;
+    double solveTime = 0.0;
+    for (int i = 0; i < numScrambles; i++) {
+        if (complete) {
+            RandomPuzzleState(group, seed, state);
+        }
+        else {
+            InitPuzzleState(puzzle, state);
+            for (int move = 0; move < BENCH_PUZZLE_MOVES; move++) {
+                ApplyPuzzleMove(puzzle, rand() % puzzle.moves.size(), state);
+            }
+        }
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool solved = IsInPuzzleGroup(group, state) && SolvePuzzle(puzzle, state, PUZZLE_MAX_LENGTH, solution) == PUZZLE_FOUND;
+        solveTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        for (size_t move = 0; solved && move < solution.size(); move++) {
+            ApplyPuzzleMove(puzzle, solution[move], state);
+        }
+        if (!solved || !IsPuzzleSolved(puzzle, state)) {
+            failures++;
+            continue;
+        }
+        totalMoves += solution.size();
+    }
+    int solved = numScrambles - failures;
+    printf("%d scrambles solved in %.3f s (%.3f ms each), %d failed, %.2f moves on average.\n", solved, solveTime / 1e3,
+           solveTime / numScrambles, failures, solved > 0 ? (double)totalMoves / solved : 0.0);
+    return (failures == 0) ? 0 : 1;
+}
+
+// Records a session of random events, saves and loads it, then checks that seeking to each event
+// finds the state it left. The file is written to captureDir and removed afterwards.
+int RunSessionBenchmark(int numEvents)
+{
+    srand(BENCH_SOLVE_SEED);
+    SessionWriter writer;
+    Cube cube;
+    InitCube(cube);
+    BeginSession(writer, cube);
+    std::vector<unsigned int> times(numEvents);
+    std::vector<Cube> states(numEvents);
+    unsigned int time = 0;
+    for (int i = 0; i < numEvents; i++) {
+        // Every event gets a time of its own, so a seek to it stops just after it.
+        time += 1 + rand() % BENCH_SESSION_MAX_GAP;
+        int kind = rand() % 100;
+        if (kind == 0) {
+            RecordSessionReset(writer, time);
+        }
+        else if (kind == 1) {
+            RecordSessionScramble(writer, (unsigned int)rand(), time);
+        }
+        else if (kind == 2) {
+            cube = writer.cube;
+            ApplyMove(cube, MoveFromCode(2 * (TURN_X + rand() % 3)));
+            ScrambleCube(cube, (unsigned int)rand());
+            RecordSessionState(writer, cube, time);
+        }
+        else {
+            RecordSessionMove(writer, MoveFromCode(rand() % NUM_OF_MOVE_CODES), time);
+        }
+        times[i] = time;
+        states[i] = writer.cube;
+    }
+
+    char filename[1024];
+    snprintf(filename, sizeof(filename), "%s/bench_session.cses", captureDir);
+    Session session;
+    if (!SaveSession(writer, filename))
+        return 1;
+    bool loaded = LoadSession(filename, session);
+    remove(filename);
+    if (!loaded)
+        return 1;
+    if (session.numEvents != writer.numEvents || session.duration != time) {
+        printf("The session loaded with %d events over %u ms, not %d over %u ms.\n", session.numEvents, session.duration, writer.numEvents, time);
+        return 1;
+    }
+
+    int wrong = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numEvents; i++) {
+        SessionCursor cursor;
+        SeekSession(session, times[i], cube, cursor);
+        if (memcmp(&cube, &states[i], sizeof(cube)) != 0)
+            wrong++;
+    }
+    double seekTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    printf("%d events in %d bytes (%.2f a move or event), %d seeks in %.3f s (%.2f us each), %d wrong.\n", numEvents,
+           (int)session.data.size(), (double)session.data.size() / numEvents, numEvents, seekTime / 1e6, seekTime / numEvents, wrong);
+    return (wrong == 0) ? 0 : 1;
+}
+
+void PrintUsage(const char* program)
+{
+    printf("Usage: %s [--measure-redraws] [--measure-latency] [--capture-dir DIR] [--trace FILE]\n", program);
+    printf("          [--play MOVE_FILE | --replay SESSION_FILE]\n");
+    printf("       %s --bench-render FRAMES [--size WIDTHxHEIGHT]\n", program);
+    printf("       %s --bench-scripts CUBES\n", program);
+    printf("       %s --search MOVE_FILE [--search-memory MB]\n", program);
+    printf("       %s --solve MOVE_FILE\n", program);
+    printf("       %s --bench-solve SCRAMBLES\n", program);
+    printf("       %s --bench-session EVENTS [--capture-dir DIR]\n", program);
+    printf("       %s --optimize MOVE_FILE\n", program);
+    printf("       %s --enumerate DEPTH [--enumerate-memory MB] [--enumerate-dir DIR] [--write-states]\n", program);
+    printf("          [--workers N]\n");
+    printf("       %s --solve-pocket MOVE_FILE [--pocket-table FILE] [--workers N]\n", program);
+    printf("       %s --bench-pocket SCRAMBLES [--pocket-table FILE] [--workers N]\n", program);
+    printf("       %s --solve-subgroup MOVE_FILE [--subgroup GENERATORS]\n", program);
+    printf("       %s --bench-subgroup SCRAMBLES [--subgroup GENERATORS]\n", program);
+    printf("       %s --anytime MOVE_FILE [--anytime-seconds SECONDS]\n", program);
+    printf("       %s --puzzle FILE [--solve-puzzle MOVE_FILE | --scramble-puzzle SEED | --bench-puzzle SCRAMBLES]\n", program);
+    printf("       %s --headless MOVE_FILE OUTPUT_DIR [--size WIDTHxHEIGHT] [--format png|ppm]\n", program);
+    printf("          [--workers N] [--view LATITUDE LONGITUDE] [--last-frame] [--trace FILE]\n");
+}
+
 int main(int argc, char** argv)
 {
+    HeadlessOptions headless = { NULL, NULL, IMAGE_FORMAT_PNG, (int)std::thread::hardware_concurrency(), false };
+    int benchFrames = 0;
+    int benchCubes = 0;
+    const char* playFile = NULL;
+    const char* replayFile = NULL;
+    const char* searchFile = NULL;
+    size_t searchMemory = 0;
+    const char* solveFile = NULL;
+    const char* optimizeFile = NULL;
+    int benchScrambles = 0;
+    int benchSession = 0;
+    const char* pocketFile = NULL;
+    const char* pocketTable = NULL;
+    int benchPocket = 0;
+    const char* subgroupGenerators = SUBGROUP_RU;
+    const char* subgroupFile = NULL;
+    int benchSubgroup = 0;
+    const char* anytimeFile = NULL;
+    const char* puzzleFile = NULL;
+    const char* puzzleMoveFile = NULL;
+    int puzzleScrambleSeed = -1;
+    int benchPuzzle = 0;
+    EnumerateOptions enumerate;
+    InitEnumerateOptions(enumerate);
+    enumerate.maxDepth = 0;
+    if (headless.numWorkers < 1)
+        headless.numWorkers = 1;
+
+    // Parse the command line. Options not starting with "--" are left for glutInit.
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--", 2) != 0) {
+            continue;
+        }
+        else if (strcmp(argv[i], "--measure-redraws") == 0) {
+            measureRedraws = true;
+        }
+        else if (strcmp(argv[i], "--measure-latency") == 0) {
+            measureLatency = true;
+        }
+        else if (strcmp(argv[i], "--headless") == 0 && i + 2 < argc) {
+            headless.moveFile = argv[++i];
+            headless.outputDir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc && sscanf(argv[i + 1], "%dx%d", &winWidth, &winHeight) == 2 && winWidth > 0 && winHeight > 0) {
+            i++;
+        }
+        else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc && (strcmp(argv[i + 1], "png") == 0 || strcmp(argv[i + 1], "ppm") == 0)) {
+            headless.format = (strcmp(argv[++i], "png") == 0) ? IMAGE_FORMAT_PNG : IMAGE_FORMAT_PPM;
+        }
+        else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            headless.numWorkers = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--view") == 0 && i + 2 < argc) {
+            eyeLatitude = atof(argv[++i]);
+            eyeLongitude = atof(argv[++i]);
+            if (eyeLatitude < EYE_MIN_LATITUDE) eyeLatitude = EYE_MIN_LATITUDE;
+            if (eyeLatitude > EYE_MAX_LATITUDE) eyeLatitude = EYE_MAX_LATITUDE;
+        }
+        else if (strcmp(argv[i], "--bench-render") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            benchFrames = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--bench-scripts") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            benchCubes = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--search") == 0 && i + 1 < argc) {
+            searchFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--search-memory") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            searchMemory = (size_t)atoi(argv[++i]) << 20;
+        }
+        else if (strcmp(argv[i], "--solve") == 0 && i + 1 < argc) {
+            solveFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--optimize") == 0 && i + 1 < argc) {
+            optimizeFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--bench-solve") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            benchScrambles = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--bench-session") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            benchSession = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--enumerate") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0 && atoi(argv[i + 1]) <= ENUMERATE_MAX_DEPTH) {
+            enumerate.maxDepth = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--enumerate-memory") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            enumerate.maxMemory = (size_t)atoi(argv[++i]) << 20;
+        }
+        else if (strcmp(argv[i], "--enumerate-dir") == 0 && i + 1 < argc) {
+            enumerate.directory = argv[++i];
+        }
+        else if (strcmp(argv[i], "--write-states") == 0) {
+            enumerate.writeDatabase = true;
+        }
+        else if (strcmp(argv[i], "--solve-pocket") == 0 && i + 1 < argc) {
+            pocketFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--bench-pocket") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            benchPocket = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--pocket-table") == 0 && i + 1 < argc) {
+            pocketTable = argv[++i];
+        }
+        else if (strcmp(argv[i], "--subgroup") == 0 && i + 1 < argc) {
+            subgroupGenerators = argv[++i];
+        }
+        else if (strcmp(argv[i], "--solve-subgroup") == 0 && i + 1 < argc) {
+            subgroupFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--bench-subgroup") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            benchSubgroup = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--anytime") == 0 && i + 1 < argc) {
+            anytimeFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--anytime-seconds") == 0 && i + 1 < argc && atof(argv[i + 1]) >= 0.0) {
+            anytimeSeconds = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--puzzle") == 0 && i + 1 < argc) {
+            puzzleFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--solve-puzzle") == 0 && i + 1 < argc) {
+            puzzleMoveFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--scramble-puzzle") == 0 && i + 1 < argc && atoi(argv[i + 1]) >= 0) {
+            puzzleScrambleSeed = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--bench-puzzle") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0) {
+            benchPuzzle = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--play") == 0 && i + 1 < argc) {
+            playFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--capture-dir") == 0 && i + 1 < argc) {
+            captureDir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--last-frame") == 0) {
+            headless.lastFrameOnly = true;
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceFile = argv[++i];
+        }
+        else {
+            printf("Invalid option '%s'.\n", argv[i]);
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    TRACE_THREAD_NAME("main");
+    if (traceFile != NULL)
+        atexit(SaveTraceOnExit);
+
+    if (headless.moveFile != NULL)
+        return RunHeadless(headless);
+
+    if (benchCubes > 0) {
+        RunScriptBenchmark(benchCubes);
+        return 0;
+    }
+
+    if (searchFile != NULL)
+        return RunSearch(searchFile, searchMemory);
+
+    if (solveFile != NULL)
+        return RunSolve(solveFile);
+
+    if (optimizeFile != NULL)
+        return RunOptimize(optimizeFile);
+
+    if (benchScrambles > 0)
+        return RunSolveBenchmark(benchScrambles);
+
+    if (benchSession > 0)
+        return RunSessionBenchmark(benchSession);
+
+    if (enumerate.maxDepth > 0) {
+        if (enumerate.writeDatabase && enumerate.directory == NULL) {
+            printf("--write-states needs an --enumerate-dir to write to.\n");
+            return 1;
+        }
+        enumerate.numThreads = headless.numWorkers;
+        return RunEnumerate(enumerate);
+    }
+
+    if (pocketFile != NULL)
+        return RunPocketSolve(pocketFile, pocketTable, headless.numWorkers);
+
+    if (benchPocket > 0)
+        return RunPocketBenchmark(benchPocket, pocketTable, headless.numWorkers);
+
+    if (subgroupFile != NULL)
+        return RunSubgroupSolve(subgroupGenerators, subgroupFile);
+
+    if (benchSubgroup > 0)
+        return RunSubgroupBenchmark(subgroupGenerators, benchSubgroup);
+
+    if (anytimeFile != NULL)
+        return RunAnytime(anytimeFile, anytimeSeconds);
+
+    if (puzzleFile == NULL && (puzzleMoveFile != NULL || puzzleScrambleSeed >= 0 || benchPuzzle > 0)) {
+        printf("--solve-puzzle, --scramble-puzzle and --bench-puzzle need a --puzzle to work on.\n");
+        return 1;
+    }
+    if (puzzleFile != NULL) {
+        if (puzzleMoveFile != NULL)
+            return RunPuzzleSolve(puzzleFile, puzzleMoveFile);
+        if (puzzleScrambleSeed >= 0)
+            return RunPuzzleScramble(puzzleFile, puzzleScrambleSeed);
+        if (benchPuzzle > 0)
+            return RunPuzzleBenchmark(puzzleFile, benchPuzzle);
+        return RunPuzzleInfo(puzzleFile);
+    }
+
+    std::vector<Move> demoMoves;
+    if (playFile != NULL && !ReadMoveFile(playFile, demoMoves))
+        return 1;
+    if (replayFile != NULL) {
+        if (!LoadSession(replayFile, replaySession))
+            return 1;
+        replaying = true;
+        printf("Replaying %s: %d events over %u.%03u s.\n", replayFile, replaySession.numEvents, replaySession.duration / 1000, replaySession.duration % 1000);
+    }
+
+#if defined(CUBE_HEADLESS)
+    if (benchFrames > 0) {
+        if (!CreateOffscreenContext(winWidth, winHeight))
+            return 1;
+        RunRenderBenchmark(benchFrames);
+        DestroyOffscreenContext();
+        return 0;
+    }
+#endif
+
     glutInit(&argc, argv);
+
     glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE | GLUT_DEPTH);
     glutInitWindowSize(winWidth, winHeight);
     glutCreateWindow("main");
 
+    if (benchFrames > 0) {
+        RunRenderBenchmark(benchFrames);
+        return 0;
+    }
+
     Init();
-    InitCube();
+    InitStickerMatrices();
+    Cube solved;
+    InitCube(solved);
+    InitHistory(history, solved);
+    for (size_t i = 0; i < demoMoves.size(); i++) {
+        RecordHistoryMove(history, demoMoves[i]);
+    }
+    StartSimulation(demoMoves, replaying ? &replaySession : NULL);
+    atexit(StopSimulation);
+    atexit(StopBackgroundSolve);
+    atexit(StopCapture);
 
     // Register the callback functions.
     glutDisplayFunc(DisplayFunc);
     glutReshapeFunc(ReshapeFunc);
     glutKeyboardFunc(KeyboardFunc);
     glutSpecialFunc(SpecialKeyFunc);
-    glutTimerFunc(0, TimerFunc, 0);
+    glutVisibilityFunc(VisibilityFunc);
+    glutMouseFunc(MouseFunc);
+    glutMotionFunc(MotionFunc);
+#ifndef __APPLE__
+    // Closing the window destroys the context before the atexit handlers run, so a recording
+    // is finished while its pixel buffers can still be read.
+    glutCloseFunc(StopCapture);
+#endif
+    WakeSolver();
+
+    if (measureLatency)
+        atexit(PrintLatencyReport);
+    if (measureRedraws) {
+        measureStartTime = glutGet(GLUT_ELAPSED_TIME);
+        atexit(PrintRedrawReport);
+    }
 
     // Display user instructions in console window.
     printf("Press LEFT ARROW to move eye left.\n");
@@ -981,6 +2587,7 @@ int main(int argc, char** argv)
     printf("Press PAGE DN to move further.\n");
     printf("Press 'O/P' to orient the cube in the x-axis anticlockwise/clockwise.\n");
     printf("Press 'K/L' to orient the cube in the y-axis anticlockwise/clockwise.\n");
+    printf("Press ',/.' to orient the cube in the z-axis anticlockwise/clockwise.\n");
     printf("Press 'W' to toggle wireframe.\n");
     printf("Press 'X' to toggle axes.\n");
     printf("Press 'B' to toggle backface culling.\n");
@@ -988,6 +2595,19 @@ int main(int argc, char** argv)
     printf("Press 'I' to reset the cube.\n");
     printf("Press '0' to scramble cube.\n");
     printf("Press 'M' to toggle colour mode.\n");
+    printf("Press 'C' to save a screenshot.\n");
+    printf("Press 'V' to start/stop recording.\n");
+    printf("Press F3 to toggle the performance HUD.\n");
+    printf("Press 'T' to save a timeline trace.\n");
+    if (replaying) {
+        printf("Press SPACE to pause or play the replay.\n");
+        printf("Press '[' or ']' to skip the replay back or forward, or click the scrub bar.\n");
+    }
+    else {
+        printf("Press F5 to start/stop recording the session.\n");
+        printf("Press 'Z/Y' to undo/redo, and 'J' to show the history timeline.\n");
+        printf("Press F6 to play the shortest solution found so far (top right), or to stop it.\n");
+    }
     printf("Press 'Q' to quit.\n\n");
     printf("Current Keybinds:\n");
     printf("1/a - U'/U\n");
@@ -996,6 +2616,10 @@ int main(int argc, char** argv)
     printf("4/f - B'/B\n");
     printf("5/g - R'/R\n");
     printf("6/h - D'/D\n");
+    printf("7/u - M'/M\n");
+    printf("8/e - E'/E\n");
+    printf("9/n - S'/S\n");
+    printf("SHIFT with 1-6/a-h - the wide turns (Uw, Fw, Lw, Bw, Rw, Dw)\n");
     printf("\n");
 
     // Enter GLUT event loop.
@@ -0,0 +1,102 @@
+#include <math.h>
+#include <string.h>
+
+#include "matrix.h"
+
+#define PI                  3.1415926535897932384626433832795
+
+void MatrixIdentity(double m[16])
+{
+    memset(m, 0, 16 * sizeof(double));
+    m[0] = m[5] = m[10] = m[15] = 1.0;
+}
+
+void MatrixMultiply(const double a[16], const double b[16], double result[16])
+{
+    for (int col = 0; col < 4; col++) {
+        for (int row = 0; row < 4; row++) {
+            result[col * 4 + row] = a[row] * b[col * 4] + a[4 + row] * b[col * 4 + 1] + a[8 + row] * b[col * 4 + 2] + a[12 + row] * b[col * 4 + 3];
+        }
+    }
+}
+
+void MatrixRotation(double angle, double x, double y, double z, double m[16])
+{
+    MatrixIdentity(m);
+    double length = sqrt(x * x + y * y + z * z);
+    if (length == 0.0)
+        return;
+    x /= length;
+    y /= length;
+    z /= length;
+
+    double c = cos(angle / 180.0 * PI);
+    double s = sin(angle / 180.0 * PI);
+    m[0] = x * x * (1 - c) + c;
+    m[1] = y * x * (1 - c) + z * s;
+    m[2] = x * z * (1 - c) - y * s;
+    m[4] = x * y * (1 - c) - z * s;
+    m[5] = y * y * (1 - c) + c;
+    m[6] = y * z * (1 - c) + x * s;
+    m[8] = x * z * (1 - c) + y * s;
+    m[9] = y * z * (1 - c) - x * s;
+    m[10] = z * z * (1 - c) + c;
+}
+
+void MatrixTranslation(double x, double y, double z, double m[16])
+{
+    MatrixIdentity(m);
+    m[12] = x;
+    m[13] = y;
+    m[14] = z;
+}
+
+void MatrixPerspective(double fovy, double aspect, double zNear, double zFar, double m[16])
+{
+    double f = 1.0 / tan(fovy / 360.0 * PI);
+    memset(m, 0, 16 * sizeof(double));
+    m[0] = f / aspect;
+    m[5] = f;
+    m[10] = (zFar + zNear) / (zNear - zFar);
+    m[11] = -1.0;
+    m[14] = 2.0 * zFar * zNear / (zNear - zFar);
+}
+
+void MatrixLookAt(double eyeX, double eyeY, double eyeZ, double centerX, double centerY, double centerZ, double upX, double upY, double upZ, double m[16])
+{
+    // Forward, side and recomputed up vectors of the eye.
+    double f[3] = { centerX - eyeX, centerY - eyeY, centerZ - eyeZ };
+    double length = sqrt(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
+    f[0] /= length;
+    f[1] /= length;
+    f[2] /= length;
+
+    double s[3] = { f[1] * upZ - f[2] * upY, f[2] * upX - f[0] * upZ, f[0] * upY - f[1] * upX };
+    length = sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+    s[0] /= length;
+    s[1] /= length;
+    s[2] /= length;
+
+    double u[3] = { s[1] * f[2] - s[2] * f[1], s[2] * f[0] - s[0] * f[2], s[0] * f[1] - s[1] * f[0] };
+
+    MatrixIdentity(m);
+    m[0] = s[0];
+    m[4] = s[1];
+    m[8] = s[2];
+    m[1] = u[0];
+    m[5] = u[1];
+    m[9] = u[2];
+    m[2] = -f[0];
+    m[6] = -f[1];
+    m[10] = -f[2];
+    m[12] = -(s[0] * eyeX + s[1] * eyeY + s[2] * eyeZ);
+    m[13] = -(u[0] * eyeX + u[1] * eyeY + u[2] * eyeZ);
+    m[14] = f[0] * eyeX + f[1] * eyeY + f[2] * eyeZ;
+}
+
+void MatrixTransformPoint(const double m[16], double x, double y, double z, double result[4])
+{
+    for (int row = 0; row < 4; row++) {
+        result[row] = m[row] * x + m[4 + row] * y + m[8 + row] * z + m[12 + row];
+    }
+}
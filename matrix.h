@@ -0,0 +1,28 @@
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////
+// MATRIX FUNCTIONS
+//
+// 4x4 transformation matrices, stored column-major like OpenGL's, built the
+// same way as the matching fixed function calls (glRotated, gluLookAt, ...).
+/////////////////////////////////////////////////////////////////////////////
+
+void MatrixIdentity(double m[16]);
+
+// result = a * b. result may not alias a or b.
+void MatrixMultiply(const double a[16], const double b[16], double result[16]);
+
+// Rotation by angle degrees about the axis (x, y, z), like glRotated.
+void MatrixRotation(double angle, double x, double y, double z, double m[16]);
+
+// Translation by (x, y, z), like glTranslated.
+void MatrixTranslation(double x, double y, double z, double m[16]);
+
+// Perspective projection, like gluPerspective.
+void MatrixPerspective(double fovy, double aspect, double zNear, double zFar, double m[16]);
+
+// Viewing transformation, like gluLookAt.
+void MatrixLookAt(double eyeX, double eyeY, double eyeZ, double centerX, double centerY, double centerZ, double upX, double upY, double upZ, double m[16]);
+
+// Transforms the point (x, y, z, 1), giving homogeneous coordinates.
+void MatrixTransformPoint(const double m[16], double x, double y, double z, double result[4]);
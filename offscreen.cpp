@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "offscreen.h"
+
+#if defined(CUBE_HEADLESS_EGL)
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+static EGLDisplay eglDisplay = EGL_NO_DISPLAY;
+static EGLSurface eglSurface = EGL_NO_SURFACE;
+static EGLContext eglContext = EGL_NO_CONTEXT;
+
+bool CreateOffscreenContext(int width, int height)
+{
+    // Prefer Mesa's surfaceless platform, which needs neither a display server nor a GPU.
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay != NULL)
+        eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if (eglDisplay == EGL_NO_DISPLAY)
+        eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (eglDisplay == EGL_NO_DISPLAY || !eglInitialize(eglDisplay, NULL, NULL)) {
+        printf("Unable to open an EGL display.\n");
+        return false;
+    }
+
+    const EGLint configAttribs[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                     EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                                     EGL_RED_SIZE, 8,
+                                     EGL_GREEN_SIZE, 8,
+                                     EGL_BLUE_SIZE, 8,
+                                     EGL_DEPTH_SIZE, 24,
+                                     EGL_NONE };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(eglDisplay, configAttribs, &config, 1, &numConfigs) || numConfigs == 0) {
+        printf("No EGL config supports desktop OpenGL pbuffers.\n");
+        return false;
+    }
+
+    const EGLint surfaceAttribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+    eglSurface = eglCreatePbufferSurface(eglDisplay, config, surfaceAttribs);
+    if (eglSurface == EGL_NO_SURFACE) {
+        printf("Unable to create a %dx%d EGL pbuffer (error 0x%x).\n", width, height, eglGetError());
+        return false;
+    }
+
+    // The drawing code uses the fixed function pipeline, so ask for a default (compatibility) context.
+    eglBindAPI(EGL_OPENGL_API);
+    eglContext = eglCreateContext(eglDisplay, config, EGL_NO_CONTEXT, NULL);
+    if (eglContext == EGL_NO_CONTEXT || !eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext)) {
+        printf("Unable to create an EGL OpenGL context (error 0x%x).\n", eglGetError());
+        return false;
+    }
+    return true;
+}
+
+void DestroyOffscreenContext()
+{
+    if (eglDisplay == EGL_NO_DISPLAY)
+        return;
+    eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (eglContext != EGL_NO_CONTEXT)
+        eglDestroyContext(eglDisplay, eglContext);
+    if (eglSurface != EGL_NO_SURFACE)
+        eglDestroySurface(eglDisplay, eglSurface);
+    eglTerminate(eglDisplay);
+    eglDisplay = EGL_NO_DISPLAY;
+    eglSurface = EGL_NO_SURFACE;
+    eglContext = EGL_NO_CONTEXT;
+}
+
+void* OffscreenGetProcAddress(const char* name)
+{
+    return (void*)eglGetProcAddress(name);
+}
+
+const char* OffscreenBackendName()
+{
+    return "EGL pbuffer";
+}
+
+#elif defined(CUBE_HEADLESS_OSMESA)
+
+#include <GL/osmesa.h>
+
+static OSMesaContext osmesaContext = NULL;
+static unsigned char* osmesaBuffer = NULL;
+
+bool CreateOffscreenContext(int width, int height)
+{
+    osmesaContext = OSMesaCreateContextExt(OSMESA_RGBA, 24, 0, 0, NULL);
+    if (osmesaContext == NULL) {
+        printf("Unable to create an OSMesa context.\n");
+        return false;
+    }
+
+    osmesaBuffer = (unsigned char*)malloc((size_t)width * height * 4);
+    if (osmesaBuffer == NULL || !OSMesaMakeCurrent(osmesaContext, osmesaBuffer, GL_UNSIGNED_BYTE, width, height)) {
+        printf("Unable to make a %dx%d OSMesa buffer current.\n", width, height);
+        return false;
+    }
+    return true;
+}
+
+void DestroyOffscreenContext()
+{
+    if (osmesaContext != NULL)
+        OSMesaDestroyContext(osmesaContext);
+    free(osmesaBuffer);
+    osmesaContext = NULL;
+    osmesaBuffer = NULL;
+}
+
+void* OffscreenGetProcAddress(const char* name)
+{
+    return (void*)OSMesaGetProcAddress(name);
+}
+
+const char* OffscreenBackendName()
+{
+    return "OSMesa";
+}
+
+#else
+
+bool CreateOffscreenContext(int width, int height)
+{
+    printf("Headless rendering is not available. Rebuild with CUBE_HEADLESS_EGL or CUBE_HEADLESS_OSMESA defined.\n");
+    return false;
+}
+
+void DestroyOffscreenContext()
+{
+}
+
+void* OffscreenGetProcAddress(const char* name)
+{
+    return NULL;
+}
+
+const char* OffscreenBackendName()
+{
+    return "none";
+}
+
+#endif
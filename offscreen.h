@@ -0,0 +1,27 @@
+#pragma once
+
+/////////////////////////////////////////////////////////////////////////////
+// OFFSCREEN CONTEXT
+//
+// Creates an OpenGL context that renders into an offscreen buffer, for
+// machines with no display. Build with CUBE_HEADLESS_EGL defined to use an
+// EGL pbuffer (link with -lEGL), or CUBE_HEADLESS_OSMESA to use OSMesa
+// (link with -lOSMesa). Without either, headless rendering is unavailable.
+/////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUBE_HEADLESS_EGL) || defined(CUBE_HEADLESS_OSMESA)
+#define CUBE_HEADLESS
+#endif
+
+// Creates an offscreen context of the given size and makes it current on the calling thread.
+// Prints the reason and returns false on failure.
+bool CreateOffscreenContext(int width, int height);
+
+// Destroys the context made by CreateOffscreenContext.
+void DestroyOffscreenContext();
+
+// Looks up an OpenGL function of the offscreen context by name.
+void* OffscreenGetProcAddress(const char* name);
+
+// Name of the offscreen backend compiled in.
+const char* OffscreenBackendName();
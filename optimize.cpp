@@ -0,0 +1,146 @@
+#include <string.h>
+
+#include "optimize.h"
+
+// Layers of an axis, indexed from the negative end.
+#define AXIS_LAYERS             3
+
+// Turns about one axis, as quarter turns of each layer clockwise looking from the positive end.
+struct AxisRun {
+    int axis;
+    int amounts[AXIS_LAYERS];
+};
+
+// The fewest rotations from orientation 0 to each orientation.
+struct RotationTable {
+    std::vector<Move> rotations[NUM_OF_ORIENTATIONS];
+
+    RotationTable();
+};
+
+static const int directions[3] = { CLOCKWISE, ANTI_CLOCKWISE, HALF_TURN };
+
+RotationTable::RotationTable()
+{
+    // BFS over the orientations.
+    bool reached[NUM_OF_ORIENTATIONS] = {};
+    std::vector<int> level(1, 0), next;
+    reached[0] = true;
+    while (!level.empty()) {
+        next.clear();
+        for (size_t i = 0; i < level.size(); i++) {
+            for (int turn = TURN_X; turn <= TURN_Z; turn++) {
+                for (int d = 0; d < 3; d++) {
+                    Move rotation = { turn, directions[d], 0.0 };
+                    Cube cube;
+                    cube.orientation = level[i];
+                    ApplyMove(cube, rotation);
+                    if (reached[cube.orientation])
+                        continue;
+                    reached[cube.orientation] = true;
+                    rotations[cube.orientation] = rotations[level[i]];
+                    rotations[cube.orientation].push_back(rotation);
+                    next.push_back(cube.orientation);
+                }
+            }
+        }
+        level.swap(next);
+    }
+}
+
+// Quarter turns clockwise looking from the positive end of the axis.
+static int QuarterTurns(int direction, int sign)
+{
+    int turns = (direction == CLOCKWISE) ? 1 : (direction == ANTI_CLOCKWISE) ? 3 : 2;
+    return (turns * sign + 4) % 4;
+}
+
+static int LayerIndex(int layer)
+{
+    return (layer == LAYER_NEGATIVE) ? 0 : (layer == LAYER_MIDDLE) ? 1 : 2;
+}
+
+// Adds the turn of some layers by a number of quarter turns seen from the positive end.
+static void AddTurn(int axis, int layers, int amount, std::vector<Move>& moves)
+{
+    if (amount % 4 == 0)
+        return;
+    int turn = TurnOfLayers(axis, layers);
+    int turnAxis, turnLayers, sign;
+    TurnLayers(turn, &turnAxis, &turnLayers, &sign);
+    int turns = (amount * sign + 8) % 4;
+    Move move = { turn, (turns == 1) ? CLOCKWISE : (turns == 3) ? ANTI_CLOCKWISE : HALF_TURN, 0.0 };
+    moves.push_back(move);
+}
+
+// Adds the fewest turns that turn each layer of a run as far, in the order of their TURN_ numbers.
+static void AddRun(const AxisRun& run, std::vector<Move>& moves)
+{
+    // Try every amount of the two wide turns; the face and slice turns make up the rest. Ties go to
+    // the first tried, so no wide turns when they don't save a move.
+    int bestCount = AXIS_LAYERS + 3;
+    int best[5] = {};
+    for (int negativeWide = 0; negativeWide < 4; negativeWide++) {
+        for (int positiveWide = 0; positiveWide < 4; positiveWide++) {
+            int amounts[5] = { (run.amounts[0] - negativeWide + 8) % 4,
+                               (run.amounts[1] - negativeWide - positiveWide + 8) % 4,
+                               (run.amounts[2] - positiveWide + 8) % 4,
+                               negativeWide, positiveWide };
+            int count = 0;
+            for (int i = 0; i < 5; i++) {
+                count += (amounts[i] != 0);
+            }
+            if (count < bestCount) {
+                bestCount = count;
+                memcpy(best, amounts, sizeof(best));
+            }
+        }
+    }
+
+    // Faces, then slices, then wide turns, as the TURN_ numbers go; positive ends before negative.
+    AddTurn(run.axis, LAYER_POSITIVE, best[2], moves);
+    AddTurn(run.axis, LAYER_NEGATIVE, best[0], moves);
+    AddTurn(run.axis, LAYER_MIDDLE, best[1], moves);
+    AddTurn(run.axis, LAYER_POSITIVE | LAYER_MIDDLE, best[4], moves);
+    AddTurn(run.axis, LAYER_NEGATIVE | LAYER_MIDDLE, best[3], moves);
+}
+
+void OptimizeMoves(const std::vector<Move>& moves, std::vector<Move>& optimized)
+{
+    static const RotationTable rotationTable;
+
+    // The runs so far, as a stack: a move about the same axis as the last run joins it, and a run
+    // that comes to nothing is taken off so the next move can join the one before.
+    std::vector<AxisRun> runs;
+    Cube rotated;
+    rotated.orientation = 0;
+    for (size_t i = 0; i < moves.size(); i++) {
+        const Move& move = moves[i];
+        if (move.turn >= TURN_X) {
+            ApplyMove(rotated, move);
+            continue;
+        }
+
+        int axis, layers, sign;
+        TurnLayers(move.turn, &axis, &layers, &sign);
+        if (runs.empty() || runs.back().axis != axis) {
+            AxisRun run = { axis, { 0, 0, 0 } };
+            runs.push_back(run);
+        }
+        AxisRun& run = runs.back();
+        int amount = QuarterTurns(move.direction, sign);
+        for (int layer = LAYER_NEGATIVE; layer <= LAYER_POSITIVE; layer <<= 1) {
+            if (layers & layer)
+                run.amounts[LayerIndex(layer)] = (run.amounts[LayerIndex(layer)] + amount) % 4;
+        }
+        if (run.amounts[0] == 0 && run.amounts[1] == 0 && run.amounts[2] == 0)
+            runs.pop_back();
+    }
+
+    optimized.clear();
+    for (size_t i = 0; i < runs.size(); i++) {
+        AddRun(runs[i], optimized);
+    }
+    const std::vector<Move>& rotations = rotationTable.rotations[rotated.orientation];
+    optimized.insert(optimized.end(), rotations.begin(), rotations.end());
+}
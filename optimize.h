@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// MOVE SEQUENCE OPTIMIZER
+//
+// Rewrites a sequence of moves, as applied with ApplyMove, into a shorter
+// canonical one that leaves any cube in exactly the same state:
+//
+// - Turns about the same axis all commute, so a run of them only matters
+//   as how far each of the three layers turns in total. Each run becomes
+//   the fewest face, slice and wide turns that turn the layers as far, in
+//   the order of their TURN_ numbers (U before D, F before B, R before L).
+//   A run that comes to nothing disappears, and the runs either side of it
+//   merge when they are about the same axis (U R R' U' is nothing).
+// - Moves are oriented, so a rotation changes nothing but the orientation
+//   and commutes with every turn. The rotations are taken out and the
+//   fewest that make the same orientation go at the end.
+//
+// Each move is looked at once, so it takes time linear in the moves.
+/////////////////////////////////////////////////////////////////////////////
+
+// Sets optimized to the canonical form of moves. The two may not be the same vector.
+void OptimizeMoves(const std::vector<Move>& moves, std::vector<Move>& optimized);
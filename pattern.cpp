@@ -0,0 +1,117 @@
+#include <string.h>
+#include <vector>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PATTERN_SSE2
+#endif
+
+#include "pattern.h"
+
+#if defined(PATTERN_SSE2)
+// A pattern with each word in both halves of a vector.
+struct PatternVectors {
+    __m128i mask[3];
+    __m128i colours[3];
+};
+#endif
+
+void MakePattern(const Cube& cube, Pattern& pattern)
+{
+    memset(&pattern, 0, sizeof(pattern));
+    const int* stickers = &cube.stickers[0][0];
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        if (stickers[sticker] == GREY)
+            continue;
+        int word = sticker / PACKED_STICKERS_PER_WORD;
+        int shift = 3 * (sticker % PACKED_STICKERS_PER_WORD);
+        pattern.mask.words[word] |= (uint64_t)7 << shift;
+        pattern.colours.words[word] |= (uint64_t)stickers[sticker] << shift;
+    }
+}
+
+void MakeStagePattern(int stage, Pattern& pattern)
+{
+    Cube cube;
+    InitCube(cube);
+    int* stickers = &cube.stickers[0][0];
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        // Where the piece is: its layer from the bottom, and how many of its coordinates are in
+        // the middle (1 for an edge, 2 for a centre).
+        int piece = StickerPiece(sticker);
+        int layer = (piece / 3) % 3;
+        int middles = (piece % 3 == 1) + (layer == 1) + (piece / 9 == 1);
+        bool matters;
+        if (stage == PATTERN_CROSS)
+            matters = (middles == 2) || (layer == 0 && middles == 1);
+        else if (stage == PATTERN_F2L)
+            matters = (middles == 2) || (layer < 2);
+        else if (stage == PATTERN_OLL)
+            matters = (middles == 2) || (layer < 2) || (sticker / NUM_OF_SQUARES == FACE_UP);
+        else
+            matters = true;
+        if (!matters)
+            stickers[sticker] = GREY;
+    }
+    MakePattern(cube, pattern);
+}
+
+void MatchPatterns(const PackedCube* states, size_t numStates, const Pattern* patterns, size_t numPatterns, uint64_t* matches)
+{
+    size_t words = PATTERN_MATCH_WORDS(numPatterns);
+    memset(matches, 0, numStates * words * sizeof(uint64_t));
+    size_t state = 0;
+
+#if defined(PATTERN_SSE2)
+    // Two states side by side, so one pass of vector operations checks both. SSE2 has no 64-bit
+    // compare, so a state matches when both 32-bit halves of its difference are zero.
+    std::vector<PatternVectors> vectors(numPatterns);
+    for (size_t pattern = 0; pattern < numPatterns; pattern++) {
+        for (int word = 0; word < 3; word++) {
+            vectors[pattern].mask[word] = _mm_set1_epi64x((long long)patterns[pattern].mask.words[word]);
+            vectors[pattern].colours[word] = _mm_set1_epi64x((long long)patterns[pattern].colours.words[word]);
+        }
+    }
+    for (; state + 2 <= numStates; state += 2) {
+        const PackedCube& first = states[state];
+        const PackedCube& second = states[state + 1];
+        __m128i word0 = _mm_set_epi64x((long long)second.words[0], (long long)first.words[0]);
+        __m128i word1 = _mm_set_epi64x((long long)second.words[1], (long long)first.words[1]);
+        __m128i word2 = _mm_set_epi64x((long long)second.words[2], (long long)first.words[2]);
+        uint64_t* firstMatches = matches + state * words;
+        uint64_t* secondMatches = firstMatches + words;
+        for (size_t pattern = 0; pattern < numPatterns; pattern++) {
+            const PatternVectors& vector = vectors[pattern];
+            __m128i difference = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_xor_si128(word0, vector.colours[0]), vector.mask[0]),
+                                                           _mm_and_si128(_mm_xor_si128(word1, vector.colours[1]), vector.mask[1])),
+                                              _mm_and_si128(_mm_xor_si128(word2, vector.colours[2]), vector.mask[2]));
+            int zero = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(difference, _mm_setzero_si128())));
+            uint64_t bit = (uint64_t)1 << (pattern % 64);
+            if ((zero & 3) == 3)
+                firstMatches[pattern / 64] |= bit;
+            if ((zero & 12) == 12)
+                secondMatches[pattern / 64] |= bit;
+        }
+    }
+#endif
+
+    for (; state < numStates; state++) {
+        for (size_t pattern = 0; pattern < numPatterns; pattern++) {
+            if (MatchPattern(states[state], patterns[pattern]))
+                matches[state * words + pattern / 64] |= (uint64_t)1 << (pattern % 64);
+        }
+    }
+}
+
+void RecolourByCentres(const Cube& cube, Cube& recoloured)
+{
+    int faces[NUM_OF_FACES];
+    for (int face = 0; face < NUM_OF_FACES; face++) {
+        faces[cube.stickers[face][4]] = face;
+    }
+    for (int face = 0; face < NUM_OF_FACES; face++) {
+        for (int square = 0; square < NUM_OF_SQUARES; square++) {
+            recoloured.stickers[face][square] = faces[cube.stickers[face][square]];
+        }
+    }
+    recoloured.orientation = cube.orientation;
+}
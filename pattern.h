@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// PATTERNS
+//
+// A goal where only some stickers matter, e.g. "cross solved" or "last
+// layer oriented". A pattern is made from a cube whose GREY stickers match
+// anything, and is kept as a mask and the expected colours on the layout of
+// a PackedCube, so matching a state is three XORs, ANDs and a test for zero.
+// MatchPatterns checks a whole batch of states against many patterns at
+// once, two states to a vector where SSE2 is available.
+/////////////////////////////////////////////////////////////////////////////
+
+#define PATTERN_CROSS           0      // The D face's edges solved, with the centres.
+#define PATTERN_F2L             1      // The D and middle layers solved.
+#define PATTERN_OLL             2      // The first two layers solved and the U face all one colour.
+#define PATTERN_SOLVED          3
+#define NUM_OF_STAGE_PATTERNS   4
+
+// Words of MatchPatterns results for each state checked against numPatterns patterns.
+#define PATTERN_MATCH_WORDS(numPatterns) (((numPatterns) + 63) / 64)
+
+struct Pattern {
+    PackedCube mask;            // All three bits of each sticker that matters.
+    PackedCube colours;         // The colours they must have, 0 elsewhere.
+};
+
+// Makes a pattern of the stickers of a cube, where GREY stickers match anything.
+void MakePattern(const Cube& cube, Pattern& pattern);
+
+// Makes one of the PATTERN_ stages of solving, from the solved cube.
+void MakeStagePattern(int stage, Pattern& pattern);
+
+inline bool MatchPattern(const PackedCube& state, const Pattern& pattern)
+{
+    return (((state.words[0] ^ pattern.colours.words[0]) & pattern.mask.words[0]) |
+            ((state.words[1] ^ pattern.colours.words[1]) & pattern.mask.words[1]) |
+            ((state.words[2] ^ pattern.colours.words[2]) & pattern.mask.words[2])) == 0;
+}
+
+// Checks every state against every pattern. Bit p % 64 of matches[s * PATTERN_MATCH_WORDS(numPatterns) + p / 64]
+// is set if state s matches pattern p.
+void MatchPatterns(const PackedCube* states, size_t numStates, const Pattern* patterns, size_t numPatterns, uint64_t* matches);
+
+// Recolours each sticker with the face whose centre is its colour, so stage patterns still match
+// after slice turns have moved the centres.
+void RecolourByCentres(const Cube& cube, Cube& recoloured);
@@ -0,0 +1,461 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "pocket.h"
+
+#define POCKET_CORNERS          8
+#define POCKET_PERMUTATIONS     5040       // 7!
+#define POCKET_TWISTS           729        // 3^6
+#define POCKET_HELD_SLOT        7          // DBL, which U, R and F don't move.
+#define POCKET_UNREACHED        15
+#define POCKET_TABLE_SIZE       (POCKET_STATES / 2)
+
+static const int moveDirections[3] = { CLOCKWISE, ANTI_CLOCKWISE, HALF_TURN };
+static const int pocketTurns[3] = { TURN_U, TURN_R, TURN_F };
+static const int oppositeFaces[NUM_OF_FACES] = { FACE_DOWN, FACE_BACK, FACE_LEFT, FACE_FRONT, FACE_RIGHT, FACE_UP };
+
+// The direction each face looks, on the axes of StickerPiece.
+static const int faceNormals[NUM_OF_FACES][3] = { { 0, 1, 0 }, { 0, 0, 1 }, { 1, 0, 0 }, { 0, 0, -1 }, { -1, 0, 0 }, { 0, -1, 0 } };
+
+struct PocketTables {
+    // The stickers of each corner slot, its U or D sticker first and then clockwise seen from
+    // outside, and the colours of the corner that belongs there in the same order. Slots are
+    // numbered from the right, up, front corner to DBL.
+    int slotStickers[POCKET_CORNERS][3];
+    int homeColours[POCKET_CORNERS][3];
+    signed char colourPiece[NUM_OF_FACES * NUM_OF_FACES * NUM_OF_FACES];   // Colours in order to their corner, or -1.
+
+    unsigned short permutationMoves[POCKET_PERMUTATIONS][POCKET_MOVES];
+    unsigned short twistMoves[POCKET_TWISTS][POCKET_MOVES];
+
+    PocketTables();
+};
+
+static Move PocketMove(int move)
+{
+    Move result = { pocketTurns[move / 3], moveDirections[move % 3], 0.0 };
+    return result;
+}
+
+static int PermutationIndex(const int pieces[POCKET_CORNERS])
+{
+    int index = 0;
+    for (int i = 0; i < POCKET_HELD_SLOT; i++) {
+        int smaller = 0;
+        for (int j = i + 1; j < POCKET_HELD_SLOT; j++) {
+            smaller += (pieces[j] < pieces[i]);
+        }
+        index = index * (POCKET_HELD_SLOT - i) + smaller;
+    }
+    return index;
+}
+
+static void PermutationPieces(int index, int pieces[POCKET_CORNERS])
+{
+    int digits[POCKET_HELD_SLOT];
+    for (int i = POCKET_HELD_SLOT - 1; i >= 0; i--) {
+        digits[i] = index % (POCKET_HELD_SLOT - i);
+        index /= POCKET_HELD_SLOT - i;
+    }
+    int remaining[POCKET_HELD_SLOT] = { 0, 1, 2, 3, 4, 5, 6 };
+    for (int i = 0; i < POCKET_HELD_SLOT; i++) {
+        pieces[i] = remaining[digits[i]];
+        memmove(&remaining[digits[i]], &remaining[digits[i] + 1], (POCKET_HELD_SLOT - 1 - digits[i]) * sizeof(int));
+    }
+    pieces[POCKET_HELD_SLOT] = POCKET_HELD_SLOT;
+}
+
+static int TwistIndex(const int twists[POCKET_CORNERS])
+{
+    int index = 0;
+    for (int i = POCKET_HELD_SLOT - 2; i >= 0; i--) {
+        index = index * 3 + twists[i];
+    }
+    return index;
+}
+
+static void TwistsOfIndex(int index, int twists[POCKET_CORNERS])
+{
+    int sum = 0;
+    for (int i = 0; i < POCKET_HELD_SLOT - 1; i++) {
+        twists[i] = index % 3;
+        sum += twists[i];
+        index /= 3;
+    }
+    twists[POCKET_HELD_SLOT - 1] = (3 - sum % 3) % 3;
+    twists[POCKET_HELD_SLOT] = 0;
+}
+
+// The corner in each slot of a cube and how far it is twisted clockwise from its U or D colour
+// being on the slot's U or D sticker. Returns false if they aren't eight different corners.
+static bool ReadCorners(const PocketTables& tables, const Cube& cube, int pieces[POCKET_CORNERS], int twists[POCKET_CORNERS])
+{
+    const int* stickers = &cube.stickers[0][0];
+    bool seen[POCKET_CORNERS] = {};
+    for (int slot = 0; slot < POCKET_CORNERS; slot++) {
+        int colours[3];
+        twists[slot] = -1;
+        for (int i = 0; i < 3; i++) {
+            colours[i] = stickers[tables.slotStickers[slot][i]];
+            if (colours[i] < 0 || colours[i] >= NUM_OF_FACES)
+                return false;
+            if (colours[i] == FACE_UP || colours[i] == FACE_DOWN)
+                twists[slot] = i;
+        }
+        if (twists[slot] < 0)
+            return false;
+        int t = twists[slot];
+        int piece = tables.colourPiece[(colours[t] * NUM_OF_FACES + colours[(t + 1) % 3]) * NUM_OF_FACES + colours[(t + 2) % 3]];
+        if (piece < 0 || seen[piece])
+            return false;
+        seen[piece] = true;
+        pieces[slot] = piece;
+    }
+    return true;
+}
+
+PocketTables::PocketTables()
+{
+    // Find the stickers of each corner slot, the slots numbered by their place from the highest down.
+    int numStickers[POCKET_CORNERS] = {};
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        int piece = StickerPiece(sticker);
+        int x = piece % 3, y = (piece / 3) % 3, z = piece / 9;
+        if (x == 1 || y == 1 || z == 1)
+            continue;
+        int slot = POCKET_CORNERS - 1 - (x / 2 + 2 * (y / 2) + 4 * (z / 2));
+        slotStickers[slot][numStickers[slot]++] = sticker;
+    }
+    for (int slot = 0; slot < POCKET_CORNERS; slot++) {
+        int* corner = slotStickers[slot];
+        while (corner[0] / NUM_OF_SQUARES != FACE_UP && corner[0] / NUM_OF_SQUARES != FACE_DOWN) {
+            int first = corner[0];
+            corner[0] = corner[1];
+            corner[1] = corner[2];
+            corner[2] = first;
+        }
+        // Clockwise seen from outside when the normals make a left-handed set.
+        const int* a = faceNormals[corner[0] / NUM_OF_SQUARES];
+        const int* b = faceNormals[corner[1] / NUM_OF_SQUARES];
+        const int* c = faceNormals[corner[2] / NUM_OF_SQUARES];
+        int determinant = a[0] * (b[1] * c[2] - b[2] * c[1]) - a[1] * (b[0] * c[2] - b[2] * c[0]) + a[2] * (b[0] * c[1] - b[1] * c[0]);
+        if (determinant > 0) {
+            int second = corner[1];
+            corner[1] = corner[2];
+            corner[2] = second;
+        }
+    }
+
+    Cube cube;
+    InitCube(cube);
+    memset(colourPiece, -1, sizeof(colourPiece));
+    for (int slot = 0; slot < POCKET_CORNERS; slot++) {
+        for (int i = 0; i < 3; i++) {
+            homeColours[slot][i] = (&cube.stickers[0][0])[slotStickers[slot][i]];
+        }
+        colourPiece[(homeColours[slot][0] * NUM_OF_FACES + homeColours[slot][1]) * NUM_OF_FACES + homeColours[slot][2]] = (signed char)slot;
+    }
+
+    // Where each move takes the corners, and how far it twists them, by turning a solved cube. The
+    // coordinates' moves follow from those.
+    int from[POCKET_MOVES][POCKET_CORNERS], twisted[POCKET_MOVES][POCKET_CORNERS];
+    int pieces[POCKET_CORNERS], twists[POCKET_CORNERS];
+    for (int move = 0; move < POCKET_MOVES; move++) {
+        InitCube(cube);
+        ApplyMove(cube, PocketMove(move));
+        ReadCorners(*this, cube, from[move], twisted[move]);
+    }
+    for (int permutation = 0; permutation < POCKET_PERMUTATIONS; permutation++) {
+        PermutationPieces(permutation, pieces);
+        for (int move = 0; move < POCKET_MOVES; move++) {
+            int moved[POCKET_CORNERS];
+            for (int slot = 0; slot < POCKET_CORNERS; slot++) {
+                moved[slot] = pieces[from[move][slot]];
+            }
+            permutationMoves[permutation][move] = (unsigned short)PermutationIndex(moved);
+        }
+    }
+    for (int twist = 0; twist < POCKET_TWISTS; twist++) {
+        TwistsOfIndex(twist, twists);
+        for (int move = 0; move < POCKET_MOVES; move++) {
+            int moved[POCKET_CORNERS];
+            for (int slot = 0; slot < POCKET_CORNERS; slot++) {
+                moved[slot] = (twists[from[move][slot]] + twisted[move][slot]) % 3;
+            }
+            twistMoves[twist][move] = (unsigned short)TwistIndex(moved);
+        }
+    }
+}
+
+static const PocketTables& GetPocketTables()
+{
+    static const PocketTables tables;
+    return tables;
+}
+
+static int Distance(const unsigned char* distances, uint32_t state)
+{
+    return (distances[state >> 1] >> ((state & 1) * 4)) & 15;
+}
+
+static void SetDistance(unsigned char* distances, uint32_t state, int distance)
+{
+    int shift = (state & 1) * 4;
+    distances[state >> 1] = (unsigned char)((distances[state >> 1] & ~(15 << shift)) | (distance << shift));
+}
+
+static uint32_t MoveState(const PocketTables& tables, uint32_t state, int move)
+{
+    return tables.permutationMoves[state / POCKET_TWISTS][move] * POCKET_TWISTS + tables.twistMoves[state % POCKET_TWISTS][move];
+}
+
+// Finds the states of the next depth in a share of the table, without writing to it: the neighbours
+// of the frontier when pushing, or the states not yet reached with a neighbour in it when pulling.
+static void SearchDepth(const PocketTables* tables, const unsigned char* distances, int depth, bool pull,
+                        uint32_t begin, uint32_t end, std::vector<uint32_t>* found)
+{
+    for (uint32_t state = begin; state < end; state++) {
+        int distance = Distance(distances, state);
+        if (pull && distance == POCKET_UNREACHED) {
+            for (int move = 0; move < POCKET_MOVES; move++) {
+                if (Distance(distances, MoveState(*tables, state, move)) == depth) {
+                    found->push_back(state);
+                    break;
+                }
+            }
+        }
+        else if (!pull && distance == depth) {
+            for (int move = 0; move < POCKET_MOVES; move++) {
+                uint32_t next = MoveState(*tables, state, move);
+                if (Distance(distances, next) == POCKET_UNREACHED)
+                    found->push_back(next);
+            }
+        }
+    }
+}
+
+void InitPocketTable(PocketTable& table)
+{
+    table.distances = NULL;
+    table.mapping = NULL;
+    table.mappingSize = 0;
+}
+
+void BuildPocketTable(PocketTable& table, int numThreads)
+{
+    const PocketTables& tables = GetPocketTables();
+    FreePocketTable(table);
+    table.data.assign(POCKET_TABLE_SIZE, 0xFF);
+    unsigned char* distances = table.data.data();
+    table.distances = distances;
+    if (numThreads < 1)
+        numThreads = 1;
+
+    // The moves are their own inverses' set, so pulling from the frontier finds the same states as
+    // pushing from it. Pull once the frontier outgrows what's left to reach.
+    SetDistance(distances, 0, 0);
+    uint32_t frontier = 1, unreached = POCKET_STATES - 1;
+    std::vector<std::vector<uint32_t> > found(numThreads);
+    for (int depth = 0; frontier > 0 && depth < POCKET_MAX_DISTANCE; depth++) {
+        bool pull = frontier > unreached / 4;
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; i++) {
+            uint32_t begin = (uint32_t)((uint64_t)POCKET_STATES * i / numThreads);
+            uint32_t end = (uint32_t)((uint64_t)POCKET_STATES * (i + 1) / numThreads);
+            found[i].clear();
+            if (i + 1 < numThreads)
+                threads.push_back(std::thread(SearchDepth, &tables, distances, depth, pull, begin, end, &found[i]));
+            else
+                SearchDepth(&tables, distances, depth, pull, begin, end, &found[i]);
+        }
+        for (size_t i = 0; i < threads.size(); i++) {
+            threads[i].join();
+        }
+
+        frontier = 0;
+        for (int i = 0; i < numThreads; i++) {
+            for (size_t j = 0; j < found[i].size(); j++) {
+                if (Distance(distances, found[i][j]) == POCKET_UNREACHED) {
+                    SetDistance(distances, found[i][j], depth + 1);
+                    frontier++;
+                }
+            }
+        }
+        unreached -= frontier;
+    }
+}
+
+bool SavePocketTable(const PocketTable& table, const char* filename)
+{
+    unsigned char header[POCKET_HEADER_SIZE] = { 'C', 'P', 'K', 'T', POCKET_FILE_VERSION, 0, 0, 0 };
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL) {
+        printf("Unable to write 2x2x2 table %s.\n", filename);
+        return false;
+    }
+    bool ok = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+              fwrite(table.distances, 1, POCKET_TABLE_SIZE, file) == POCKET_TABLE_SIZE;
+    if (fclose(file) != 0 || !ok) {
+        printf("Unable to write 2x2x2 table %s.\n", filename);
+        return false;
+    }
+    return true;
+}
+
+static bool IsPocketHeader(const unsigned char* header)
+{
+    return memcmp(header, "CPKT", 4) == 0 && header[4] == POCKET_FILE_VERSION;
+}
+
+bool LoadPocketTable(PocketTable& table, const char* filename)
+{
+    FreePocketTable(table);
+#if defined(_WIN32)
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL) {
+        printf("Unable to open 2x2x2 table %s.\n", filename);
+        return false;
+    }
+    unsigned char header[POCKET_HEADER_SIZE];
+    table.data.resize(POCKET_TABLE_SIZE);
+    bool ok = fread(header, 1, sizeof(header), file) == sizeof(header) && IsPocketHeader(header) &&
+              fread(table.data.data(), 1, POCKET_TABLE_SIZE, file) == POCKET_TABLE_SIZE;
+    fclose(file);
+    if (!ok) {
+        table.data.clear();
+        printf("%s is not a 2x2x2 table.\n", filename);
+        return false;
+    }
+    table.distances = table.data.data();
+    return true;
+#else
+    int file = open(filename, O_RDONLY);
+    if (file < 0) {
+        printf("Unable to open 2x2x2 table %s.\n", filename);
+        return false;
+    }
+    struct stat status;
+    size_t size = POCKET_HEADER_SIZE + POCKET_TABLE_SIZE;
+    void* mapping = MAP_FAILED;
+    if (fstat(file, &status) == 0 && (size_t)status.st_size == size)
+        mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (mapping == MAP_FAILED || !IsPocketHeader((const unsigned char*)mapping)) {
+        if (mapping != MAP_FAILED)
+            munmap(mapping, size);
+        printf("%s is not a 2x2x2 table.\n", filename);
+        return false;
+    }
+    table.mapping = mapping;
+    table.mappingSize = size;
+    table.distances = (const unsigned char*)mapping + POCKET_HEADER_SIZE;
+    return true;
+#endif
+}
+
+void FreePocketTable(PocketTable& table)
+{
+#if !defined(_WIN32)
+    if (table.mapping != NULL)
+        munmap(table.mapping, table.mappingSize);
+#endif
+    table.mapping = NULL;
+    table.mappingSize = 0;
+    table.distances = NULL;
+    std::vector<unsigned char>().swap(table.data);
+}
+
+void CountPocketDistances(const PocketTable& table, uint32_t counts[POCKET_MAX_DISTANCE + 1])
+{
+    memset(counts, 0, (POCKET_MAX_DISTANCE + 1) * sizeof(uint32_t));
+    for (uint32_t state = 0; state < POCKET_STATES; state++) {
+        int distance = Distance(table.distances, state);
+        if (distance <= POCKET_MAX_DISTANCE)
+            counts[distance]++;
+    }
+}
+
+// The state of the corners of a cube, coloured so the corner in DBL is solved: its colours, and
+// the opposite ones, become the faces they are on. Returns false if they aren't a 2x2x2.
+static bool PocketState(const PocketTables& tables, const Cube& cube, uint32_t* state)
+{
+    const int* stickers = &cube.stickers[0][0];
+    int faces[NUM_OF_FACES];
+    for (int colour = 0; colour < NUM_OF_FACES; colour++) {
+        faces[colour] = -1;
+    }
+    for (int i = 0; i < 3; i++) {
+        int colour = stickers[tables.slotStickers[POCKET_HELD_SLOT][i]];
+        int face = tables.homeColours[POCKET_HELD_SLOT][i];
+        if (colour < 0 || colour >= NUM_OF_FACES || faces[colour] >= 0 || faces[oppositeFaces[colour]] >= 0)
+            return false;
+        faces[colour] = face;
+        faces[oppositeFaces[colour]] = oppositeFaces[face];
+    }
+
+    Cube recoloured = cube;
+    int* recolouredStickers = &recoloured.stickers[0][0];
+    for (int slot = 0; slot < POCKET_CORNERS; slot++) {
+        for (int i = 0; i < 3; i++) {
+            int sticker = tables.slotStickers[slot][i];
+            int colour = stickers[sticker];
+            recolouredStickers[sticker] = (colour >= 0 && colour < NUM_OF_FACES) ? faces[colour] : -1;
+        }
+    }
+    int pieces[POCKET_CORNERS], twists[POCKET_CORNERS];
+    if (!ReadCorners(tables, recoloured, pieces, twists))
+        return false;
+    int sum = 0;
+    for (int slot = 0; slot < POCKET_CORNERS; slot++) {
+        sum += twists[slot];
+    }
+    if (pieces[POCKET_HELD_SLOT] != POCKET_HELD_SLOT || twists[POCKET_HELD_SLOT] != 0 || sum % 3 != 0)
+        return false;
+    *state = (uint32_t)(PermutationIndex(pieces) * POCKET_TWISTS + TwistIndex(twists));
+    return true;
+}
+
+int PocketDistance(const PocketTable& table, const Cube& cube)
+{
+    uint32_t state;
+    if (!PocketState(GetPocketTables(), cube, &state))
+        return -1;
+    int distance = Distance(table.distances, state);
+    return (distance <= POCKET_MAX_DISTANCE) ? distance : -1;
+}
+
+bool SolvePocket(const PocketTable& table, const Cube& cube, std::vector<Move>& solution)
+{
+    const PocketTables& tables = GetPocketTables();
+    solution.clear();
+    uint32_t state;
+    if (!PocketState(tables, cube, &state))
+        return false;
+    int distance = Distance(table.distances, state);
+    if (distance > POCKET_MAX_DISTANCE)
+        return false;
+    while (distance > 0) {
+        int move = 0;
+        uint32_t next = state;
+        for (; move < POCKET_MOVES; move++) {
+            next = MoveState(tables, state, move);
+            if (Distance(table.distances, next) == distance - 1)
+                break;
+        }
+        if (move == POCKET_MOVES)
+            return false;       // Not a table of distances.
+        solution.push_back(PocketMove(move));
+        state = next;
+        distance--;
+    }
+    return true;
+}
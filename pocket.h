@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// 2x2x2 DISTANCE TABLE
+//
+// The 2x2x2 is the corners of the cube on their own. Turning a face of it
+// is the same as turning the opposite face and the whole cube, so holding
+// the DBL corner still loses nothing: every state is reached with U, R and
+// F turns, and there are 7! * 3^6 = 3674160 of them. A BFS from solved
+// fills a table of how many face turns (half turns counting as one) each
+// is from solved, four bits a state, in 1.8 MB. With the table, an optimal
+// solution is a greedy descent: from any state one of the 9 moves is a
+// move closer, so the first found is taken until solved.
+//
+// A state is numbered by the permutation of the seven other corners
+// (0-5039) and the twists of the first six (0-728, the seventh making up
+// the rest). The moves are tables of each, worked out from where turning
+// a Cube takes its corners. The BFS runs a depth at a time on several
+// threads: while the frontier is small each thread turns its share of it,
+// and once it is most of what's left each thread instead checks its share
+// of the states not yet reached for a neighbour in the frontier. Both
+// only read the table; the states found are written between depths.
+//
+// FILE FORMAT
+// "CPKT", a version byte and three zero bytes, then the table as it is in
+// memory: POCKET_STATES / 2 bytes, the even state in the low four bits.
+// Loading a file maps it rather than reading it where the platform can.
+/////////////////////////////////////////////////////////////////////////////
+
+#define POCKET_STATES           3674160    // 7! * 3^6.
+#define POCKET_MOVES            9          // U, R and F: turn * 3 + CLOCKWISE, ANTI_CLOCKWISE or HALF_TURN.
+#define POCKET_MAX_DISTANCE     11         // God's number of the 2x2x2 in face turns.
+#define POCKET_FILE_VERSION     1
+#define POCKET_HEADER_SIZE      8
+
+struct PocketTable {
+    const unsigned char* distances;     // POCKET_STATES / 2 bytes, the even state in the low four bits.
+    std::vector<unsigned char> data;    // The table when it was built, or read rather than mapped.
+    void* mapping;                      // The mapped file, or NULL.
+    size_t mappingSize;
+};
+
+// Sets the table to empty, before it is first built or loaded.
+void InitPocketTable(PocketTable& table);
+
+// Fills the table by a BFS on numThreads threads.
+void BuildPocketTable(PocketTable& table, int numThreads);
+
+// Writes the table to a file, or maps one. Each prints the reason and returns false if it can't.
+bool SavePocketTable(const PocketTable& table, const char* filename);
+bool LoadPocketTable(PocketTable& table, const char* filename);
+
+// Frees a table that was built or loaded.
+void FreePocketTable(PocketTable& table);
+
+// Sets counts[d] to the number of states d face turns from solved.
+void CountPocketDistances(const PocketTable& table, uint32_t counts[POCKET_MAX_DISTANCE + 1]);
+
+// The face turns the corners of a cube are from being a solved 2x2x2, any colour on any face, or -1
+// if they can't be (e.g. a corner twisted in place).
+int PocketDistance(const PocketTable& table, const Cube& cube);
+
+// Sets solution to the fewest U, R and F turns that solve the corners of a cube as a 2x2x2, leaving
+// the DBL corner where it is. Returns false if they can't be solved.
+bool SolvePocket(const PocketTable& table, const Cube& cube, std::vector<Move>& solution);
@@ -0,0 +1,762 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "puzzle.h"
+
+typedef std::vector<unsigned char> Permutation;
+
+// The state of an IDA* search.
+struct PuzzleSearch {
+    const Puzzle* puzzle;
+    std::vector<unsigned char> states;  // The state at each depth, one after another.
+    std::vector<unsigned char> pattern;
+    std::vector<int> path;
+};
+
+// Random numbers for scrambles and random states, the same for a seed everywhere.
+static uint32_t NextPuzzleRandom(uint64_t& seed)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(seed >> 33);
+}
+
+static void Identity(int numPoints, Permutation& permutation)
+{
+    permutation.resize(numPoints);
+    for (int point = 0; point < numPoints; point++) {
+        permutation[point] = (unsigned char)point;
+    }
+}
+
+// The permutation that does b, then a.
+static Permutation Compose(const Permutation& a, const Permutation& b)
+{
+    Permutation result(b.size());
+    for (size_t point = 0; point < b.size(); point++) {
+        result[point] = a[b[point]];
+    }
+    return result;
+}
+
+static Permutation Invert(const Permutation& permutation)
+{
+    Permutation result(permutation.size());
+    for (size_t point = 0; point < permutation.size(); point++) {
+        result[permutation[point]] = (unsigned char)point;
+    }
+    return result;
+}
+
+// The least common multiple of the lengths of the cycles, stopping once it is over limit.
+static int PermutationOrder(const Permutation& permutation, int limit)
+{
+    std::vector<bool> seen(permutation.size(), false);
+    long long order = 1;
+    for (size_t point = 0; point < permutation.size() && order <= limit; point++) {
+        long long length = 0;
+        for (size_t at = point; !seen[at]; at = permutation[at]) {
+            seen[at] = true;
+            length++;
+        }
+        if (length > 0) {
+            long long a = order, b = length;
+            while (b != 0) {
+                long long r = a % b;
+                a = b;
+                b = r;
+            }
+            order = order / a * length;
+        }
+    }
+    return (order > limit) ? limit + 1 : (int)order;
+}
+
+// Reads a whole line, however long, without its comment. Returns false at the end of the file.
+static bool ReadLine(FILE* file, std::string& line)
+{
+    line.clear();
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), file) != NULL) {
+        line += buffer;
+        if (line[line.size() - 1] == '\n')
+            break;
+    }
+    if (line.empty())
+        return false;
+    size_t comment = line.find('#');
+    if (comment != std::string::npos)
+        line.erase(comment);
+    return true;
+}
+
+// Parses cycles like "(0 1 2)(3 4)" into where each point goes. Returns false if they aren't
+// cycles of different points.
+static bool ParseCycles(const char* text, int numPoints, Permutation& image)
+{
+    Identity(numPoints, image);
+    std::vector<bool> seen(numPoints, false);
+    const char* at = text;
+    while (true) {
+        while (*at == ' ' || *at == '\t' || *at == '\r' || *at == '\n')
+            at++;
+        if (*at == '\0')
+            return true;
+        if (*at != '(')
+            return false;
+        at++;
+        int first = -1, previous = -1;
+        while (true) {
+            while (*at == ' ' || *at == '\t' || *at == ',')
+                at++;
+            if (*at == ')') {
+                at++;
+                break;
+            }
+            char* end;
+            long point = strtol(at, &end, 10);
+            if (end == at || point < 0 || point >= numPoints || seen[point])
+                return false;
+            seen[point] = true;
+            at = end;
+            if (previous >= 0)
+                image[previous] = (unsigned char)point;
+            else
+                first = (int)point;
+            previous = (int)point;
+        }
+        if (previous >= 0)
+            image[previous] = (unsigned char)first;
+    }
+}
+
+// Adds a move and its powers, named as in the file format.
+static bool AddGenerator(Puzzle& puzzle, const std::string& name, const Permutation& image)
+{
+    int order = PermutationOrder(image, PUZZLE_MAX_ORDER);
+    if (order == 1 || order > PUZZLE_MAX_ORDER)
+        return false;
+    int generator = (int)puzzle.generators.size();
+    puzzle.generatorNames.push_back(name);
+    puzzle.generators.push_back(image);
+    puzzle.orders.push_back(order);
+    puzzle.firstMoves.push_back((int)puzzle.moves.size());
+    Permutation power = image;
+    for (int p = 1; p < order; p++) {
+        PuzzleMove move;
+        int turns = (p <= order / 2) ? p : order - p;
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), (turns > 1) ? "%d" : "", turns);
+        move.name = name + suffix + ((p <= order / 2) ? "" : "'");
+        if (FindPuzzleMove(puzzle, move.name.c_str()) >= 0)
+            return false;
+        move.generator = generator;
+        move.power = p;
+        move.from = Invert(power);
+        puzzle.moves.push_back(move);
+        power = Compose(image, power);
+    }
+    return true;
+}
+
+// Works out the orbits of the points and which moves may follow which.
+static void CompilePuzzle(Puzzle& puzzle)
+{
+    std::vector<int> parents(puzzle.numPoints);
+    for (int point = 0; point < puzzle.numPoints; point++) {
+        parents[point] = point;
+    }
+    for (size_t g = 0; g < puzzle.generators.size(); g++) {
+        for (int point = 0; point < puzzle.numPoints; point++) {
+            int a = point, b = puzzle.generators[g][point];
+            while (parents[a] != a)
+                a = parents[a];
+            while (parents[b] != b)
+                b = parents[b];
+            parents[std::max(a, b)] = std::min(a, b);
+        }
+    }
+    puzzle.orbits.assign(puzzle.numPoints, -1);
+    puzzle.numOrbits = 0;
+    for (int point = 0; point < puzzle.numPoints; point++) {
+        int root = point;
+        while (parents[root] != root)
+            root = parents[root];
+        if (puzzle.orbits[root] < 0)
+            puzzle.orbits[root] = puzzle.numOrbits++;
+        puzzle.orbits[point] = puzzle.orbits[root];
+    }
+
+    // Turning a move again is never shortest, and of two that commute only one order is needed.
+    int numGenerators = (int)puzzle.generators.size();
+    puzzle.follows.assign(numGenerators * numGenerators, 0);
+    for (int a = 0; a < numGenerators; a++) {
+        for (int b = 0; b < numGenerators; b++) {
+            bool commute = Compose(puzzle.generators[a], puzzle.generators[b]) == Compose(puzzle.generators[b], puzzle.generators[a]);
+            puzzle.follows[a * numGenerators + b] = (a != b && !(commute && b < a));
+        }
+    }
+}
+
+bool LoadPuzzle(const char* filename, Puzzle& puzzle)
+{
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        printf("Unable to open puzzle file '%s'.\n", filename);
+        return false;
+    }
+    puzzle = Puzzle();
+    puzzle.name = filename;
+    puzzle.numPoints = 0;
+    puzzle.scrambleLength = PUZZLE_SCRAMBLE_LENGTH;
+
+    std::string line;
+    int lineNumber = 0;
+    const char* error = NULL;
+    while (error == NULL && ReadLine(file, line)) {
+        lineNumber++;
+        char directive[64], name[64];
+        int used = 0;
+        if (sscanf(line.c_str(), " %63s %n", directive, &used) != 1)
+            continue;
+        const char* values = line.c_str() + used;
+
+        if (strcmp(directive, "name") == 0) {
+            puzzle.name = values;
+            puzzle.name.erase(puzzle.name.find_last_not_of(" \t\r\n") + 1);
+        }
+        else if (strcmp(directive, "points") == 0) {
+            if (puzzle.numPoints > 0 || sscanf(values, "%d", &puzzle.numPoints) != 1 || puzzle.numPoints < 1 || puzzle.numPoints > PUZZLE_MAX_POINTS)
+                error = "the number of points must be given once, from 1 to 256";
+        }
+        else if (puzzle.numPoints == 0) {
+            error = "the number of points must come first";
+        }
+        else if (strcmp(directive, "colours") == 0) {
+            puzzle.colours.clear();
+            char* end;
+            for (long colour = strtol(values, &end, 10); end != values; colour = strtol(values, &end, 10)) {
+                if (colour < 0 || colour >= PUZZLE_UNREACHED)
+                    break;
+                puzzle.colours.push_back((unsigned char)colour);
+                values = end;
+            }
+            if ((int)puzzle.colours.size() != puzzle.numPoints)
+                error = "there must be a colour from 0 to 254 for every point";
+        }
+        else if (strcmp(directive, "scramble") == 0) {
+            if (sscanf(values, "%d", &puzzle.scrambleLength) != 1 || puzzle.scrambleLength < 1)
+                error = "a scramble needs some moves";
+        }
+        else if (strcmp(directive, "move") == 0) {
+            Permutation image;
+            if (sscanf(values, "%63[^ \t\r\n(=']%n", name, &used) != 1) {
+                error = "a move needs a name";
+                continue;
+            }
+            values += used;
+            while (*values == ' ' || *values == '\t')
+                values++;
+            if (*values == '=') {
+                // The moves it is made of, in order.
+                Identity(puzzle.numPoints, image);
+                std::string parts = values + 1;
+                for (char* token = strtok(&parts[0], " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+                    int move = FindPuzzleMove(puzzle, token);
+                    if (move < 0) {
+                        error = "a move is made of moves already defined";
+                        break;
+                    }
+                    image = Compose(Invert(puzzle.moves[move].from), image);
+                }
+            }
+            else if (!ParseCycles(values, puzzle.numPoints, image)) {
+                error = "a move is cycles of different points";
+            }
+            if (error == NULL && !AddGenerator(puzzle, name, image))
+                error = "a move must do something, have an order of at most 12 and a name no other has";
+        }
+        else {
+            error = "this isn't a directive";
+        }
+    }
+    fclose(file);
+    if (error == NULL && puzzle.moves.empty())
+        error = "the puzzle has no moves";
+    if (error != NULL) {
+        printf("%s:%d: %s.\n", filename, lineNumber, error);
+        return false;
+    }
+
+    if (puzzle.colours.empty())
+        Identity(puzzle.numPoints, puzzle.colours);
+    CompilePuzzle(puzzle);
+    return true;
+}
+
+bool ReadPuzzleMoves(const Puzzle& puzzle, const char* filename, std::vector<int>& moves)
+{
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        printf("Unable to open move file '%s'.\n", filename);
+        return false;
+    }
+    std::string line;
+    int lineNumber = 0;
+    bool ok = true;
+    while (ok && ReadLine(file, line)) {
+        lineNumber++;
+        for (char* token = strtok(&line[0], " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+            int move = FindPuzzleMove(puzzle, token);
+            if (move < 0) {
+                printf("%s:%d: '%s' is not a move of the %s.\n", filename, lineNumber, token, puzzle.name.c_str());
+                ok = false;
+                break;
+            }
+            moves.push_back(move);
+        }
+    }
+    fclose(file);
+    return ok;
+}
+
+int FindPuzzleMove(const Puzzle& puzzle, const char* name)
+{
+    for (size_t move = 0; move < puzzle.moves.size(); move++) {
+        if (puzzle.moves[move].name == name)
+            return (int)move;
+    }
+    return -1;
+}
+
+int InversePuzzleMove(const Puzzle& puzzle, int move)
+{
+    int generator = puzzle.moves[move].generator;
+    return puzzle.firstMoves[generator] + puzzle.orders[generator] - puzzle.moves[move].power - 1;
+}
+
+void InitPuzzleState(const Puzzle& puzzle, std::vector<unsigned char>& state)
+{
+    Identity(puzzle.numPoints, state);
+}
+
+void ApplyPuzzleMove(const Puzzle& puzzle, int move, std::vector<unsigned char>& state)
+{
+    const unsigned char* from = &puzzle.moves[move].from[0];
+    unsigned char moved[PUZZLE_MAX_POINTS];
+    for (int point = 0; point < puzzle.numPoints; point++) {
+        moved[point] = state[from[point]];
+    }
+    memcpy(&state[0], moved, puzzle.numPoints);
+}
+
+static bool IsSolved(const Puzzle& puzzle, const unsigned char* state)
+{
+    for (int point = 0; point < puzzle.numPoints; point++) {
+        if (puzzle.colours[state[point]] != puzzle.colours[point])
+            return false;
+    }
+    return true;
+}
+
+bool IsPuzzleSolved(const Puzzle& puzzle, const std::vector<unsigned char>& state)
+{
+    return IsSolved(puzzle, &state[0]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// SCHREIER-SIMS
+//
+// Level k holds elements that fix points 0 to k-1: one taking k to each
+// point it can reach (its transversal), and the generators found at that
+// level. Adding a generator at a level extends the transversal by it, and
+// every product of a generator and a transversal element that lands on a
+// point already reached gives an element fixing k too (a Schreier
+// generator), which is added at the next level unless it's there already.
+/////////////////////////////////////////////////////////////////////////////
+
+// Checks if an element fixing every point below a level reduces to nothing through the levels.
+static bool Sift(const PuzzleGroup& group, int level, Permutation element)
+{
+    for (int k = level; k < group.numPoints; k++) {
+        int point = element[k];
+        if (point == k)
+            continue;
+        if (group.transversals[k][point].empty())
+            return false;
+        element = Compose(group.inverses[k][point], element);
+    }
+    return true;
+}
+
+static void AddToLevel(PuzzleGroup& group, int level, const Permutation& element);
+
+// Adds an element of a level to its transversal, or passes what it makes fixing one more point on.
+static void ExtendLevel(PuzzleGroup& group, int level, const Permutation& element)
+{
+    int point = element[level];
+    if (group.transversals[level][point].empty()) {
+        group.transversals[level][point] = element;
+        group.inverses[level][point] = Invert(element);
+        group.orbits[level].push_back(point);
+        for (size_t i = 0; i < group.generators[level].size(); i++) {
+            ExtendLevel(group, level, Compose(group.generators[level][i], element));
+        }
+    }
+    else if (level + 1 < group.numPoints) {
+        AddToLevel(group, level + 1, Compose(group.inverses[level][point], element));
+    }
+}
+
+static void AddToLevel(PuzzleGroup& group, int level, const Permutation& element)
+{
+    if (Sift(group, level, element))
+        return;
+    group.generators[level].push_back(element);
+    size_t numReached = group.orbits[level].size();
+    for (size_t i = 0; i < numReached; i++) {
+        int point = group.orbits[level][i];
+        ExtendLevel(group, level, Compose(element, group.transversals[level][point]));
+    }
+}
+
+static void BuildGroup(int numPoints, const std::vector<Permutation>& generators, PuzzleGroup& group)
+{
+    group.numPoints = numPoints;
+    group.orbits.assign(numPoints, std::vector<int>());
+    group.transversals.assign(numPoints, std::vector<Permutation>(numPoints));
+    group.inverses.assign(numPoints, std::vector<Permutation>(numPoints));
+    group.generators.assign(numPoints, std::vector<Permutation>());
+    for (int level = 0; level < numPoints; level++) {
+        Identity(numPoints, group.transversals[level][level]);
+        group.inverses[level][level] = group.transversals[level][level];
+        group.orbits[level].push_back(level);
+    }
+    for (size_t i = 0; i < generators.size(); i++) {
+        AddToLevel(group, 0, generators[i]);
+    }
+}
+
+// The order of the group, or limit + 1 if it is more.
+static uint64_t LimitedOrder(const PuzzleGroup& group, uint64_t limit)
+{
+    uint64_t order = 1;
+    for (int level = 0; level < group.numPoints; level++) {
+        order *= group.orbits[level].size();
+        if (order > limit)
+            return limit + 1;
+    }
+    return order;
+}
+
+void BuildPuzzleGroup(const Puzzle& puzzle, PuzzleGroup& group)
+{
+    BuildGroup(puzzle.numPoints, puzzle.generators, group);
+}
+
+std::string FormatGroupOrder(const PuzzleGroup& group)
+{
+    // Base 10^9 digits, the lowest first.
+    std::vector<uint32_t> digits(1, 1);
+    for (int level = 0; level < group.numPoints; level++) {
+        uint64_t carry = 0;
+        for (size_t i = 0; i < digits.size(); i++) {
+            uint64_t product = (uint64_t)digits[i] * group.orbits[level].size() + carry;
+            digits[i] = (uint32_t)(product % 1000000000);
+            carry = product / 1000000000;
+        }
+        if (carry > 0)
+            digits.push_back((uint32_t)carry);
+    }
+    std::string text = std::to_string(digits.back());
+    for (size_t i = digits.size() - 1; i-- > 0;) {
+        char part[16];
+        snprintf(part, sizeof(part), "%09u", digits[i]);
+        text += part;
+    }
+    return text;
+}
+
+bool IsInPuzzleGroup(const PuzzleGroup& group, const std::vector<unsigned char>& state)
+{
+    return Sift(group, 0, state);
+}
+
+void RandomPuzzleState(const PuzzleGroup& group, uint64_t& seed, std::vector<unsigned char>& state)
+{
+    // Every element is one product of an element of each transversal.
+    Identity(group.numPoints, state);
+    for (int level = 0; level < group.numPoints; level++) {
+        const std::vector<int>& reached = group.orbits[level];
+        int point = reached[NextPuzzleRandom(seed) % reached.size()];
+        if (point != level)
+            state = Compose(state, group.transversals[level][point]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// PRUNING TABLES
+/////////////////////////////////////////////////////////////////////////////
+
+static uint32_t HashPattern(const unsigned char* pattern, size_t length)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ pattern[i]) * 1099511628211ULL;
+    }
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+
+// The number of a pattern in the table, or -1.
+static int FindPattern(const PuzzleTable& table, const unsigned char* pattern)
+{
+    size_t length = table.points.size();
+    uint32_t mask = (uint32_t)table.slots.size() - 1;
+    for (uint32_t slot = HashPattern(pattern, length) & mask;; slot = (slot + 1) & mask) {
+        uint32_t entry = table.slots[slot];
+        if (entry == 0)
+            return -1;
+        if (memcmp(&table.patterns[(entry - 1) * length], pattern, length) == 0)
+            return (int)entry - 1;
+    }
+}
+
+static void InsertSlot(PuzzleTable& table, uint32_t entry)
+{
+    size_t length = table.points.size();
+    uint32_t mask = (uint32_t)table.slots.size() - 1;
+    uint32_t slot = HashPattern(&table.patterns[entry * length], length) & mask;
+    while (table.slots[slot] != 0)
+        slot = (slot + 1) & mask;
+    table.slots[slot] = entry + 1;
+}
+
+// Adds a pattern not in the table, keeping the slots at most half full.
+static void AddPattern(PuzzleTable& table, const unsigned char* pattern, int distance)
+{
+    size_t length = table.points.size();
+    uint32_t entry = (uint32_t)table.distances.size();
+    table.patterns.insert(table.patterns.end(), pattern, pattern + length);
+    table.distances.push_back((unsigned char)distance);
+    if ((entry + 1) * 2 > table.slots.size()) {
+        table.slots.assign(table.slots.size() * 2, 0);
+        for (uint32_t i = 0; i <= entry; i++) {
+            InsertSlot(table, i);
+        }
+    }
+    else {
+        InsertSlot(table, entry);
+    }
+}
+
+// The most patterns of so many points a table may have.
+static size_t MaxPatterns(size_t numPoints)
+{
+    // Each pattern's colours and distance, and up to four slots.
+    return PUZZLE_MAX_TABLE_BYTES / (numPoints + 1 + 4 * sizeof(uint32_t));
+}
+
+// The order of the group the moves make on some orbits' points, or limit + 1 if it is more.
+static uint64_t OrbitsOrder(const Puzzle& puzzle, const std::vector<unsigned char>& points, uint64_t limit)
+{
+    std::vector<int> index(puzzle.numPoints, -1);
+    for (size_t i = 0; i < points.size(); i++) {
+        index[points[i]] = (int)i;
+    }
+    std::vector<Permutation> generators(puzzle.generators.size(), Permutation(points.size()));
+    for (size_t g = 0; g < puzzle.generators.size(); g++) {
+        for (size_t i = 0; i < points.size(); i++) {
+            generators[g][i] = (unsigned char)index[puzzle.generators[g][points[i]]];
+        }
+    }
+    PuzzleGroup group;
+    BuildGroup((int)points.size(), generators, group);
+    return LimitedOrder(group, limit);
+}
+
+// Fills a table by a BFS from solved until every pattern is in it or it is full.
+static void FillTable(const Puzzle& puzzle, PuzzleTable& table)
+{
+    size_t length = table.points.size();
+    std::vector<int> index(puzzle.numPoints, -1);
+    for (size_t i = 0; i < length; i++) {
+        index[table.points[i]] = (int)i;
+    }
+    table.moves.resize(puzzle.moves.size() * length);
+    for (size_t move = 0; move < puzzle.moves.size(); move++) {
+        for (size_t i = 0; i < length; i++) {
+            table.moves[move * length + i] = (unsigned char)index[puzzle.moves[move].from[table.points[i]]];
+        }
+    }
+
+    size_t maxPatterns = MaxPatterns(length);
+    std::vector<unsigned char> pattern(length), next(length);
+    for (size_t i = 0; i < length; i++) {
+        pattern[i] = puzzle.colours[table.points[i]];
+    }
+    table.slots.assign(1024, 0);
+    AddPattern(table, &pattern[0], 0);
+    table.complete = true;
+    for (size_t entry = 0; entry < table.distances.size(); entry++) {
+        int distance = table.distances[entry];
+        memcpy(&pattern[0], &table.patterns[entry * length], length);
+        for (size_t move = 0; move < puzzle.moves.size(); move++) {
+            const unsigned char* from = &table.moves[move * length];
+            for (size_t i = 0; i < length; i++) {
+                next[i] = pattern[from[i]];
+            }
+            if (FindPattern(table, &next[0]) >= 0)
+                continue;
+            if (table.distances.size() == maxPatterns || distance + 1 >= PUZZLE_UNREACHED) {
+                // Every pattern up to this distance is in, so the rest are further.
+                table.complete = false;
+                table.deepest = distance;
+                return;
+            }
+            AddPattern(table, &next[0], distance + 1);
+        }
+    }
+    table.deepest = table.distances.back();
+}
+
+void BuildPuzzleTables(Puzzle& puzzle)
+{
+    // The points of each orbit that isn't all one colour, as its pattern never changes.
+    std::vector<std::vector<unsigned char>> orbits(puzzle.numOrbits);
+    for (int point = 0; point < puzzle.numPoints; point++) {
+        orbits[puzzle.orbits[point]].push_back((unsigned char)point);
+    }
+    std::vector<std::pair<uint64_t, int>> sizes;
+    for (int orbit = 0; orbit < puzzle.numOrbits; orbit++) {
+        bool oneColour = true;
+        for (size_t i = 1; i < orbits[orbit].size(); i++) {
+            oneColour = oneColour && puzzle.colours[orbits[orbit][i]] == puzzle.colours[orbits[orbit][0]];
+        }
+        if (!oneColour)
+            sizes.push_back(std::make_pair(OrbitsOrder(puzzle, orbits[orbit], MaxPatterns(orbits[orbit].size())), orbit));
+    }
+    std::sort(sizes.rbegin(), sizes.rend());
+
+    // From the largest down, each goes in the first table it fits in with, or a table of its own.
+    puzzle.tables.clear();
+    for (size_t i = 0; i < sizes.size(); i++) {
+        const std::vector<unsigned char>& points = orbits[sizes[i].second];
+        size_t t = 0;
+        for (; t < puzzle.tables.size(); t++) {
+            std::vector<unsigned char> merged = puzzle.tables[t].points;
+            merged.insert(merged.end(), points.begin(), points.end());
+            if (OrbitsOrder(puzzle, merged, MaxPatterns(merged.size())) <= MaxPatterns(merged.size())) {
+                puzzle.tables[t].points = merged;
+                break;
+            }
+        }
+        if (t == puzzle.tables.size()) {
+            puzzle.tables.push_back(PuzzleTable());
+            puzzle.tables.back().points = points;
+        }
+    }
+    for (size_t i = 0; i < puzzle.tables.size(); i++) {
+        FillTable(puzzle, puzzle.tables[i]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// SEARCH
+/////////////////////////////////////////////////////////////////////////////
+
+// The most moves any table says are left, or PUZZLE_UNREACHED if one can't be solved.
+static int Heuristic(const Puzzle& puzzle, const unsigned char* state, unsigned char* pattern)
+{
+    int distance = 0;
+    for (size_t t = 0; t < puzzle.tables.size(); t++) {
+        const PuzzleTable& table = puzzle.tables[t];
+        for (size_t i = 0; i < table.points.size(); i++) {
+            pattern[i] = puzzle.colours[state[table.points[i]]];
+        }
+        int entry = FindPattern(table, pattern);
+        int left = (entry >= 0) ? table.distances[entry] : table.complete ? PUZZLE_UNREACHED : table.deepest + 1;
+        distance = std::max(distance, left);
+    }
+    return distance;
+}
+
+static bool SearchDepth(PuzzleSearch& search, int depth, int maxDepth, int lastGenerator)
+{
+    const Puzzle& puzzle = *search.puzzle;
+    int numPoints = puzzle.numPoints;
+    const unsigned char* state = &search.states[depth * numPoints];
+    if (depth + Heuristic(puzzle, state, &search.pattern[0]) > maxDepth)
+        return false;
+    if (depth == maxDepth)
+        return IsSolved(puzzle, state);
+
+    int numGenerators = (int)puzzle.generators.size();
+    unsigned char* next = &search.states[(depth + 1) * numPoints];
+    for (size_t move = 0; move < puzzle.moves.size(); move++) {
+        int generator = puzzle.moves[move].generator;
+        if (lastGenerator >= 0 && !puzzle.follows[lastGenerator * numGenerators + generator])
+            continue;
+        const unsigned char* from = &puzzle.moves[move].from[0];
+        for (int point = 0; point < numPoints; point++) {
+            next[point] = state[from[point]];
+        }
+        search.path[depth] = (int)move;
+        if (SearchDepth(search, depth + 1, maxDepth, generator))
+            return true;
+    }
+    return false;
+}
+
+int SolvePuzzle(const Puzzle& puzzle, const std::vector<unsigned char>& state, int maxLength, std::vector<int>& solution)
+{
+    PuzzleSearch search;
+    search.puzzle = &puzzle;
+    search.states.resize((maxLength + 1) * puzzle.numPoints);
+    search.pattern.resize(puzzle.numPoints);
+    search.path.resize(maxLength);
+    memcpy(&search.states[0], &state[0], puzzle.numPoints);
+    for (int maxDepth = 0; maxDepth <= maxLength; maxDepth++) {
+        if (SearchDepth(search, 0, maxDepth, -1)) {
+            solution.assign(search.path.begin(), search.path.begin() + maxDepth);
+            return PUZZLE_FOUND;
+        }
+    }
+    return PUZZLE_NOT_FOUND;
+}
+
+void ScramblePuzzle(const Puzzle& puzzle, const PuzzleGroup& group, uint64_t seed, std::vector<int>& moves)
+{
+    moves.clear();
+    bool complete = !puzzle.tables.empty();
+    for (size_t t = 0; t < puzzle.tables.size(); t++) {
+        complete = complete && puzzle.tables[t].complete;
+    }
+    if (complete) {
+        std::vector<unsigned char> state;
+        std::vector<int> solution;
+        RandomPuzzleState(group, seed, state);
+        if (SolvePuzzle(puzzle, state, PUZZLE_MAX_LENGTH, solution) == PUZZLE_FOUND) {
+            for (size_t i = solution.size(); i-- > 0;) {
+                moves.push_back(InversePuzzleMove(puzzle, solution[i]));
+            }
+            return;
+        }
+    }
+
+    int numGenerators = (int)puzzle.generators.size();
+    int lastGenerator = -1;
+    std::vector<int> allowed;
+    for (int i = 0; i < puzzle.scrambleLength; i++) {
+        allowed.clear();
+        for (size_t move = 0; move < puzzle.moves.size(); move++) {
+            int generator = puzzle.moves[move].generator;
+            if (lastGenerator < 0 || puzzle.follows[lastGenerator * numGenerators + generator])
+                allowed.push_back((int)move);
+        }
+        int move = allowed[NextPuzzleRandom(seed) % allowed.size()];
+        moves.push_back(move);
+        lastGenerator = puzzle.moves[move].generator;
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////
+// PERMUTATION PUZZLES
+//
+// Any puzzle whose moves only permute its stickers, defined by a file
+// rather than code: the Pyraminx, the Skewb, the Megaminx and the cube
+// itself are all a list of moves as cycles of sticker numbers. A state is
+// which sticker is at each point, and a move is compiled into a table of
+// where each point's sticker comes from, so applying one is a gather.
+//
+// The group the moves generate is worked out by the Schreier-Sims
+// algorithm (Knuth's version): a chain of subgroups, each fixing one more
+// point, with an element taking that point to every point it can reach.
+// The group's order is the product of how many points each can reach,
+// a state is in the group if it reduces to nothing through the chain, and
+// a product of a random element from each link is a uniformly random one.
+//
+// Search is IDA* over the moves, never turning the same move twice in a
+// row or two moves that commute out of order. It is bounded by pruning
+// tables of the colours at the points of one or more orbits (the points
+// the moves mix), merged while every state of the group they make would
+// fit in PUZZLE_MAX_TABLE_BYTES. A BFS fills each table from solved until
+// it is complete or full; a pattern a full table doesn't have is at least
+// a move further than the deepest depth it finished.
+//
+// FILE FORMAT
+// Lines of a directive and its values, '#' starting a comment:
+//
+//   name Pyraminx                  What to call the puzzle.
+//   points 36                      How many stickers, numbered from 0. Comes first.
+//   colours 0 0 0 1 1 1 ...        The colour of each sticker (by default each is its own), so
+//                                  a state is solved when every point shows its colour.
+//   scramble 25                    Random moves in a scramble, when random states can't be
+//                                  solved quickly (default PUZZLE_SCRAMBLE_LENGTH).
+//   move U (0 1 2)(3 4 5) ...      A move, as the cycles of where it takes each sticker.
+//   move Uw = U u                  A move made of moves already defined, in order.
+//
+// Each move also gives its powers: a move of order 3 named U gives U and
+// U', of order 4 U, U2 and U', of order 5 U, U2, U2' and U'.
+/////////////////////////////////////////////////////////////////////////////
+
+#define PUZZLE_MAX_POINTS       256
+#define PUZZLE_MAX_ORDER        12     // Most times a move may be turned before it is back where it began.
+#define PUZZLE_MAX_TABLE_BYTES  (1 << 26)  // Most memory a pruning table may take.
+#define PUZZLE_MAX_LENGTH       40
+#define PUZZLE_SCRAMBLE_LENGTH  25
+#define PUZZLE_UNREACHED        255
+
+#define PUZZLE_FOUND            0
+#define PUZZLE_NOT_FOUND        1      // There is no solution within the length.
+
+struct PuzzleMove {
+    std::string name;
+    int generator;
+    int power;
+    std::vector<unsigned char> from;    // The point each point's sticker comes from.
+};
+
+struct PuzzleTable {
+    std::vector<unsigned char> points;
+    std::vector<unsigned char> moves;   // Move * number of points + index: the index its colour comes from.
+    std::vector<unsigned char> patterns;        // The colours at the points of each pattern, in the order found.
+    std::vector<unsigned char> distances;
+    std::vector<uint32_t> slots;        // Open addressing of pattern number + 1, or 0.
+    int deepest;
+    bool complete;                      // Every pattern is in the table, so any other can't be reached.
+};
+
+struct Puzzle {
+    std::string name;
+    int numPoints;
+    int scrambleLength;
+    std::vector<unsigned char> colours;
+    std::vector<std::string> generatorNames;
+    std::vector<std::vector<unsigned char>> generators;         // Where each move takes each point's sticker.
+    std::vector<int> orders;
+    std::vector<int> firstMoves;        // Of each generator's powers in moves.
+    std::vector<PuzzleMove> moves;
+    std::vector<unsigned char> follows; // By generator * number of generators + generator: may the second follow the first.
+    std::vector<int> orbits;            // The orbit of each point.
+    int numOrbits;
+    std::vector<PuzzleTable> tables;
+};
+
+struct PuzzleGroup {
+    int numPoints;
+    std::vector<std::vector<int>> orbits;       // By level: the points elements fixing every lower point take it to.
+    std::vector<std::vector<std::vector<unsigned char>>> transversals;  // By level and point: such an element, or empty.
+    std::vector<std::vector<std::vector<unsigned char>>> inverses;
+    std::vector<std::vector<std::vector<unsigned char>>> generators;    // By level: those found to fix every lower point.
+};
+
+// Reads and compiles a puzzle. Prints the reason and returns false if the file can't be read or
+// isn't a puzzle.
+bool LoadPuzzle(const char* filename, Puzzle& puzzle);
+
+// Reads the moves in a file of the puzzle's move names, '#' starting a comment. Prints the reason
+// and returns false if one isn't a move.
+bool ReadPuzzleMoves(const Puzzle& puzzle, const char* filename, std::vector<int>& moves);
+
+// The move with a name, or -1.
+int FindPuzzleMove(const Puzzle& puzzle, const char* name);
+
+// The move that undoes a move.
+int InversePuzzleMove(const Puzzle& puzzle, int move);
+
+void InitPuzzleState(const Puzzle& puzzle, std::vector<unsigned char>& state);
+void ApplyPuzzleMove(const Puzzle& puzzle, int move, std::vector<unsigned char>& state);
+bool IsPuzzleSolved(const Puzzle& puzzle, const std::vector<unsigned char>& state);
+
+// Works out the group the moves generate by the Schreier-Sims algorithm.
+void BuildPuzzleGroup(const Puzzle& puzzle, PuzzleGroup& group);
+
+// The number of elements of the group, in decimal.
+std::string FormatGroupOrder(const PuzzleGroup& group);
+
+// Checks if a state can be reached by the moves.
+bool IsInPuzzleGroup(const PuzzleGroup& group, const std::vector<unsigned char>& state);
+
+// Sets state to a uniformly random state the moves can reach.
+void RandomPuzzleState(const PuzzleGroup& group, uint64_t& seed, std::vector<unsigned char>& state);
+
+// Chooses the orbits of the pruning tables and fills them.
+void BuildPuzzleTables(Puzzle& puzzle);
+
+// Sets solution to a shortest sequence of moves that solves the state, each move counting as one.
+// Returns a PUZZLE_ result.
+int SolvePuzzle(const Puzzle& puzzle, const std::vector<unsigned char>& state, int maxLength, std::vector<int>& solution);
+
+// Sets moves to a scramble: a random state's solution undone when every table is complete, so it
+// is quick to find, or the puzzle's number of random moves otherwise.
+void ScramblePuzzle(const Puzzle& puzzle, const PuzzleGroup& group, uint64_t seed, std::vector<int>& moves);
@@ -0,0 +1,151 @@
+#include "script.h"
+#include "trace.h"
+
+std::coroutine_handle<> Script::FinalAwaiter::await_suspend(std::coroutine_handle<promise_type> finished) noexcept
+{
+    std::coroutine_handle<> continuation = finished.promise().continuation;
+    return continuation ? continuation : std::noop_coroutine();
+}
+
+Script& Script::operator=(Script&& other) noexcept
+{
+    if (this != &other) {
+        if (handle)
+            handle.destroy();
+        handle = other.handle;
+        other.handle = nullptr;
+    }
+    return *this;
+}
+
+Script::~Script()
+{
+    if (handle)
+        handle.destroy();
+}
+
+std::coroutine_handle<> Script::await_suspend(std::coroutine_handle<promise_type> awaiting) noexcept
+{
+    handle.promise().cube = awaiting.promise().cube;
+    handle.promise().continuation = awaiting;
+    return handle;
+}
+
+AnimatedCube::AnimatedCube()
+    : rotatingTurn(TURN_NONE), rotatingDirection(CLOCKWISE), frameNumber(0), animationFrames(NUM_OF_FRAMES),
+      movesApplied(0), updateTime(0.0), delaying(false), ticking(false)
+{
+    InitCube(cube);
+}
+
+void AnimatedCube::Run(Script newScript)
+{
+    rotatingTurn = TURN_NONE;
+    frameNumber = 0;
+    delaying = false;
+    waiting = nullptr;
+    script = static_cast<Script&&>(newScript);
+    if (script.IsDone())
+        return;
+    script.handle.promise().cube = this;
+    script.handle.resume();
+}
+
+void AnimatedCube::Resume()
+{
+    std::coroutine_handle<> script = waiting;
+    waiting = nullptr;
+    if (script)
+        script.resume();
+}
+
+void AnimatedCube::Tick(ScriptClock::time_point now)
+{
+    ticking = true;
+    tickTime = now;
+    if (IsTurning()) {
+        if (frameNumber < animationFrames)
+            frameNumber++;
+        else
+            FinishTurn();
+    }
+    else if (delaying && now >= wakeTime) {
+        delaying = false;
+        Resume();
+    }
+    ticking = false;
+}
+
+void AnimatedCube::FinishTurn()
+{
+    if (!IsTurning())
+        return;
+    Move move = { rotatingTurn, rotatingDirection, 0.0 };
+    rotatingTurn = TURN_NONE;
+    frameNumber = 0;
+    Apply(move);
+    Resume();
+}
+
+void AnimatedCube::Skip()
+{
+    if (IsTurning()) {
+        FinishTurn();
+    }
+    else if (delaying) {
+        delaying = false;
+        Resume();
+    }
+}
+
+void AnimatedCube::Apply(const Move& move)
+{
+    TRACE_SCOPE("UpdateCube");
+    ScriptClock::time_point start = ScriptClock::now();
+    ApplyMove(cube, move);
+    updateTime += std::chrono::duration<double, std::micro>(ScriptClock::now() - start).count();
+    if (move.turn < TURN_X)
+        movesApplied++;
+}
+
+void AnimatedCube::StartTurn(const Move& move, int frames, std::coroutine_handle<> script)
+{
+    rotatingTurn = move.turn;
+    rotatingDirection = move.direction;
+    animationFrames = frames;
+    frameNumber = 1;
+    waiting = script;
+}
+
+void AnimatedCube::StartDelay(ScriptClock::duration duration, std::coroutine_handle<> script)
+{
+    delaying = true;
+    wakeTime = (ticking ? tickTime : ScriptClock::now()) + duration;
+    waiting = script;
+}
+
+void TurnAwaiter::await_suspend(std::coroutine_handle<Script::promise_type> script)
+{
+    script.promise().cube->StartTurn(move, frames, script);
+}
+
+void DelayAwaiter::await_suspend(std::coroutine_handle<Script::promise_type> script)
+{
+    script.promise().cube->StartDelay(duration, script);
+}
+
+TurnAwaiter turn(const Move& move, int frames)
+{
+    return TurnAwaiter{ move, frames };
+}
+
+TurnAwaiter turn(int turn, int direction, int frames)
+{
+    Move move = { turn, direction, 0.0 };
+    return TurnAwaiter{ move, frames };
+}
+
+DelayAwaiter delay(ScriptClock::duration duration)
+{
+    return DelayAwaiter{ duration };
+}
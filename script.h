@@ -0,0 +1,158 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// ANIMATION SCRIPTS
+//
+// A script is a coroutine that animates one cube, e.g.
+//
+//     Script Demo()
+//     {
+//         co_await turn(TURN_R, CLOCKWISE);
+//         co_await delay(std::chrono::milliseconds(200));
+//         co_await turn(TURN_R, ANTI_CLOCKWISE);
+//     }
+//
+// Every AnimatedCube runs a script of its own and the frame loop calls its
+// Tick once a frame, which shows the next frame of a turn or resumes the
+// script once its turn or delay is over. A script's coroutine frame is
+// allocated once, when the script is called; suspending and resuming it
+// never allocates, so any number of cubes can animate at once. Scripts can
+// co_await other scripts to play them in sequence.
+/////////////////////////////////////////////////////////////////////////////
+
+#define NUM_OF_FRAMES           10      // Number of frames in an animation.
+
+typedef std::chrono::steady_clock ScriptClock;
+
+class AnimatedCube;
+
+class Script {
+public:
+    struct promise_type;
+
+    // Resumes whichever script co_awaited the one finishing.
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> finished) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type {
+        AnimatedCube* cube = nullptr;           // The cube the script animates.
+        std::coroutine_handle<> continuation;   // The script awaiting this one, if any.
+
+        Script get_return_object() { return Script(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    Script() {}
+    Script(Script&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    Script& operator=(Script&& other) noexcept;
+    ~Script();
+
+    // True once the script has returned, or if there is none.
+    bool IsDone() const { return !handle || handle.done(); }
+
+    // Awaiting a script runs it on the awaiting script's cube until it returns.
+    bool await_ready() const noexcept { return IsDone(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> awaiting) noexcept;
+    void await_resume() const noexcept {}
+
+private:
+    explicit Script(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+    Script(const Script&) = delete;
+    Script& operator=(const Script&) = delete;
+
+    std::coroutine_handle<promise_type> handle;
+
+    friend class AnimatedCube;
+};
+
+// A cube that plays the turns of a script.
+class AnimatedCube {
+public:
+    AnimatedCube();
+
+    // Replaces the running script (if any) and runs the new one up to its first turn or delay.
+    void Run(Script script);
+
+    // Shows the next frame of the turn in progress, or resumes the script once the turn or delay is over.
+    // Delays the script starts meanwhile count from now, so the frame loop may run on its own clock.
+    void Tick(ScriptClock::time_point now);
+
+    // Applies the turn in progress at once and resumes the script, which may start the next one.
+    void FinishTurn();
+
+    // Finishes the turn or ends the delay in progress at once, resuming the script.
+    void Skip();
+
+    // Applies a move straight to the state, timing it.
+    void Apply(const Move& move);
+
+    bool IsTurning() const { return rotatingTurn != TURN_NONE; }
+
+    // True while a turn or delay is in progress, i.e. Tick has something to do.
+    bool IsBusy() const { return IsTurning() || delaying; }
+
+    bool IsScriptDone() const { return script.IsDone(); }
+
+    // Used by the awaitables below to suspend the script.
+    void StartTurn(const Move& move, int frames, std::coroutine_handle<> waiting);
+    void StartDelay(ScriptClock::duration duration, std::coroutine_handle<> waiting);
+
+    Cube cube;
+    int rotatingTurn;               // TURN_ constant of the layers turning, or TURN_NONE.
+    int rotatingDirection;
+    int frameNumber;                // How far the layers have turned, from 1 to animationFrames. 0 when nothing turns.
+    int animationFrames;            // Number of frames in the current turn.
+    int movesApplied;               // Moves other than cube rotations applied to the state.
+    double updateTime;              // Microseconds spent applying them.
+
+private:
+    AnimatedCube(const AnimatedCube&) = delete;
+    AnimatedCube& operator=(const AnimatedCube&) = delete;
+
+    void Resume();
+
+    Script script;
+    std::coroutine_handle<> waiting;        // The script suspended on the turn or delay in progress.
+    bool delaying;
+    ScriptClock::time_point wakeTime;
+    bool ticking;
+    ScriptClock::time_point tickTime;       // The now of the Tick in progress.
+};
+
+struct TurnAwaiter {
+    Move move;
+    int frames;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<Script::promise_type> script);
+    void await_resume() const noexcept {}
+};
+
+struct DelayAwaiter {
+    ScriptClock::duration duration;
+
+    bool await_ready() const noexcept { return duration <= ScriptClock::duration::zero(); }
+    void await_suspend(std::coroutine_handle<Script::promise_type> script);
+    void await_resume() const noexcept {}
+};
+
+// Animates a move over the given number of frames.
+TurnAwaiter turn(const Move& move, int frames = NUM_OF_FRAMES);
+// Animates a TURN_ constant (a face, slice, wide turn or rotation) in a direction (CLOCKWISE,
+// ANTI_CLOCKWISE or HALF_TURN) over the given number of frames.
+TurnAwaiter turn(int turn, int direction, int frames = NUM_OF_FRAMES);
+
+// Waits for at least the given time, to the next frame after it.
+DelayAwaiter delay(ScriptClock::duration duration);
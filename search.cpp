@@ -0,0 +1,360 @@
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#define PREFETCH(address)       _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#define PREFETCH(address)       __builtin_prefetch(address)
+#endif
+
+#include "search.h"
+
+#define SEARCH_DEPTH_SHIFT      56     // Where an entry keeps its depth in words[2], above the stickers.
+#define SEARCH_EXPANDED         ((uint64_t)1 << 55)     // Set in words[2] once an entry's moves have been added.
+#define SEARCH_STATE_MASK       (((uint64_t)1 << 55) - 1)
+#define SEARCH_MIN_CAPACITY     1024   // Entries a hash set starts with.
+
+// A state in a hash set. The top byte of words[2] holds its depth + 1, so an empty slot is 0, and
+// the bit below it SEARCH_EXPANDED. moves has a bit for every move (by its index in the options)
+// that reaches it from a state one move closer to the set's end.
+struct SearchEntry {
+    uint64_t words[3];
+    uint64_t moves;
+};
+
+// The states within some moves of one end of the search.
+struct SearchSet {
+    std::vector<SearchEntry> entries;   // A power of two of them.
+    size_t count;
+    int depth;                          // Moves from the end of the deepest states.
+    size_t frontier;                    // Number of states at that depth.
+};
+
+struct Search {
+    const SearchOptions* options;
+    Move inverses[SEARCH_MAX_MOVES];
+    uint64_t redundant[SEARCH_MAX_MOVES];       // Moves that can't take a state reached by a move any further from its end.
+    SearchSet sides[2];                 // Grown forward from the start and backward from the goal.
+    size_t memory;                      // Bytes the sets take.
+    size_t peakMemory;
+    SearchCallback found;
+    void* context;
+    PackedCube meeting;                 // State where the solutions being streamed cross from one side to the other.
+    std::vector<Move> solution;
+};
+
+static int EntryDepth(const SearchEntry& entry)
+{
+    return (int)(entry.words[2] >> SEARCH_DEPTH_SHIFT) - 1;
+}
+
+// The slot holding a state, or the empty slot where it would go, starting from its hash.
+static SearchEntry& FindSlot(SearchSet& set, const PackedCube& state, uint64_t hash)
+{
+    size_t mask = set.entries.size() - 1;
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        SearchEntry& entry = set.entries[slot];
+        if (entry.words[2] == 0 ||
+            (entry.words[0] == state.words[0] && entry.words[1] == state.words[1] && (entry.words[2] & SEARCH_STATE_MASK) == state.words[2]))
+            return entry;
+    }
+}
+
+static SearchEntry& FindSlot(SearchSet& set, const PackedCube& state)
+{
+    return FindSlot(set, state, HashPackedCube(state));
+}
+
+static void EntryState(const SearchEntry& entry, PackedCube& state)
+{
+    state.words[0] = entry.words[0];
+    state.words[1] = entry.words[1];
+    state.words[2] = entry.words[2] & SEARCH_STATE_MASK;
+}
+
+// Doubles the slots of a set once it is three quarters full, if the memory allows the old and
+// new slots at once. Returns false if it doesn't.
+static bool GrowSet(Search& search, SearchSet& set)
+{
+    size_t bytes = set.entries.size() * sizeof(SearchEntry);
+    if (search.memory + 2 * bytes > search.options->maxMemory)
+        return false;
+    if (search.memory + 2 * bytes > search.peakMemory)
+        search.peakMemory = search.memory + 2 * bytes;
+
+    std::vector<SearchEntry> old(set.entries.size() * 2);
+    old.swap(set.entries);
+    for (size_t i = 0; i < old.size(); i++) {
+        if (old[i].words[2] != 0) {
+            PackedCube state;
+            EntryState(old[i], state);
+            FindSlot(set, state) = old[i];
+        }
+    }
+    search.memory += bytes;
+    return true;
+}
+
+// Adds a state at a depth, reached by a move. Does nothing if it is already closer to the set's end.
+static void AddState(SearchSet& set, const PackedCube& state, uint64_t hash, int depth, int move)
+{
+    SearchEntry& entry = FindSlot(set, state, hash);
+    if (entry.words[2] == 0) {
+        entry.words[0] = state.words[0];
+        entry.words[1] = state.words[1];
+        entry.words[2] = state.words[2] | ((uint64_t)(depth + 1) << SEARCH_DEPTH_SHIFT);
+        entry.moves = 0;
+        set.count++;
+        set.frontier++;
+    }
+    if (EntryDepth(entry) == depth && move >= 0)
+        entry.moves |= (uint64_t)1 << move;
+}
+
+// Adds the states a move beyond the deepest ones of a side. Returns false if the memory ran out.
+static bool ExpandSide(Search& search, int side)
+{
+    SearchSet& set = search.sides[side];
+    const std::vector<Move>& moves = search.options->moves;
+    int depth = set.depth;
+    set.frontier = 0;
+    for (size_t i = 0; i < set.entries.size(); i++) {
+        if (EntryDepth(set.entries[i]) != depth || (set.entries[i].words[2] & SEARCH_EXPANDED))
+            continue;
+        PackedCube state;
+        Cube cube;
+        EntryState(set.entries[i], state);
+        UnpackCube(state, cube);
+        uint64_t skip = 0;
+        for (size_t move = 0; move < moves.size(); move++) {
+            if (set.entries[i].moves & ((uint64_t)1 << move))
+                skip |= search.redundant[move];
+        }
+
+        // All the new states are worked out first, so their slots can be fetched from memory together.
+        PackedCube nextStates[SEARCH_MAX_MOVES];
+        uint64_t hashes[SEARCH_MAX_MOVES];
+        for (size_t move = 0; move < moves.size(); move++) {
+            if (skip & ((uint64_t)1 << move))
+                continue;
+            Cube next = cube;
+            ApplyMove(next, (side == 0) ? moves[move] : search.inverses[move]);
+            PackCube(next, nextStates[move]);
+            hashes[move] = HashPackedCube(nextStates[move]);
+            PREFETCH(&set.entries[hashes[move] & (set.entries.size() - 1)]);
+        }
+        bool grown = false;
+        for (size_t move = 0; move < moves.size(); move++) {
+            if (4 * (set.count + 1) > 3 * set.entries.size()) {
+                if (!GrowSet(search, set))
+                    return false;
+                // The slots have moved, so scan again for the states not yet expanded. This one's moves
+                // are added again, which finds the states already added and sets the same bits.
+                grown = true;
+                break;
+            }
+            if (!(skip & ((uint64_t)1 << move)))
+                AddState(set, nextStates[move], hashes[move], depth + 1, (int)move);
+        }
+        if (grown)
+            i = (size_t)-1;
+        else
+            set.entries[i].words[2] |= SEARCH_EXPANDED;
+    }
+    set.depth = depth + 1;
+    return true;
+}
+
+static bool StreamToGoal(Search& search, const PackedCube& state, size_t position);
+
+// Walks back every path from the start to the meeting state (which is depth moves from the start
+// through this one), then streams every way on from it to the goal.
+static bool StreamFromStart(Search& search, const PackedCube& state, int depth)
+{
+    if (depth == 0)
+        return StreamToGoal(search, search.meeting, search.sides[0].depth);
+
+    const std::vector<Move>& moves = search.options->moves;
+    uint64_t bits = FindSlot(search.sides[0], state).moves;
+    Cube cube;
+    UnpackCube(state, cube);
+    for (size_t move = 0; move < moves.size(); move++) {
+        if (!(bits & ((uint64_t)1 << move)))
+            continue;
+        Cube previous = cube;
+        PackedCube previousState;
+        ApplyMove(previous, search.inverses[move]);
+        PackCube(previous, previousState);
+        search.solution[depth - 1] = moves[move];
+        if (!StreamFromStart(search, previousState, depth - 1))
+            return false;
+    }
+    return true;
+}
+
+// Streams every path from a state, position moves into the solution, on to the goal.
+static bool StreamToGoal(Search& search, const PackedCube& state, size_t position)
+{
+    if (position == search.solution.size())
+        return search.found(search.solution, search.context);
+
+    const std::vector<Move>& moves = search.options->moves;
+    uint64_t bits = FindSlot(search.sides[1], state).moves;
+    Cube cube;
+    UnpackCube(state, cube);
+    for (size_t move = 0; move < moves.size(); move++) {
+        if (!(bits & ((uint64_t)1 << move)))
+            continue;
+        Cube next = cube;
+        PackedCube nextState;
+        ApplyMove(next, moves[move]);
+        PackCube(next, nextState);
+        search.solution[position] = moves[move];
+        if (!StreamToGoal(search, nextState, position + 1))
+            return false;
+    }
+    return true;
+}
+
+// Streams the solutions through the states just added to a side that the other side has.
+// Returns SEARCH_NOT_FOUND if there are none.
+static int StreamMeetings(Search& search, int side)
+{
+    SearchSet& set = search.sides[side];
+    SearchSet& other = search.sides[1 - side];
+    int result = SEARCH_NOT_FOUND;
+    for (size_t i = 0; i < set.entries.size(); i++) {
+        if (EntryDepth(set.entries[i]) != set.depth)
+            continue;
+        PackedCube state;
+        EntryState(set.entries[i], state);
+        if (FindSlot(other, state).words[2] == 0)
+            continue;
+
+        // Nothing met at a shallower depth, so every state the other side has here is at its deepest,
+        // and every shortest solution crosses at one of these states.
+        result = SEARCH_FOUND;
+        search.meeting = state;
+        search.solution.resize(search.sides[0].depth + search.sides[1].depth);
+        if (!StreamFromStart(search, state, search.sides[0].depth))
+            return SEARCH_STOPPED;
+    }
+    return result;
+}
+
+// Greys the pieces of cube that aren't coloured anywhere in goal. Pieces are told apart by their
+// colours. Returns false if a piece of goal is partly GREY.
+static bool GreyUnusedPieces(Cube& cube, const Cube& goal)
+{
+    const int* goalStickers = &goal.stickers[0][0];
+    int* stickers = &cube.stickers[0][0];
+    int goalColours[NUM_OF_PIECES] = { 0 };
+    int colours[NUM_OF_PIECES] = { 0 };
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        goalColours[StickerPiece(sticker)] |= 1 << goalStickers[sticker];
+        colours[StickerPiece(sticker)] |= 1 << stickers[sticker];
+    }
+
+    bool used[1 << (GREY + 1)] = { false };
+    for (int piece = 0; piece < NUM_OF_PIECES; piece++) {
+        if ((goalColours[piece] & (1 << GREY)) && goalColours[piece] != (1 << GREY))
+            return false;
+        used[goalColours[piece]] = true;
+    }
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        if (!used[colours[StickerPiece(sticker)]])
+            stickers[sticker] = GREY;
+    }
+    return true;
+}
+
+// Quarter turns clockwise a direction makes.
+static int QuarterTurns(int direction)
+{
+    return (direction == CLOCKWISE) ? 1 : (direction == HALF_TURN) ? 2 : 3;
+}
+
+// Finds the moves that, after another of the same layers, undo it or make a single move of the
+// set, so never lead further from either end.
+static void FindRedundantMoves(Search& search)
+{
+    const std::vector<Move>& moves = search.options->moves;
+    for (size_t first = 0; first < moves.size(); first++) {
+        search.redundant[first] = 0;
+        for (size_t second = 0; second < moves.size(); second++) {
+            if (moves[second].turn != moves[first].turn)
+                continue;
+            int quarterTurns = (QuarterTurns(moves[first].direction) + QuarterTurns(moves[second].direction)) % 4;
+            bool single = (quarterTurns == 0);
+            for (size_t move = 0; move < moves.size(); move++) {
+                if (moves[move].turn == moves[first].turn && QuarterTurns(moves[move].direction) == quarterTurns)
+                    single = true;
+            }
+            if (single)
+                search.redundant[first] |= (uint64_t)1 << second;
+        }
+    }
+}
+
+void InitSearchOptions(SearchOptions& options)
+{
+    options.moves.clear();
+    for (int face = 0; face < NUM_OF_FACES; face++) {
+        Move clockwise = { face, CLOCKWISE, 0.0 };
+        Move anticlockwise = { face, ANTI_CLOCKWISE, 0.0 };
+        Move half = { face, HALF_TURN, 0.0 };
+        options.moves.push_back(clockwise);
+        options.moves.push_back(anticlockwise);
+        options.moves.push_back(half);
+    }
+    options.maxLength = SEARCH_DEFAULT_LENGTH;
+    options.maxMemory = SEARCH_DEFAULT_MEMORY;
+}
+
+int SearchOptimal(const Cube& start, const Cube& goal, const SearchOptions& options, SearchCallback found, void* context,
+                  size_t* peakMemory)
+{
+    if (options.moves.size() > SEARCH_MAX_MOVES)
+        return SEARCH_INVALID;
+    Search search;
+    search.options = &options;
+    for (size_t move = 0; move < options.moves.size(); move++) {
+        if (options.moves[move].turn < 0 || options.moves[move].turn >= TURN_X)
+            return SEARCH_INVALID;
+        search.inverses[move] = InverseMove(options.moves[move]);
+    }
+    FindRedundantMoves(search);
+    Cube from = start;
+    if (!GreyUnusedPieces(from, goal))
+        return SEARCH_INVALID;
+
+    search.found = found;
+    search.context = context;
+    search.memory = 2 * SEARCH_MIN_CAPACITY * sizeof(SearchEntry);
+    search.peakMemory = search.memory;
+    if (search.memory > options.maxMemory)
+        return SEARCH_OUT_OF_MEMORY;
+    for (int side = 0; side < 2; side++) {
+        PackedCube state;
+        PackCube((side == 0) ? from : goal, state);
+        search.sides[side].entries.resize(SEARCH_MIN_CAPACITY);
+        search.sides[side].count = 0;
+        search.sides[side].depth = 0;
+        search.sides[side].frontier = 0;
+        AddState(search.sides[side], state, HashPackedCube(state), 0, -1);
+    }
+
+    int result = StreamMeetings(search, 0);
+    while (result == SEARCH_NOT_FOUND && search.sides[0].depth + search.sides[1].depth < options.maxLength) {
+        int side = (search.sides[0].frontier <= search.sides[1].frontier) ? 0 : 1;
+        if (!ExpandSide(search, side)) {
+            result = SEARCH_OUT_OF_MEMORY;
+            break;
+        }
+        // Every state reachable from that end has been seen, so the two will never meet.
+        if (search.sides[side].frontier == 0)
+            break;
+        result = StreamMeetings(search, side);
+    }
+    if (peakMemory != NULL)
+        *peakMemory = search.peakMemory;
+    return result;
+}
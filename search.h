@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// OPTIMAL SEARCH
+//
+// Finds every shortest sequence of moves from one state to another by
+// meeting in the middle: the states a few moves from the start and a few
+// moves back from the goal are grown a level at a time, whichever side has
+// fewer, until the two meet. Up to about 14 moves this is far faster than
+// searching forward, as each side only goes half as deep.
+//
+// Each side is an open-addressing hash set of packed states (32 bytes each)
+// holding how many moves from its end a state is and every last move that
+// reaches it in that many, so every path to a meeting state can be walked
+// back and all the optimal solutions streamed out, not just the first.
+//
+// The goal may leave pieces out by making all their stickers GREY (e.g. only
+// the cross edges coloured, for "cross solved"). The pieces of the start
+// that aren't coloured anywhere in the goal are greyed too, so both sides
+// search the same smaller space.
+/////////////////////////////////////////////////////////////////////////////
+
+#define SEARCH_MAX_MOVES        64              // Most moves a search may be made of.
+#define SEARCH_DEFAULT_LENGTH   14              // Default longest solution.
+#define SEARCH_DEFAULT_MEMORY   ((size_t)1 << 30)       // Default memory for the two hash sets.
+
+#define SEARCH_FOUND            0      // The optimal solutions were streamed.
+#define SEARCH_NOT_FOUND        1      // There is no solution within the length.
+#define SEARCH_OUT_OF_MEMORY    2      // The hash sets filled the memory before a solution was found.
+#define SEARCH_STOPPED          3      // The callback asked to stop.
+#define SEARCH_INVALID          4      // A move is a rotation, there are too many, or a piece of the goal is partly GREY.
+
+struct SearchOptions {
+    std::vector<Move> moves;    // What solutions are made of, all turns (not rotations).
+    int maxLength;              // Longest solution to look for.
+    size_t maxMemory;           // Bytes the hash sets of both sides may take together.
+};
+
+// Called with each optimal solution as it is found. Returns false to stop the search.
+typedef bool (*SearchCallback)(const std::vector<Move>& solution, void* context);
+
+// Sets options to the 18 face turns (quarter and half), SEARCH_DEFAULT_LENGTH and SEARCH_DEFAULT_MEMORY.
+void InitSearchOptions(SearchOptions& options);
+
+// Calls found with every shortest sequence of options.moves that takes start to goal, GREY
+// stickers of the goal matching anything. Orientations are ignored: the stickers are compared
+// as the cube's own. Returns a SEARCH_ result. peakMemory, if given, is set to the bytes the hash
+// sets took.
+int SearchOptimal(const Cube& start, const Cube& goal, const SearchOptions& options, SearchCallback found, void* context,
+                  size_t* peakMemory = NULL);
@@ -0,0 +1,314 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "session.h"
+
+#define SESSION_VERSION         1
+#define SESSION_HEADER_SIZE     5      // "CSES" and the version.
+#define SESSION_TRAILER_SIZE    8      // Offset of the index and "CIDX".
+#define SESSION_CODE_BITS       6
+#define SESSION_STATE_SIZE      (NUM_OF_STICKERS / 2 + 1)
+
+static void WriteVarint(std::vector<unsigned char>& data, unsigned long long value)
+{
+    while (value >= 0x80) {
+        data.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    data.push_back((unsigned char)value);
+}
+
+// Reads a varint at offset, moving offset past it. Returns false if it runs past end.
+static bool ReadVarint(const std::vector<unsigned char>& data, size_t end, size_t& offset, unsigned long long* value)
+{
+    *value = 0;
+    for (int shift = 0; offset < end && shift < 64; shift += 7) {
+        unsigned char byte = data[offset++];
+        *value |= (unsigned long long)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// Writes the header of an event: the time since the previous event and its code.
+static void WriteEvent(SessionWriter& writer, int code, unsigned int time)
+{
+    unsigned int delta = (time > writer.lastTime) ? time - writer.lastTime : 0;
+    WriteVarint(writer.data, ((unsigned long long)delta << SESSION_CODE_BITS) | code);
+    writer.lastTime += delta;
+    writer.numEvents++;
+}
+
+// Writes the state after the events so far, two stickers a byte and then the orientation.
+static void WriteState(SessionWriter& writer)
+{
+    const int* stickers = &writer.cube.stickers[0][0];
+    for (int i = 0; i < NUM_OF_STICKERS; i += 2) {
+        writer.data.push_back((unsigned char)(stickers[i] | (stickers[i + 1] << 4)));
+    }
+    writer.data.push_back((unsigned char)writer.cube.orientation);
+}
+
+static void WriteCheckpoint(SessionWriter& writer)
+{
+    SessionCheckpoint checkpoint = { writer.lastTime, writer.data.size() };
+    writer.checkpoints.push_back(checkpoint);
+    WriteEvent(writer, SESSION_EVENT_CHECKPOINT, writer.lastTime);
+    WriteState(writer);
+    writer.eventsSinceCheckpoint = 0;
+}
+
+// Counts an event towards the next checkpoint, writing it when due.
+static void EndEvent(SessionWriter& writer)
+{
+    if (++writer.eventsSinceCheckpoint == SESSION_CHECKPOINT_INTERVAL)
+        WriteCheckpoint(writer);
+}
+
+void BeginSession(SessionWriter& writer, const Cube& cube)
+{
+    const unsigned char header[SESSION_HEADER_SIZE] = { 'C', 'S', 'E', 'S', SESSION_VERSION };
+    writer.data.assign(header, header + SESSION_HEADER_SIZE);
+    writer.checkpoints.clear();
+    writer.cube = cube;
+    writer.lastTime = 0;
+    writer.numEvents = 0;
+    WriteCheckpoint(writer);
+}
+
+void RecordSessionMove(SessionWriter& writer, const Move& move, unsigned int time)
+{
+    WriteEvent(writer, MoveCode(move), time);
+    ApplyMove(writer.cube, move);
+    EndEvent(writer);
+}
+
+void RecordSessionReset(SessionWriter& writer, unsigned int time)
+{
+    WriteEvent(writer, SESSION_EVENT_RESET, time);
+    InitCube(writer.cube);
+    EndEvent(writer);
+}
+
+void RecordSessionScramble(SessionWriter& writer, unsigned int seed, unsigned int time)
+{
+    WriteEvent(writer, SESSION_EVENT_SCRAMBLE, time);
+    WriteVarint(writer.data, seed);
+    ScrambleCube(writer.cube, seed);
+    EndEvent(writer);
+}
+
+void RecordSessionState(SessionWriter& writer, const Cube& cube, unsigned int time)
+{
+    WriteEvent(writer, SESSION_EVENT_STATE, time);
+    writer.cube = cube;
+    WriteState(writer);
+    EndEvent(writer);
+}
+
+bool SaveSession(const SessionWriter& writer, const char* filename)
+{
+    std::vector<unsigned char> index;
+    WriteVarint(index, writer.checkpoints.size());
+    unsigned int previousTime = 0;
+    size_t previousOffset = 0;
+    for (size_t i = 0; i < writer.checkpoints.size(); i++) {
+        WriteVarint(index, writer.checkpoints[i].time - previousTime);
+        WriteVarint(index, writer.checkpoints[i].offset - previousOffset);
+        previousTime = writer.checkpoints[i].time;
+        previousOffset = writer.checkpoints[i].offset;
+    }
+    WriteVarint(index, writer.lastTime);
+    WriteVarint(index, writer.numEvents);
+    size_t indexOffset = writer.data.size();
+    for (int i = 0; i < 4; i++) {
+        index.push_back((unsigned char)(indexOffset >> (8 * i)));
+    }
+    index.insert(index.end(), { 'C', 'I', 'D', 'X' });
+
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL) {
+        printf("Unable to write session %s.\n", filename);
+        return false;
+    }
+    bool ok = fwrite(writer.data.data(), 1, writer.data.size(), file) == writer.data.size() &&
+              fwrite(index.data(), 1, index.size(), file) == index.size();
+    if (fclose(file) != 0 || !ok) {
+        printf("Unable to write session %s.\n", filename);
+        return false;
+    }
+    return true;
+}
+
+// Reads the index at the end of the data. Returns false if there isn't a valid one.
+static bool ReadIndex(Session& session)
+{
+    const std::vector<unsigned char>& data = session.data;
+    if (data.size() < SESSION_HEADER_SIZE + SESSION_TRAILER_SIZE || memcmp(&data[data.size() - 4], "CIDX", 4) != 0)
+        return false;
+    size_t end = data.size() - SESSION_TRAILER_SIZE;
+    size_t offset = 0;
+    for (int i = 0; i < 4; i++) {
+        offset |= (size_t)data[end + i] << (8 * i);
+    }
+    if (offset < SESSION_HEADER_SIZE || offset > end)
+        return false;
+    session.eventsEnd = offset;
+
+    unsigned long long count, time = 0, checkpointOffset = 0, value;
+    if (!ReadVarint(data, end, offset, &count) || count == 0 || count > session.eventsEnd)
+        return false;
+    session.checkpoints.resize((size_t)count);
+    for (size_t i = 0; i < session.checkpoints.size(); i++) {
+        if (!ReadVarint(data, end, offset, &value))
+            return false;
+        time += value;
+        if (!ReadVarint(data, end, offset, &value))
+            return false;
+        checkpointOffset += value;
+        if (checkpointOffset >= session.eventsEnd || data[checkpointOffset] % (1 << SESSION_CODE_BITS) != SESSION_EVENT_CHECKPOINT)
+            return false;
+        session.checkpoints[i].time = (unsigned int)time;
+        session.checkpoints[i].offset = (size_t)checkpointOffset;
+    }
+    if (!ReadVarint(data, end, offset, &value))
+        return false;
+    session.duration = (unsigned int)value;
+    if (!ReadVarint(data, end, offset, &value))
+        return false;
+    session.numEvents = (int)value;
+    return session.checkpoints[0].offset == SESSION_HEADER_SIZE;
+}
+
+// Rebuilds the index of a session that was cut short, keeping the events that are whole.
+static bool RebuildIndex(Session& session)
+{
+    session.eventsEnd = session.data.size();
+    session.checkpoints.clear();
+    session.duration = 0;
+    session.numEvents = 0;
+
+    SessionCursor cursor = { SESSION_HEADER_SIZE, 0 };
+    SessionEvent event;
+    size_t offset = cursor.offset;
+    while (NextSessionEvent(session, cursor, event)) {
+        if (event.code == SESSION_EVENT_CHECKPOINT) {
+            SessionCheckpoint checkpoint = { event.time, offset };
+            session.checkpoints.push_back(checkpoint);
+        }
+        session.duration = event.time;
+        session.numEvents++;
+        offset = cursor.offset;
+    }
+    session.eventsEnd = offset;
+    return !session.checkpoints.empty() && session.checkpoints[0].offset == SESSION_HEADER_SIZE;
+}
+
+bool LoadSession(const char* filename, Session& session)
+{
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL) {
+        printf("Unable to open session %s.\n", filename);
+        return false;
+    }
+    session.data.clear();
+    unsigned char buffer[65536];
+    size_t length;
+    while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        session.data.insert(session.data.end(), buffer, buffer + length);
+    }
+    fclose(file);
+
+    if (session.data.size() < SESSION_HEADER_SIZE || memcmp(session.data.data(), "CSES", 4) != 0 || session.data[4] != SESSION_VERSION) {
+        printf("%s is not a session recording.\n", filename);
+        return false;
+    }
+    if (!ReadIndex(session)) {
+        if (!RebuildIndex(session)) {
+            printf("%s is not a session recording.\n", filename);
+            return false;
+        }
+        printf("%s has no index, it was rebuilt from the events.\n", filename);
+    }
+    return true;
+}
+
+bool NextSessionEvent(const Session& session, SessionCursor& cursor, SessionEvent& event)
+{
+    size_t offset = cursor.offset;
+    unsigned long long value;
+    if (!ReadVarint(session.data, session.eventsEnd, offset, &value))
+        return false;
+    event.code = (int)(value % (1 << SESSION_CODE_BITS));
+    event.time = cursor.time + (unsigned int)(value >> SESSION_CODE_BITS);
+
+    if (event.code == SESSION_EVENT_SCRAMBLE) {
+        if (!ReadVarint(session.data, session.eventsEnd, offset, &value))
+            return false;
+        event.seed = (unsigned int)value;
+    }
+    else if (event.code == SESSION_EVENT_CHECKPOINT || event.code == SESSION_EVENT_STATE) {
+        if (offset + SESSION_STATE_SIZE > session.eventsEnd)
+            return false;
+        int* stickers = &event.cube.stickers[0][0];
+        for (int i = 0; i < NUM_OF_STICKERS; i += 2) {
+            stickers[i] = session.data[offset] & 0x0F;
+            stickers[i + 1] = session.data[offset] >> 4;
+            offset++;
+        }
+        event.cube.orientation = session.data[offset++];
+        if (event.cube.orientation >= NUM_OF_ORIENTATIONS)
+            return false;
+    }
+    else if (event.code >= NUM_OF_MOVE_CODES && event.code != SESSION_EVENT_RESET) {
+        return false;
+    }
+    cursor.offset = offset;
+    cursor.time = event.time;
+    return true;
+}
+
+void SeekSession(const Session& session, unsigned int time, Cube& cube, SessionCursor& cursor)
+{
+    // The last checkpoint at or before the time. The first is at the start of the session.
+    std::vector<SessionCheckpoint>::const_iterator checkpoint = std::upper_bound(
+        session.checkpoints.begin(), session.checkpoints.end(), time,
+        [](unsigned int time, const SessionCheckpoint& checkpoint) { return time < checkpoint.time; });
+    if (checkpoint != session.checkpoints.begin())
+        --checkpoint;
+
+    // Checkpoints are written with no time since the previous event, so the cursor can start on one.
+    cursor.offset = checkpoint->offset;
+    cursor.time = checkpoint->time;
+    SessionEvent event;
+    InitCube(cube);
+    SessionCursor next = cursor;
+    while (NextSessionEvent(session, next, event) && event.time <= time) {
+        ApplySessionEvent(cube, event);
+        cursor = next;
+    }
+}
+
+bool SessionEventMove(const SessionEvent& event, Move* move)
+{
+    if (event.code >= NUM_OF_MOVE_CODES)
+        return false;
+    *move = MoveFromCode(event.code);
+    return true;
+}
+
+void ApplySessionEvent(Cube& cube, const SessionEvent& event)
+{
+    Move move;
+    if (SessionEventMove(event, &move))
+        ApplyMove(cube, move);
+    else if (event.code == SESSION_EVENT_RESET)
+        InitCube(cube);
+    else if (event.code == SESSION_EVENT_SCRAMBLE)
+        ScrambleCube(cube, event.seed);
+    else if (event.code == SESSION_EVENT_CHECKPOINT || event.code == SESSION_EVENT_STATE)
+        cube = event.cube;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// SESSION RECORDINGS
+//
+// A session is every move, reset, scramble and undo made in the viewer, with the
+// time it was made, so it can be replayed or scrubbed through later.
+//
+// FILE FORMAT
+// "CSES" and a version byte of 1, then the events. Each event starts with a
+// varint (7 bits a byte, least significant first) holding the milliseconds
+// since the previous event shifted left by 6, plus a 6-bit event code:
+//
+//   0-59   move, numbered by MoveCode: quarter turns from 0, half turns from 36
+//          (codes past NUM_OF_MOVE_CODES are unused)
+//   60     reset to the solved state
+//   61     scramble, followed by the seed as a varint
+//   62     checkpoint, followed by the full state, two stickers a byte, then
+//          the orientation in a byte
+//   63     state set by jumping through the undo history, stored like a checkpoint
+//
+// Moves turn the cube's own faces (see Cube), whichever way it was held.
+//
+// With 6 bits taken by the code, a move is one byte if it came at most 1 ms
+// after the previous event, two bytes within 255 ms, three within 32
+// seconds and four within 69 minutes, so moves at a human pace take two or
+// three bytes. Every SESSION_CHECKPOINT_INTERVAL events a checkpoint is written,
+// and the file ends with an index of them (their time and offset), the
+// duration and number of events, the offset of the index as 4 little endian
+// bytes and "CIDX". Seeking loads the last checkpoint at or before the time
+// and replays at most SESSION_CHECKPOINT_INTERVAL events from it. A file
+// that was cut short has no index; it is rebuilt by reading the events.
+/////////////////////////////////////////////////////////////////////////////
+
+#define SESSION_CHECKPOINT_INTERVAL 1024    // Events between checkpoints.
+
+#define SESSION_EVENT_RESET     60
+#define SESSION_EVENT_SCRAMBLE  61
+#define SESSION_EVENT_CHECKPOINT 62
+#define SESSION_EVENT_STATE     63
+
+struct SessionEvent {
+    int code;                   // Event code, as above.
+    unsigned int time;          // Milliseconds since the session started.
+    unsigned int seed;          // For SESSION_EVENT_SCRAMBLE.
+    Cube cube;                  // For SESSION_EVENT_CHECKPOINT and SESSION_EVENT_STATE.
+};
+
+struct SessionCheckpoint {
+    unsigned int time;
+    size_t offset;              // Of the checkpoint event in the data.
+};
+
+// A session being recorded.
+struct SessionWriter {
+    std::vector<unsigned char> data;
+    std::vector<SessionCheckpoint> checkpoints;
+    Cube cube;                  // The state after the events so far.
+    unsigned int lastTime;
+    int numEvents;
+    int eventsSinceCheckpoint;
+};
+
+// A session loaded for replay.
+struct Session {
+    std::vector<unsigned char> data;
+    size_t eventsEnd;           // Offset just past the last event.
+    std::vector<SessionCheckpoint> checkpoints;
+    unsigned int duration;      // Time of the last event.
+    int numEvents;
+};
+
+// Where replay is up to in a session.
+struct SessionCursor {
+    size_t offset;              // Of the next event.
+    unsigned int time;          // Of the event before it.
+};
+
+// Starts a session from the given state.
+void BeginSession(SessionWriter& writer, const Cube& cube);
+
+// Records a move, reset, scramble or other change of state made time milliseconds after the session started.
+void RecordSessionMove(SessionWriter& writer, const Move& move, unsigned int time);
+void RecordSessionReset(SessionWriter& writer, unsigned int time);
+void RecordSessionScramble(SessionWriter& writer, unsigned int seed, unsigned int time);
+void RecordSessionState(SessionWriter& writer, const Cube& cube, unsigned int time);
+
+// Writes the session with its index. Prints the reason and returns false on failure.
+bool SaveSession(const SessionWriter& writer, const char* filename);
+
+// Reads a session. Prints the reason and returns false if it can't be read or isn't a session.
+bool LoadSession(const char* filename, Session& session);
+
+// Sets cube to the state time milliseconds into the session, and cursor to the first event after it.
+void SeekSession(const Session& session, unsigned int time, Cube& cube, SessionCursor& cursor);
+
+// Reads the event at the cursor and moves past it. Returns false at the end of the session.
+bool NextSessionEvent(const Session& session, SessionCursor& cursor, SessionEvent& event);
+
+// The move of a turn or rotation event. Returns false for other events.
+bool SessionEventMove(const SessionEvent& event, Move* move);
+
+// Applies an event to the state.
+void ApplySessionEvent(Cube& cube, const SessionEvent& event);
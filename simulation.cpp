@@ -0,0 +1,383 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lockfree.h"
+#include "pattern.h"
+#include "script.h"
+#include "simulation.h"
+#include "trace.h"
+
+typedef std::chrono::steady_clock Clock;
+
+// Shared between the threads.
+static SpscQueue<SimulationCommand, SIMULATION_QUEUE_SIZE> commands;
+static TripleBuffer<CubeSnapshot> snapshots;
+static std::atomic<unsigned int> sequenceTaken(0);     // Sequence of the snapshot the render side has.
+static std::atomic<bool> stopSimulation(false);
+static std::mutex wakeupMutex;                          // Only used to sleep the simulation thread.
+static std::condition_variable wakeup;
+static bool wakeupPending = false;                      // A command was posted since the thread last woke. Under wakeupMutex.
+static std::thread simulationThread;
+
+// Only used by the GLUT thread.
+static unsigned int commandsPosted = 0;
+
+// Only used by the simulation thread.
+static AnimatedCube animatedCube;                       // Runs the interactive script below.
+static std::vector<Move> demoMoves;                     // Played before the queued moves, for --play.
+static const Session* replaySession = NULL;             // Replayed instead of taking moves, for --replay.
+static bool replayPlaying = false;
+static Clock::time_point replayStartTime;               // When the session would have started, while playing.
+static unsigned int replayTime = 0;                     // Where the replay is, while paused.
+static Move moveQueue[MOVE_QUEUE_SIZE];                 // Moves waiting to be animated, oldest first.
+static int moveQueueHead = 0;
+static int moveQueueCount = 0;
+static std::coroutine_handle<> waitingForMove;          // The script, while the queue is empty.
+static Clock::time_point nextFrameTime;
+static unsigned int commandsDone = 0;
+static unsigned int sequencePublished = 0;
+static AppliedInput appliedInputs[LATENCY_MAX_PENDING];
+static int numAppliedInputs = 0;
+static Pattern stagePatterns[NUM_OF_STAGE_PATTERNS];    // Made when the simulation starts.
+static const char* stageNames[NUM_OF_STAGE_PATTERNS] = { "cross solved", "F2L solved", "last layer oriented", "solved" };
+
+// Print the number of incorrect stickers (e.g. U move from solved state is 12 incorrect stickers),
+// and the furthest stage of solving the cube has reached.
+static void PrintIncorrectCount()
+{
+    Cube recoloured;
+    PackedCube state;
+    uint64_t matches;
+    RecolourByCentres(animatedCube.cube, recoloured);
+    PackCube(recoloured, state);
+    MatchPatterns(&state, 1, stagePatterns, NUM_OF_STAGE_PATTERNS, &matches);
+    int stage = NUM_OF_STAGE_PATTERNS - 1;
+    while (stage >= 0 && !(matches & ((uint64_t)1 << stage))) {
+        stage--;
+    }
+    if (stage >= 0)
+        printf("Incorrect count: %d (%s)\n", CountIncorrectStickers(animatedCube.cube), stageNames[stage]);
+    else
+        printf("Incorrect count: %d\n", CountIncorrectStickers(animatedCube.cube));
+}
+
+// Remembers that an input shows from the next snapshot on.
+static void AddAppliedInput(int kind, double inputTime)
+{
+    if (inputTime == 0.0)
+        return;
+    if (numAppliedInputs == LATENCY_MAX_PENDING) {
+        memmove(appliedInputs, appliedInputs + 1, (LATENCY_MAX_PENDING - 1) * sizeof(AppliedInput));
+        numAppliedInputs--;
+    }
+    AppliedInput& input = appliedInputs[numAppliedInputs++];
+    input.kind = kind;
+    input.inputTime = inputTime;
+    input.sequence = sequencePublished + 1;
+}
+
+// Milliseconds into the replayed session.
+static unsigned int ReplayTime()
+{
+    if (!replayPlaying)
+        return replayTime;
+    long long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - replayStartTime).count();
+    return (unsigned int)std::min<long long>(elapsed, replaySession->duration);
+}
+
+static void PublishSnapshot()
+{
+    // Inputs in snapshots the render side already has are done with.
+    unsigned int taken = sequenceTaken.load(std::memory_order_acquire);
+    int kept = 0;
+    for (int i = 0; i < numAppliedInputs; i++) {
+        if (appliedInputs[i].sequence > taken)
+            appliedInputs[kept++] = appliedInputs[i];
+    }
+    numAppliedInputs = kept;
+
+    CubeSnapshot& snapshot = snapshots.Back();
+    snapshot.cube = animatedCube.cube;
+    snapshot.rotatingTurn = animatedCube.rotatingTurn;
+    snapshot.rotatingDirection = animatedCube.rotatingDirection;
+    snapshot.frameNumber = animatedCube.frameNumber;
+    snapshot.animationFrames = animatedCube.animationFrames;
+    snapshot.sequence = ++sequencePublished;
+    snapshot.commandsDone = commandsDone;
+    snapshot.animating = animatedCube.IsBusy();
+    snapshot.movesApplied = animatedCube.movesApplied;
+    snapshot.updateTime = animatedCube.updateTime;
+    snapshot.replayTime = (replaySession != NULL) ? ReplayTime() : 0;
+    snapshot.replayPlaying = replayPlaying;
+    memcpy(snapshot.appliedInputs, appliedInputs, numAppliedInputs * sizeof(AppliedInput));
+    snapshot.numAppliedInputs = numAppliedInputs;
+    snapshots.Publish();
+}
+
+// Returns the number of frames to animate a move in, given the number of moves still waiting behind it.
+// Animations get shorter as the backlog grows so playback catches up with the input.
+static int AnimationFramesForBacklog(int backlog)
+{
+    if (backlog <= MOVE_QUEUE_FAST_BACKLOG)
+        return NUM_OF_FRAMES;
+    int frames = NUM_OF_FRAMES * MOVE_QUEUE_FAST_BACKLOG / backlog;
+    return (frames < MIN_NUM_OF_FRAMES) ? MIN_NUM_OF_FRAMES : frames;
+}
+
+// Removes and returns the oldest move in the queue.
+static Move DequeueMove()
+{
+    Move move = moveQueue[moveQueueHead];
+    moveQueueHead = (moveQueueHead + 1) % MOVE_QUEUE_SIZE;
+    moveQueueCount--;
+    return move;
+}
+
+// Suspends the script until a move is queued, then dequeues it.
+struct QueuedMoveAwaiter {
+    bool await_ready() const { return moveQueueCount > 0; }
+    void await_suspend(std::coroutine_handle<> script) { waitingForMove = script; }
+    Move await_resume() { return DequeueMove(); }
+};
+
+// Plays the moves read for --play, pausing after each so they can be followed.
+static Script PlayDemo()
+{
+    for (size_t i = 0; i < demoMoves.size(); i++) {
+        co_await turn(demoMoves[i]);
+        co_await delay(std::chrono::milliseconds(DEMO_MOVE_DELAY));
+    }
+    PrintIncorrectCount();
+}
+
+// The script of the interactive cube: animates each queued move once the moves before it are done.
+static Script PlayQueuedMoves()
+{
+    if (!demoMoves.empty())
+        co_await PlayDemo();
+    for (;;) {
+        Move move = co_await QueuedMoveAwaiter();
+        AddAppliedInput(LATENCY_MOVE, move.inputTime);
+        co_await turn(move, AnimationFramesForBacklog(moveQueueCount));
+        if (move.turn < TURN_X)
+            PrintIncorrectCount();
+    }
+}
+
+// Replays the session from the given time, with each event when it was made. Turns are
+// shortened when the next event follows sooner than an animation takes.
+static Script PlaySession(unsigned int time)
+{
+    SessionCursor cursor;
+    SeekSession(*replaySession, time, animatedCube.cube, cursor);
+    replayPlaying = true;
+    replayStartTime = Clock::now() - std::chrono::milliseconds(time);
+
+    SessionEvent event;
+    while (NextSessionEvent(*replaySession, cursor, event)) {
+        co_await delay(replayStartTime + std::chrono::milliseconds(event.time) - Clock::now());
+        Move move;
+        if (!SessionEventMove(event, &move)) {
+            ApplySessionEvent(animatedCube.cube, event);
+            continue;
+        }
+        SessionCursor next = cursor;
+        SessionEvent nextEvent;
+        int frames = NUM_OF_FRAMES;
+        if (NextSessionEvent(*replaySession, next, nextEvent))
+            frames = std::clamp((int)((nextEvent.time - event.time) * SIMULATION_FPS / 1000), MIN_NUM_OF_FRAMES, NUM_OF_FRAMES);
+        co_await turn(move, frames);
+    }
+    replayPlaying = false;
+    replayTime = replaySession->duration;
+}
+
+// Stops the replay and shows the session at the given time.
+static void SeekReplay(unsigned int time)
+{
+    SessionCursor cursor;
+    animatedCube.Run(Script());
+    SeekSession(*replaySession, time, animatedCube.cube, cursor);
+    replayPlaying = false;
+    replayTime = std::min(time, replaySession->duration);
+}
+
+// Finishes the current turn and the oldest queued moves at once until no more than maxPending
+// moves are waiting. A demo still playing is finished first, as the queued moves come after it.
+static void CollapseMoveQueue(int maxPending)
+{
+    while (moveQueueCount > maxPending && animatedCube.IsBusy()) {
+        animatedCube.Skip();
+    }
+}
+
+// Adds a move to the queue, waking the script if it was waiting for one.
+static void QueueMove(const Move& move)
+{
+    moveQueue[(moveQueueHead + moveQueueCount) % MOVE_QUEUE_SIZE] = move;
+    moveQueueCount++;
+
+    // Never let the displayed cube fall too far behind the input.
+    CollapseMoveQueue(MOVE_QUEUE_MAX_BEHIND);
+    if (moveQueueCount > 0 && waitingForMove) {
+        std::coroutine_handle<> script = waitingForMove;
+        waitingForMove = nullptr;
+        script.resume();
+    }
+}
+
+static void RunCommand(const SimulationCommand& command)
+{
+    TRACE_SCOPE("RunCommand");
+    switch (command.type) {
+    case SIMULATION_QUEUE_MOVE:
+        QueueMove(command.move);
+        break;
+
+    case SIMULATION_RESET:
+        CollapseMoveQueue(0);
+        animatedCube.FinishTurn();
+        InitCube(animatedCube.cube);
+        break;
+
+    case SIMULATION_SCRAMBLE:
+        CollapseMoveQueue(0);
+        animatedCube.FinishTurn();
+        ScrambleCube(animatedCube.cube, command.seed);
+        PrintIncorrectCount();
+        break;
+
+    case SIMULATION_SET_STATE:
+        CollapseMoveQueue(0);
+        animatedCube.FinishTurn();
+        animatedCube.cube = command.cube;
+        PrintIncorrectCount();
+        break;
+
+    case SIMULATION_SEEK:
+        if (replaySession != NULL)
+            SeekReplay(command.time);
+        break;
+
+    case SIMULATION_PLAY:
+        if (replaySession != NULL)
+            animatedCube.Run(PlaySession(std::min(command.time, replaySession->duration)));
+        break;
+    }
+}
+
+// Carries out commands as they arrive and ticks the cube's script at SIMULATION_FPS, publishing
+// a snapshot whenever anything changed.
+static void SimulationThread()
+{
+    TRACE_THREAD_NAME("simulation");
+    const Clock::duration framePeriod = std::chrono::microseconds(1000000 / SIMULATION_FPS);
+    animatedCube.Run((replaySession != NULL) ? PlaySession(0) : PlayQueuedMoves());
+    nextFrameTime = Clock::now() + framePeriod;
+    PublishSnapshot();
+
+    while (!stopSimulation.load()) {
+        bool changed = false;
+        bool wasBusy = animatedCube.IsBusy();
+        SimulationCommand command;
+        while (commands.Pop(command)) {
+            RunCommand(command);
+            commandsDone++;
+            changed = true;
+        }
+        Clock::time_point now = Clock::now();
+        if (!wasBusy) {
+            // A turn that just started shows its first frame now and its second a frame later.
+            nextFrameTime = now + framePeriod;
+        }
+        else if (animatedCube.IsBusy() && now >= nextFrameTime) {
+            TRACE_SCOPE("TickScript");
+            animatedCube.Tick(now);
+            nextFrameTime += framePeriod;
+            changed = true;
+        }
+        if (changed)
+            PublishSnapshot();
+
+        // Sleep until the next animation frame is due or a command arrives. A command posted
+        // after the queue was emptied above leaves wakeupPending set, so it isn't slept through.
+        std::unique_lock<std::mutex> lock(wakeupMutex);
+        if (animatedCube.IsBusy())
+            wakeup.wait_until(lock, nextFrameTime, [] { return wakeupPending; });
+        else
+            wakeup.wait(lock, [] { return wakeupPending; });
+        wakeupPending = false;
+    }
+}
+
+void StartSimulation(const std::vector<Move>& demo, const Session* replay)
+{
+    if (simulationThread.joinable())
+        return;
+    demoMoves = demo;
+    replaySession = replay;
+    for (int stage = 0; stage < NUM_OF_STAGE_PATTERNS; stage++) {
+        MakeStagePattern(stage, stagePatterns[stage]);
+    }
+    stopSimulation = false;
+    simulationThread = std::thread(SimulationThread);
+
+    // The render side always has a snapshot to draw, starting with the solved cube.
+    while (!snapshots.Update()) {
+        std::this_thread::yield();
+    }
+    sequenceTaken.store(snapshots.Front().sequence, std::memory_order_release);
+}
+
+static void WakeSimulation()
+{
+    std::lock_guard<std::mutex> lock(wakeupMutex);
+    wakeupPending = true;
+    wakeup.notify_one();
+}
+
+void StopSimulation()
+{
+    if (!simulationThread.joinable())
+        return;
+    stopSimulation = true;
+    WakeSimulation();
+    simulationThread.join();
+}
+
+bool PostSimulationCommand(const SimulationCommand& command)
+{
+    if (!commands.Push(command))
+        return false;
+    commandsPosted++;
+    WakeSimulation();
+    return true;
+}
+
+bool UpdateSnapshot()
+{
+    if (!snapshots.Update())
+        return false;
+    sequenceTaken.store(snapshots.Front().sequence, std::memory_order_release);
+    return true;
+}
+
+const CubeSnapshot& GetSnapshot()
+{
+    return snapshots.Front();
+}
+
+bool IsSimulationBusy()
+{
+    const CubeSnapshot& snapshot = snapshots.Front();
+    return snapshot.animating || snapshot.commandsDone != commandsPosted;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "cube.h"
+#include "latency.h"
+#include "script.h"
+#include "session.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// SIMULATION THREAD
+//
+// Owns the cube's state, the queue of moves waiting to be animated and the
+// animation clock, so a slow operation never holds up drawing or input.
+// The cube is an AnimatedCube whose script takes the queued moves in turn.
+// The input side posts commands over a single-producer/single-consumer
+// lock-free queue. After every change the simulation publishes an immutable
+// snapshot through a triple buffer, and the render side draws the newest
+// one without locking.
+//
+// Everything except StartSimulation and StopSimulation runs on the GLUT
+// thread, which is both the only producer of commands and the only reader
+// of snapshots.
+/////////////////////////////////////////////////////////////////////////////
+
+#define SIMULATION_FPS          60      // Animation frames per second.
+#define MIN_NUM_OF_FRAMES       2       // Fewest frames a sped up animation is shortened to.
+#define DEMO_MOVE_DELAY         200     // Milliseconds between the moves of a --play demo.
+
+#define MOVE_QUEUE_SIZE         16      // Capacity of the pending move queue.
+#define MOVE_QUEUE_FAST_BACKLOG 2       // Number of pending moves above which animations are sped up.
+#define MOVE_QUEUE_MAX_BEHIND   8       // Max number of pending moves before they are applied without animation.
+
+#define SIMULATION_QUEUE_SIZE   64      // Commands waiting for the simulation before new ones are refused.
+
+#define SIMULATION_QUEUE_MOVE   0       // Animate a move once the moves queued before it are done.
+#define SIMULATION_RESET        1       // Finish the queued moves at once, then return to the solved state.
+#define SIMULATION_SCRAMBLE     2       // Finish the queued moves at once, then scramble.
+#define SIMULATION_SEEK         3       // Show the replayed session at a time, paused.
+#define SIMULATION_PLAY         4       // Play the replayed session from a time.
+#define SIMULATION_SET_STATE    5       // Finish the queued moves at once, then set the state (e.g. to undo a scramble).
+
+struct SimulationCommand {
+    int type;               // SIMULATION_ command.
+    Move move;              // For SIMULATION_QUEUE_MOVE.
+    unsigned int seed;      // For SIMULATION_SCRAMBLE.
+    unsigned int time;      // For SIMULATION_SEEK and SIMULATION_PLAY, in milliseconds into the session.
+    Cube cube;              // For SIMULATION_SET_STATE.
+};
+
+// An input whose effect first appeared in the snapshot numbered sequence.
+struct AppliedInput {
+    int kind;               // LATENCY_ kind.
+    double inputTime;
+    unsigned int sequence;
+};
+
+// The state of the simulation at one moment, as drawn in a frame.
+struct CubeSnapshot {
+    Cube cube;
+    int rotatingTurn;               // TURN_ constant of the layers turning, or TURN_NONE.
+    int rotatingDirection;
+    int frameNumber;                // How far the layers have turned, from 1 to animationFrames. 0 when nothing turns.
+    int animationFrames;            // Number of frames in the current animation.
+
+    unsigned int sequence;          // Number of snapshots published up to and including this one.
+    unsigned int commandsDone;      // Commands the simulation had carried out.
+    bool animating;                 // More snapshots will follow without further commands.
+    int movesApplied;               // Moves applied to the state since the simulation started.
+    double updateTime;              // Microseconds spent applying them.
+    unsigned int replayTime;        // Milliseconds into the replayed session, if there is one.
+    bool replayPlaying;
+
+    // Inputs applied since the last snapshot the render side took, so none are lost
+    // when snapshots are skipped.
+    AppliedInput appliedInputs[LATENCY_MAX_PENDING];
+    int numAppliedInputs;
+};
+
+// Starts the simulation thread with a solved cube, which plays the demo moves (if any)
+// before taking queued moves. If a session is given the cube replays it instead, and
+// must not be sent moves; the session must outlive the simulation.
+void StartSimulation(const std::vector<Move>& demo, const Session* replay);
+
+// Stops and joins the simulation thread.
+void StopSimulation();
+
+// Queues a command for the simulation. Returns false if too many are already waiting.
+bool PostSimulationCommand(const SimulationCommand& command);
+
+// Takes the newest snapshot, if one was published since the last call. Returns true if it did.
+bool UpdateSnapshot();
+
+// The snapshot taken by the last UpdateSnapshot. Stays valid until the next call.
+const CubeSnapshot& GetSnapshot();
+
+// True until the snapshot taken reflects every posted command and the animation has finished.
+bool IsSimulationBusy();
@@ -0,0 +1,625 @@
+#include <string.h>
+
+#include <utility>
+
+#include "pattern.h"
+#include "subgroup.h"
+
+static const int moveDirections[3] = { CLOCKWISE, ANTI_CLOCKWISE, HALF_TURN };
+
+// The direction each face looks, on the axes of StickerPiece.
+static const int faceNormals[NUM_OF_FACES][3] = { { 0, 1, 0 }, { 0, 0, 1 }, { 1, 0, 0 }, { 0, 0, -1 }, { -1, 0, 0 }, { 0, -1, 0 } };
+
+// Where the corners and edges are, each numbered by its place from the lowest up.
+struct PieceGeometry {
+    // Each corner's stickers with its U or D sticker first and the others clockwise seen from
+    // outside, and each edge's with its U or D sticker first, or its F or B sticker on the E slice.
+    int cornerStickers[SUBGROUP_CORNERS][3];
+    int edgeStickers[SUBGROUP_EDGES][2];
+
+    // The corner or edge whose colours are these, in the order above, or -1.
+    signed char cornerOfColours[NUM_OF_FACES * NUM_OF_FACES * NUM_OF_FACES];
+    signed char edgeOfColours[NUM_OF_FACES * NUM_OF_FACES];
+
+    PieceGeometry();
+};
+
+// The state of an IDA* search.
+struct SubgroupSearch {
+    const Subgroup* subgroup;
+    int numMoves;
+    bool decode;                        // Some component has no move table, so the pieces are moved too.
+    bool allowed[SUBGROUP_MAX_MOVES + 1][SUBGROUP_MAX_MOVES];      // Moves allowed after each move (or none, at 0).
+    std::vector<int> path;
+};
+
+static bool IsUpDown(int face)
+{
+    return face == FACE_UP || face == FACE_DOWN;
+}
+
+static bool IsFrontBack(int face)
+{
+    return face == FACE_FRONT || face == FACE_BACK;
+}
+
+PieceGeometry::PieceGeometry()
+{
+    int corners[NUM_OF_PIECES], edges[NUM_OF_PIECES];
+    int numCorners = 0, numEdges = 0;
+    for (int piece = 0; piece < NUM_OF_PIECES; piece++) {
+        int middles = (piece % 3 == 1) + ((piece / 3) % 3 == 1) + (piece / 9 == 1);
+        corners[piece] = (middles == 0) ? numCorners++ : -1;
+        edges[piece] = (middles == 1) ? numEdges++ : -1;
+    }
+    int cornerFound[SUBGROUP_CORNERS] = {}, edgeFound[SUBGROUP_EDGES] = {};
+    for (int sticker = 0; sticker < NUM_OF_STICKERS; sticker++) {
+        int piece = StickerPiece(sticker);
+        if (corners[piece] >= 0)
+            cornerStickers[corners[piece]][cornerFound[corners[piece]]++] = sticker;
+        else if (edges[piece] >= 0)
+            edgeStickers[edges[piece]][edgeFound[edges[piece]]++] = sticker;
+    }
+
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        int* stickers = cornerStickers[corner];
+        while (!IsUpDown(stickers[0] / NUM_OF_SQUARES)) {
+            int first = stickers[0];
+            stickers[0] = stickers[1];
+            stickers[1] = stickers[2];
+            stickers[2] = first;
+        }
+        // Clockwise seen from outside when the normals make a left-handed set.
+        const int* a = faceNormals[stickers[0] / NUM_OF_SQUARES];
+        const int* b = faceNormals[stickers[1] / NUM_OF_SQUARES];
+        const int* c = faceNormals[stickers[2] / NUM_OF_SQUARES];
+        int determinant = a[0] * (b[1] * c[2] - b[2] * c[1]) - a[1] * (b[0] * c[2] - b[2] * c[0]) + a[2] * (b[0] * c[1] - b[1] * c[0]);
+        if (determinant > 0)
+            std::swap(stickers[1], stickers[2]);
+    }
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        int* stickers = edgeStickers[edge];
+        int first = stickers[0] / NUM_OF_SQUARES, second = stickers[1] / NUM_OF_SQUARES;
+        if (IsUpDown(second) || (!IsUpDown(first) && IsFrontBack(second)))
+            std::swap(stickers[0], stickers[1]);
+    }
+
+    Cube solved;
+    InitCube(solved);
+    const int* colours = &solved.stickers[0][0];
+    memset(cornerOfColours, -1, sizeof(cornerOfColours));
+    memset(edgeOfColours, -1, sizeof(edgeOfColours));
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        const int* stickers = cornerStickers[corner];
+        cornerOfColours[(colours[stickers[0]] * NUM_OF_FACES + colours[stickers[1]]) * NUM_OF_FACES + colours[stickers[2]]] = (signed char)corner;
+    }
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        edgeOfColours[colours[edgeStickers[edge][0]] * NUM_OF_FACES + colours[edgeStickers[edge][1]]] = (signed char)edge;
+    }
+}
+
+static const PieceGeometry& GetPieceGeometry()
+{
+    static const PieceGeometry geometry;
+    return geometry;
+}
+
+bool ReadCubePieces(const Cube& cube, CubePieces& pieces)
+{
+    const PieceGeometry& geometry = GetPieceGeometry();
+    const int* stickers = &cube.stickers[0][0];
+    bool seen[SUBGROUP_EDGES] = {};
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        int colours[3];
+        int twist = -1;
+        for (int i = 0; i < 3; i++) {
+            colours[i] = stickers[geometry.cornerStickers[corner][i]];
+            if (colours[i] < 0 || colours[i] >= NUM_OF_FACES)
+                return false;
+            if (IsUpDown(colours[i]))
+                twist = i;
+        }
+        if (twist < 0)
+            return false;
+        int piece = geometry.cornerOfColours[(colours[twist] * NUM_OF_FACES + colours[(twist + 1) % 3]) * NUM_OF_FACES + colours[(twist + 2) % 3]];
+        if (piece < 0 || seen[piece])
+            return false;
+        seen[piece] = true;
+        pieces.corners[corner] = (unsigned char)piece;
+        pieces.twists[corner] = (unsigned char)twist;
+    }
+
+    memset(seen, 0, sizeof(seen));
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        int first = stickers[geometry.edgeStickers[edge][0]];
+        int second = stickers[geometry.edgeStickers[edge][1]];
+        if (first < 0 || first >= NUM_OF_FACES || second < 0 || second >= NUM_OF_FACES)
+            return false;
+        bool flipped = !(IsUpDown(first) || (!IsUpDown(second) && IsFrontBack(first)));
+        int piece = flipped ? geometry.edgeOfColours[second * NUM_OF_FACES + first] : geometry.edgeOfColours[first * NUM_OF_FACES + second];
+        if (piece < 0 || seen[piece])
+            return false;
+        seen[piece] = true;
+        pieces.edges[edge] = (unsigned char)piece;
+        pieces.flips[edge] = flipped;
+    }
+    return true;
+}
+
+static void SolvedPieces(CubePieces& pieces)
+{
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        pieces.corners[corner] = (unsigned char)corner;
+        pieces.twists[corner] = 0;
+    }
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        pieces.edges[edge] = (unsigned char)edge;
+        pieces.flips[edge] = 0;
+    }
+}
+
+void MoveCubePieces(const CubePieces& move, const CubePieces& state, CubePieces& result)
+{
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        result.corners[corner] = state.corners[move.corners[corner]];
+        result.twists[corner] = (unsigned char)((state.twists[move.corners[corner]] + move.twists[corner]) % 3);
+    }
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        result.edges[edge] = state.edges[move.edges[edge]];
+        result.flips[edge] = state.flips[move.edges[edge]] ^ move.flips[edge];
+    }
+}
+
+static uint32_t EncodeComponent(const SubgroupComponent& component, const CubePieces& pieces)
+{
+    uint32_t value = 0;
+    int n = component.numSlots;
+    if (component.kind == COMPONENT_CORNERS || component.kind == COMPONENT_EDGES) {
+        const unsigned char* slots = (component.kind == COMPONENT_CORNERS) ? pieces.corners : pieces.edges;
+        for (int i = 0; i < n; i++) {
+            int index = component.slotIndex[slots[component.slots[i]]];
+            uint32_t smaller = 0;
+            for (int j = i + 1; j < n; j++) {
+                smaller += (component.slotIndex[slots[component.slots[j]]] < index);
+            }
+            value = value * (n - i) + smaller;
+        }
+    }
+    else {
+        const unsigned char* orientations = (component.kind == COMPONENT_TWISTS) ? pieces.twists : pieces.flips;
+        int base = (component.kind == COMPONENT_TWISTS) ? 3 : 2;
+        for (int i = n - 2; i >= 0; i--) {
+            value = value * base + orientations[component.slots[i]];
+        }
+    }
+    return value;
+}
+
+// Sets the slots of a component to a value, leaving the rest as they are.
+static void DecodeComponent(const SubgroupComponent& component, uint32_t value, CubePieces& pieces)
+{
+    int n = component.numSlots;
+    if (component.kind == COMPONENT_CORNERS || component.kind == COMPONENT_EDGES) {
+        unsigned char* slots = (component.kind == COMPONENT_CORNERS) ? pieces.corners : pieces.edges;
+        int digits[SUBGROUP_EDGES], remaining[SUBGROUP_EDGES];
+        for (int i = n - 1; i >= 0; i--) {
+            digits[i] = value % (n - i);
+            value /= n - i;
+        }
+        for (int i = 0; i < n; i++) {
+            remaining[i] = component.slots[i];
+        }
+        for (int i = 0; i < n; i++) {
+            slots[component.slots[i]] = (unsigned char)remaining[digits[i]];
+            memmove(&remaining[digits[i]], &remaining[digits[i] + 1], (n - 1 - digits[i]) * sizeof(int));
+        }
+    }
+    else {
+        unsigned char* orientations = (component.kind == COMPONENT_TWISTS) ? pieces.twists : pieces.flips;
+        int base = (component.kind == COMPONENT_TWISTS) ? 3 : 2;
+        int sum = 0;
+        for (int i = 0; i < n - 1; i++) {
+            orientations[component.slots[i]] = (unsigned char)(value % base);
+            sum += value % base;
+            value /= base;
+        }
+        orientations[component.slots[n - 1]] = (unsigned char)((base - sum % base) % base);
+    }
+}
+
+// The value of a component after a move.
+static uint32_t MoveComponent(const Subgroup& subgroup, int index, uint32_t value, int move)
+{
+    const SubgroupComponent& component = subgroup.components[index];
+    if (!component.moves.empty())
+        return component.moves[value * subgroup.moves.size() + move];
+    CubePieces pieces, moved;
+    SolvedPieces(pieces);
+    DecodeComponent(component, value, pieces);
+    MoveCubePieces(subgroup.movePieces[move], pieces, moved);
+    return EncodeComponent(component, moved);
+}
+
+// The value of a component after a move, from its table or else from the pieces after the move.
+static uint32_t NextValue(const Subgroup& subgroup, int index, uint32_t value, int move, const CubePieces& moved)
+{
+    const SubgroupComponent& component = subgroup.components[index];
+    if (!component.moves.empty())
+        return component.moves[value * subgroup.moves.size() + move];
+    return EncodeComponent(component, moved);
+}
+
+static uint32_t TableSize(const Subgroup& subgroup, const SubgroupTable& table)
+{
+    uint32_t size = subgroup.components[table.components[0]].size;
+    return (table.components[1] >= 0) ? size * subgroup.components[table.components[1]].size : size;
+}
+
+static uint32_t TableIndex(const Subgroup& subgroup, const SubgroupTable& table, const uint32_t values[])
+{
+    uint32_t index = values[table.components[0]];
+    if (table.components[1] >= 0)
+        index = index * subgroup.components[table.components[1]].size + values[table.components[1]];
+    return index;
+}
+
+// Fills a pruning table with a BFS from solved, where every component is 0, a depth at a time by
+// scanning the table for the states of the last depth so no queue is needed. A component without
+// a move table is decoded once for all the moves.
+static void FillTable(const Subgroup& subgroup, SubgroupTable& table)
+{
+    const int* components = table.components;
+    uint32_t size = TableSize(subgroup, table);
+    uint32_t secondSize = (components[1] >= 0) ? subgroup.components[components[1]].size : 1;
+    bool decode = subgroup.components[components[0]].moves.empty() ||
+                  (components[1] >= 0 && subgroup.components[components[1]].moves.empty());
+    table.distances.assign(size, SUBGROUP_UNREACHED);
+    table.distances[0] = 0;
+    bool found = true;
+    for (int distance = 0; found && distance + 1 < SUBGROUP_UNREACHED; distance++) {
+        found = false;
+        for (uint32_t state = 0; state < size; state++) {
+            if (table.distances[state] != distance)
+                continue;
+            uint32_t first = state / secondSize, second = state % secondSize;
+            CubePieces pieces, moved;
+            if (decode) {
+                SolvedPieces(pieces);
+                DecodeComponent(subgroup.components[components[0]], first, pieces);
+                if (components[1] >= 0)
+                    DecodeComponent(subgroup.components[components[1]], second, pieces);
+            }
+            for (int move = 0; move < (int)subgroup.moves.size(); move++) {
+                if (decode)
+                    MoveCubePieces(subgroup.movePieces[move], pieces, moved);
+                uint32_t index = NextValue(subgroup, components[0], first, move, moved);
+                if (components[1] >= 0)
+                    index = index * secondSize + NextValue(subgroup, components[1], second, move, moved);
+                if (table.distances[index] == SUBGROUP_UNREACHED) {
+                    table.distances[index] = (unsigned char)(distance + 1);
+                    found = true;
+                }
+            }
+        }
+    }
+}
+
+static void AddComponent(Subgroup& subgroup, int kind, const int slots[], int numSlots)
+{
+    SubgroupComponent& component = subgroup.components[subgroup.numComponents++];
+    component.kind = kind;
+    component.numSlots = numSlots;
+    memset(component.slotIndex, -1, sizeof(component.slotIndex));
+    for (int i = 0; i < numSlots; i++) {
+        component.slots[i] = slots[i];
+        component.slotIndex[slots[i]] = i;
+    }
+    component.size = 1;
+    for (int i = 0; i < numSlots; i++) {
+        if (kind == COMPONENT_CORNERS || kind == COMPONENT_EDGES)
+            component.size *= i + 1;
+        else if (i > 0)
+            component.size *= (kind == COMPONENT_TWISTS) ? 3 : 2;
+    }
+}
+
+// Adds a component for each orbit of slots with more than one slot, where from[move][slot] is
+// the slot a move takes to each slot.
+static void AddOrbits(Subgroup& subgroup, int kind, int numSlots, const std::vector<const unsigned char*>& from)
+{
+    int orbit[SUBGROUP_EDGES];
+    for (int slot = 0; slot < numSlots; slot++) {
+        orbit[slot] = slot;
+    }
+    // Merge orbits until every move keeps each slot in its own.
+    for (bool merged = true; merged;) {
+        merged = false;
+        for (size_t move = 0; move < from.size(); move++) {
+            for (int slot = 0; slot < numSlots; slot++) {
+                int a = orbit[slot], b = orbit[from[move][slot]];
+                if (a == b)
+                    continue;
+                int low = (a < b) ? a : b, high = (a < b) ? b : a;
+                for (int i = 0; i < numSlots; i++) {
+                    if (orbit[i] == high)
+                        orbit[i] = low;
+                }
+                merged = true;
+            }
+        }
+    }
+    for (int first = 0; first < numSlots; first++) {
+        int slots[SUBGROUP_EDGES], count = 0;
+        for (int slot = 0; slot < numSlots; slot++) {
+            if (orbit[slot] == first)
+                slots[count++] = slot;
+        }
+        if (count > 1)
+            AddComponent(subgroup, kind, slots, count);
+    }
+}
+
+bool ParseGenerators(const char* text, std::vector<Move>& moves)
+{
+    std::vector<Move> generators;
+    moves.clear();
+    if (!ParseMoves(text, generators))
+        return false;
+    for (size_t i = 0; i < generators.size(); i++) {
+        if (generators[i].turn >= NUM_OF_FACES)
+            return false;
+        for (int d = 0; d < 3; d++) {
+            Move move = { generators[i].turn, moveDirections[d], 0.0 };
+            if (generators[i].direction != HALF_TURN || move.direction == HALF_TURN)
+                moves.push_back(move);
+        }
+    }
+    return true;
+}
+
+bool BuildSubgroup(const std::vector<Move>& moves, Subgroup& subgroup)
+{
+    if (moves.empty() || moves.size() > SUBGROUP_MAX_MOVES)
+        return false;
+    for (size_t i = 0; i < moves.size(); i++) {
+        if (moves[i].turn < 0 || moves[i].turn >= NUM_OF_FACES)
+            return false;
+        for (size_t j = 0; j < i; j++) {
+            if (moves[j].turn == moves[i].turn && moves[j].direction == moves[i].direction)
+                return false;
+        }
+    }
+
+    // What each move does to the pieces, by turning a solved cube.
+    subgroup.moves = moves;
+    subgroup.movePieces.resize(moves.size());
+    memset(subgroup.cornerMoved, 0, sizeof(subgroup.cornerMoved));
+    memset(subgroup.edgeMoved, 0, sizeof(subgroup.edgeMoved));
+    subgroup.twists = false;
+    subgroup.flips = false;
+    std::vector<const unsigned char*> cornersFrom, edgesFrom;
+    for (size_t move = 0; move < moves.size(); move++) {
+        Cube cube;
+        InitCube(cube);
+        ApplyMove(cube, moves[move]);
+        CubePieces& pieces = subgroup.movePieces[move];
+        ReadCubePieces(cube, pieces);
+        for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+            subgroup.cornerMoved[corner] |= (pieces.corners[corner] != corner);
+            subgroup.twists |= (pieces.twists[corner] != 0);
+        }
+        for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+            subgroup.edgeMoved[edge] |= (pieces.edges[edge] != edge);
+            subgroup.flips |= (pieces.flips[edge] != 0);
+        }
+        cornersFrom.push_back(pieces.corners);
+        edgesFrom.push_back(pieces.edges);
+    }
+
+    // The components: the orbits of corners, their twists, the orbits of edges and their flips.
+    subgroup.numComponents = 0;
+    AddOrbits(subgroup, COMPONENT_CORNERS, SUBGROUP_CORNERS, cornersFrom);
+    int slots[SUBGROUP_EDGES], count = 0;
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        if (subgroup.cornerMoved[corner])
+            slots[count++] = corner;
+    }
+    if (subgroup.twists)
+        AddComponent(subgroup, COMPONENT_TWISTS, slots, count);
+    AddOrbits(subgroup, COMPONENT_EDGES, SUBGROUP_EDGES, edgesFrom);
+    count = 0;
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        if (subgroup.edgeMoved[edge])
+            slots[count++] = edge;
+    }
+    if (subgroup.flips)
+        AddComponent(subgroup, COMPONENT_FLIPS, slots, count);
+
+    // Move tables of the small components.
+    for (int i = 0; i < subgroup.numComponents; i++) {
+        SubgroupComponent& component = subgroup.components[i];
+        component.moves.clear();
+        if (component.size > SUBGROUP_MAX_MOVE_TABLE)
+            continue;
+        std::vector<uint32_t> table(component.size * moves.size());
+        for (uint32_t value = 0; value < component.size; value++) {
+            for (size_t move = 0; move < moves.size(); move++) {
+                table[value * moves.size() + move] = MoveComponent(subgroup, i, value, (int)move);
+            }
+        }
+        component.moves.swap(table);
+    }
+
+    // Pruning tables of every pair that fits, then of each component left out.
+    subgroup.tables.clear();
+    bool paired[SUBGROUP_MAX_COMPONENTS] = {};
+    for (int i = 0; i < subgroup.numComponents; i++) {
+        for (int j = i + 1; j < subgroup.numComponents; j++) {
+            if ((uint64_t)subgroup.components[i].size * subgroup.components[j].size > SUBGROUP_MAX_TABLE)
+                continue;
+            SubgroupTable table;
+            table.components[0] = i;
+            table.components[1] = j;
+            subgroup.tables.push_back(table);
+            paired[i] = paired[j] = true;
+        }
+    }
+    for (int i = 0; i < subgroup.numComponents; i++) {
+        if (paired[i] || subgroup.components[i].size > SUBGROUP_MAX_TABLE)
+            continue;
+        SubgroupTable table;
+        table.components[0] = i;
+        table.components[1] = -1;
+        subgroup.tables.push_back(table);
+    }
+    for (size_t i = 0; i < subgroup.tables.size(); i++) {
+        FillTable(subgroup, subgroup.tables[i]);
+    }
+    return true;
+}
+
+// The pieces of a cube and the value of each component. Returns false if the cube is outside the subgroup in a
+// way the components can't hold: a piece the moves don't move out of place, or in another orbit,
+// or a twist or flip the moves don't make.
+static bool ComponentValues(const Subgroup& subgroup, const Cube& cube, CubePieces& pieces, uint32_t values[SUBGROUP_MAX_COMPONENTS])
+{
+    Cube recoloured;
+    RecolourByCentres(cube, recoloured);
+    if (!ReadCubePieces(recoloured, pieces))
+        return false;
+    int twists = 0, flips = 0;
+    for (int corner = 0; corner < SUBGROUP_CORNERS; corner++) {
+        if (!subgroup.cornerMoved[corner] && pieces.corners[corner] != corner)
+            return false;
+        if ((!subgroup.cornerMoved[corner] || !subgroup.twists) && pieces.twists[corner] != 0)
+            return false;
+        twists += pieces.twists[corner];
+    }
+    for (int edge = 0; edge < SUBGROUP_EDGES; edge++) {
+        if (!subgroup.edgeMoved[edge] && pieces.edges[edge] != edge)
+            return false;
+        if ((!subgroup.edgeMoved[edge] || !subgroup.flips) && pieces.flips[edge] != 0)
+            return false;
+        flips += pieces.flips[edge];
+    }
+    if (twists % 3 != 0 || flips % 2 != 0)
+        return false;
+
+    for (int i = 0; i < subgroup.numComponents; i++) {
+        const SubgroupComponent& component = subgroup.components[i];
+        if (component.kind == COMPONENT_CORNERS || component.kind == COMPONENT_EDGES) {
+            const unsigned char* slots = (component.kind == COMPONENT_CORNERS) ? pieces.corners : pieces.edges;
+            for (int j = 0; j < component.numSlots; j++) {
+                if (component.slotIndex[slots[component.slots[j]]] < 0)
+                    return false;
+            }
+        }
+        values[i] = EncodeComponent(component, pieces);
+    }
+    return true;
+}
+
+// Checks if every pruning table reaches the components.
+static bool TablesReach(const Subgroup& subgroup, const uint32_t values[])
+{
+    for (size_t i = 0; i < subgroup.tables.size(); i++) {
+        const SubgroupTable& table = subgroup.tables[i];
+        if (table.distances[TableIndex(subgroup, table, values)] == SUBGROUP_UNREACHED)
+            return false;
+    }
+    return true;
+}
+
+bool IsInSubgroup(const Subgroup& subgroup, const Cube& cube)
+{
+    CubePieces pieces;
+    uint32_t values[SUBGROUP_MAX_COMPONENTS];
+    return ComponentValues(subgroup, cube, pieces, values) && TablesReach(subgroup, values);
+}
+
+// The most moves any pruning table says are left.
+static int Heuristic(const Subgroup& subgroup, const uint32_t values[])
+{
+    int bound = 0;
+    for (size_t i = 0; i < subgroup.tables.size(); i++) {
+        const SubgroupTable& table = subgroup.tables[i];
+        int distance = table.distances[TableIndex(subgroup, table, values)];
+        if (distance > bound)
+            bound = distance;
+    }
+    return bound;
+}
+
+// The pieces are only kept up to date when a component has no move table.
+static bool SearchDepth(SubgroupSearch& search, const uint32_t values[], const CubePieces& pieces, int depth, int maxDepth, int lastMove)
+{
+    const Subgroup& subgroup = *search.subgroup;
+    if (depth + Heuristic(subgroup, values) > maxDepth)
+        return false;
+    if (depth == maxDepth) {
+        for (int i = 0; i < subgroup.numComponents; i++) {
+            if (values[i] != 0)
+                return false;
+        }
+        return true;
+    }
+    uint32_t next[SUBGROUP_MAX_COMPONENTS];
+    CubePieces moved;
+    for (int move = 0; move < search.numMoves; move++) {
+        if (!search.allowed[lastMove + 1][move])
+            continue;
+        if (search.decode)
+            MoveCubePieces(subgroup.movePieces[move], pieces, moved);
+        for (int i = 0; i < subgroup.numComponents; i++) {
+            next[i] = NextValue(subgroup, i, values[i], move, moved);
+        }
+        search.path.push_back(move);
+        if (SearchDepth(search, next, moved, depth + 1, maxDepth, move))
+            return true;
+        search.path.pop_back();
+    }
+    return false;
+}
+
+int SolveInSubgroup(const Subgroup& subgroup, const Cube& cube, int maxLength, std::vector<Move>& solution)
+{
+    solution.clear();
+    CubePieces pieces;
+    uint32_t values[SUBGROUP_MAX_COMPONENTS];
+    if (!ComponentValues(subgroup, cube, pieces, values) || !TablesReach(subgroup, values))
+        return SUBGROUP_NOT_MEMBER;
+
+    // A move is allowed after another unless it turns the same face, or the opposite face when that
+    // comes first in TURN_ order, since the two commute.
+    SubgroupSearch search;
+    search.subgroup = &subgroup;
+    search.numMoves = (int)subgroup.moves.size();
+    search.decode = false;
+    for (int i = 0; i < subgroup.numComponents; i++) {
+        search.decode |= subgroup.components[i].moves.empty();
+    }
+    for (int last = 0; last <= search.numMoves; last++) {
+        for (int move = 0; move < search.numMoves; move++) {
+            int face = subgroup.moves[move].turn;
+            int lastFace = (last > 0) ? subgroup.moves[last - 1].turn : TURN_NONE;
+            int axis, lastAxis, layers, sign;
+            TurnLayers(face, &axis, &layers, &sign);
+            if (last > 0)
+                TurnLayers(lastFace, &lastAxis, &layers, &sign);
+            search.allowed[last][move] = (last == 0) || (face != lastFace && (axis != lastAxis || face > lastFace));
+        }
+    }
+
+    if (maxLength > SUBGROUP_MAX_LENGTH)
+        maxLength = SUBGROUP_MAX_LENGTH;
+    for (int length = Heuristic(subgroup, values); length <= maxLength; length++) {
+        search.path.clear();
+        if (SearchDepth(search, values, pieces, 0, length, -1)) {
+            for (size_t i = 0; i < search.path.size(); i++) {
+                solution.push_back(subgroup.moves[search.path[i]]);
+            }
+            return SUBGROUP_FOUND;
+        }
+    }
+    return SUBGROUP_NOT_FOUND;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "cube.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// SUBGROUP SOLVERS
+//
+// Solves positions that only need some of the face turns, e.g. two-gen
+// <R,U> positions or the domino group <U,D,L2,R2,F2,B2>, with an IDA*
+// search that only ever tries those turns. Everything is worked out from
+// the set of moves:
+//
+// - The corner and edge slots the moves mix fall into orbits, and the rest
+//   stay solved. Each orbit's arrangement is a component of the state, and
+//   so are the twists of the corners and the flips of the edges when the
+//   moves change them (edges flip as usual: only F and B quarter turns).
+//   The domino group has three components: the corners, the U and D edges
+//   and the E slice edges.
+// - A component is a number, and its moves a table of numbers when it is
+//   small enough (the rest are moved by decoding them).
+// - The pruning tables are pairs of components wherever both fit in
+//   SUBGROUP_MAX_TABLE states, e.g. corners by E slice edges, and single
+//   components otherwise. Each is filled by a BFS, and the most moves any
+//   of them says are left bounds the search.
+//
+// The moves never reach what the tables never reach, so a cube is in the
+// subgroup only if the pieces it doesn't move are solved, the twists or
+// flips it doesn't change are 0, and every table reaches its components.
+// For <R,U>, <R,U,L> and <U,D,L2,R2,F2,B2> that is exact for any cube that
+// can be solved at all; for other moves it is what the tables can see.
+/////////////////////////////////////////////////////////////////////////////
+
+#define SUBGROUP_RU             "R U"
+#define SUBGROUP_RUL            "R U L"
+#define SUBGROUP_DOMINO         "U D L2 R2 F2 B2"
+
+#define SUBGROUP_CORNERS        8
+#define SUBGROUP_EDGES          12
+#define SUBGROUP_MAX_COMPONENTS 12     // Four orbits of corners, six of edges, the twists and the flips.
+#define SUBGROUP_MAX_MOVES      18
+#define SUBGROUP_MAX_TABLE      (1 << 27)  // Most states a pruning table may have, a byte each.
+#define SUBGROUP_MAX_MOVE_TABLE (1 << 17)  // Most values of a component whose moves are a table.
+#define SUBGROUP_MAX_LENGTH     40
+#define SUBGROUP_UNREACHED      255
+
+#define SUBGROUP_FOUND          0
+#define SUBGROUP_NOT_FOUND      1      // There is no solution within the length.
+#define SUBGROUP_NOT_MEMBER     2      // The cube isn't in the subgroup.
+
+#define COMPONENT_CORNERS       0      // The arrangement of an orbit of corners.
+#define COMPONENT_TWISTS        1      // The twists of every corner the moves move.
+#define COMPONENT_EDGES         2      // The arrangement of an orbit of edges.
+#define COMPONENT_FLIPS         3      // The flips of every edge the moves move.
+
+// The corners and edges of a cube by slot, each numbered by the slot it belongs in, with how far
+// each is twisted clockwise or flipped. A move's pieces are what it does to a solved cube.
+struct CubePieces {
+    unsigned char corners[SUBGROUP_CORNERS];
+    unsigned char twists[SUBGROUP_CORNERS];
+    unsigned char edges[SUBGROUP_EDGES];
+    unsigned char flips[SUBGROUP_EDGES];
+};
+
+struct SubgroupComponent {
+    int kind;                           // COMPONENT_ constant.
+    int numSlots;
+    int slots[SUBGROUP_EDGES];
+    int slotIndex[SUBGROUP_EDGES];      // Where each slot is in slots, or -1.
+    uint32_t size;                      // Values it can take: n!, 3^(n-1) or 2^(n-1).
+    std::vector<uint32_t> moves;        // Value * number of moves + move to the value after, or empty.
+};
+
+struct SubgroupTable {
+    int components[2];                  // The second is -1 for a table of one component.
+    std::vector<unsigned char> distances;       // By first value * second size + second value.
+};
+
+struct Subgroup {
+    std::vector<Move> moves;
+    std::vector<CubePieces> movePieces;
+    bool cornerMoved[SUBGROUP_CORNERS];
+    bool edgeMoved[SUBGROUP_EDGES];
+    bool twists;                        // Some move twists corners.
+    bool flips;                         // Some move flips edges.
+    int numComponents;
+    SubgroupComponent components[SUBGROUP_MAX_COMPONENTS];
+    std::vector<SubgroupTable> tables;
+};
+
+// Reads the corners and edges of a cube coloured as its faces (see RecolourByCentres). Returns false
+// if they aren't twenty different pieces.
+bool ReadCubePieces(const Cube& cube, CubePieces& pieces);
+
+// Sets result to the pieces of state after a move, given the move's pieces.
+void MoveCubePieces(const CubePieces& move, const CubePieces& state, CubePieces& result);
+
+// Parses generators in standard notation: a quarter turn stands for its three powers and a half
+// turn for itself (e.g. "U D L2" is U, U', U2, D, D', D2 and L2). Returns false if something
+// isn't a face turn.
+bool ParseGenerators(const char* text, std::vector<Move>& moves);
+
+// Works out the components and fills the pruning tables of the subgroup the moves generate. The
+// moves must be different face turns, at most SUBGROUP_MAX_MOVES of them. Returns false if they aren't.
+bool BuildSubgroup(const std::vector<Move>& moves, Subgroup& subgroup);
+
+// Checks if a cube is in the subgroup, its colours told apart by the centres.
+bool IsInSubgroup(const Subgroup& subgroup, const Cube& cube);
+
+// Sets solution to a shortest sequence of the subgroup's moves that solves the cube, each move
+// counting as one. Returns a SUBGROUP_ result.
+int SolveInSubgroup(const Subgroup& subgroup, const Cube& cube, int maxLength, std::vector<Move>& solution);
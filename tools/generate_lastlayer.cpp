@@ -0,0 +1,268 @@
+// Generates lastlayer_tables.cpp from the algorithm lists in a directory (see lastlayer.h):
+//
+//   generate_lastlayer ALGORITHM_DIR OUTPUT_FILE
+//
+// Each algorithm is checked to keep the first two layers, and each list to have one algorithm for
+// every case, before anything is written.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "cube.h"
+#include "lastlayer.h"
+#include "pattern.h"
+
+#define OLL_CASES       58      // Including the skip, which needs no algorithm.
+#define PLL_CASES       22
+
+// The tables are what this makes, so it links without them and never looks a case up.
+const LastLayerTable lastLayerTables[NUM_OF_LAST_LAYER_SETS] = {};
+
+struct GeneratedCase {
+    std::string name;
+    std::string algorithm;
+    int length;                 // Moves in the algorithm, to keep the shortest of a ZBLL case.
+    uint64_t key;
+    int turns;
+    Cube state;                 // The last layer the algorithm solves.
+};
+
+struct GeneratedSet {
+    const char* name;
+    std::vector<GeneratedCase> cases;
+};
+
+// Works out the state an algorithm solves and its key. Prints the reason and returns false if the
+// algorithm can't be parsed or doesn't keep the first two layers (and, for PLL, the orientation).
+static bool MakeCase(const char* name, const char* algorithm, int set, GeneratedCase& generated)
+{
+    std::vector<Move> moves;
+    if (!ParseMoves(algorithm, moves)) {
+        printf("%s: '%s' is not a sequence of moves.\n", name, algorithm);
+        return false;
+    }
+
+    Cube cube;
+    InitCube(cube);
+    for (size_t i = moves.size(); i > 0; i--) {
+        ApplyMove(cube, InverseMove(moves[i - 1]));
+    }
+
+    Pattern pattern;
+    MakeStagePattern(set == LAST_LAYER_PLL ? PATTERN_OLL : PATTERN_F2L, pattern);
+    PackedCube packed;
+    PackCube(cube, packed);
+    if (!MatchPattern(packed, pattern)) {
+        printf("%s: '%s' doesn't keep the %s.\n", name, algorithm,
+               set == LAST_LAYER_PLL ? "last layer oriented" : "first two layers");
+        return false;
+    }
+
+    generated.name = name;
+    generated.algorithm = algorithm;
+    generated.length = (int)moves.size();
+    generated.key = LastLayerKey(cube, set, &generated.turns);
+    generated.state = cube;
+    return true;
+}
+
+// Reads a list of "name: algorithm" lines, after a skip case with no algorithm. Everything after a
+// '#' on a line is ignored.
+static bool ReadCases(const char* filename, const char* skipName, int set, GeneratedSet& generated)
+{
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        printf("Unable to open algorithm file '%s'.\n", filename);
+        return false;
+    }
+
+    generated.cases.resize(1);
+    bool ok = MakeCase(skipName, "", set, generated.cases[0]);
+
+    char line[1024];
+    int lineNumber = 0;
+    while (ok && fgets(line, sizeof(line), file) != NULL) {
+        lineNumber++;
+        char* comment = strchr(line, '#');
+        if (comment != NULL)
+            *comment = '\0';
+        if (strspn(line, " \t\r\n") == strlen(line))
+            continue;
+
+        char* colon = strchr(line, ':');
+        if (colon == NULL) {
+            printf("%s:%d: expected a name and a colon.\n", filename, lineNumber);
+            ok = false;
+            break;
+        }
+        *colon = '\0';
+        char* algorithm = colon + 1;
+        algorithm += strspn(algorithm, " \t");
+        algorithm[strcspn(algorithm, "\r\n")] = '\0';
+
+        GeneratedCase generatedCase;
+        ok = MakeCase(line, algorithm, set, generatedCase);
+        generated.cases.push_back(generatedCase);
+    }
+    fclose(file);
+    return ok;
+}
+
+// Checks no two cases of a set are the same and that the set has all of them.
+static bool CheckCases(const GeneratedSet& generated, size_t expected)
+{
+    for (size_t i = 0; i < generated.cases.size(); i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (generated.cases[i].key == generated.cases[j].key) {
+                printf("%s: '%s' and '%s' solve the same case.\n", generated.name,
+                       generated.cases[j].name.c_str(), generated.cases[i].name.c_str());
+                return false;
+            }
+        }
+    }
+    if (generated.cases.size() != expected) {
+        printf("%s: %d cases, expected %d.\n", generated.name, (int)generated.cases.size(), (int)expected);
+        return false;
+    }
+    return true;
+}
+
+static const char* AufText(int turns)
+{
+    static const char* const texts[4] = { "", "U ", "U2 ", "U' " };
+    return texts[turns];
+}
+
+// Every ZBLL case, solved by U turns, an OLL that keeps the edges oriented (or none), U turns and a
+// PLL, keeping the shortest algorithm for each.
+static bool MakeZbllCases(const GeneratedSet& oll, const GeneratedSet& pll, GeneratedSet& zbll)
+{
+    for (size_t o = 0; o < oll.cases.size(); o++) {
+        const Cube& state = oll.cases[o].state;
+        if (state.stickers[FACE_UP][1] != FACE_UP || state.stickers[FACE_UP][3] != FACE_UP ||
+            state.stickers[FACE_UP][5] != FACE_UP || state.stickers[FACE_UP][7] != FACE_UP)
+            continue;
+
+        for (int before = 0; before < 4; before++) {
+            for (int between = 0; between < 4; between++) {
+                for (size_t p = 0; p < pll.cases.size(); p++) {
+                    std::string algorithm = std::string(AufText(before)) + oll.cases[o].algorithm + " " +
+                                            AufText(between) + pll.cases[p].algorithm;
+                    GeneratedCase generatedCase;
+                    if (!MakeCase("ZBLL", algorithm.c_str(), LAST_LAYER_ZBLL, generatedCase))
+                        return false;
+
+                    size_t i = 0;
+                    while (i < zbll.cases.size() && zbll.cases[i].key != generatedCase.key) {
+                        i++;
+                    }
+                    if (i == zbll.cases.size())
+                        zbll.cases.push_back(generatedCase);
+                    else if (generatedCase.length < zbll.cases[i].length)
+                        zbll.cases[i] = generatedCase;
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < zbll.cases.size(); i++) {
+        // Trim the spaces left by empty parts.
+        std::string& algorithm = zbll.cases[i].algorithm;
+        std::string trimmed;
+        for (size_t c = 0; c < algorithm.size(); c++) {
+            if (algorithm[c] != ' ' || (!trimmed.empty() && trimmed.back() != ' '))
+                trimmed += algorithm[c];
+        }
+        while (!trimmed.empty() && trimmed.back() == ' ') {
+            trimmed.pop_back();
+        }
+        algorithm = trimmed;
+        zbll.cases[i].name = "ZBLL " + std::to_string(i + 1);
+    }
+    return true;
+}
+
+// Bits of a table for a set, so it is at most half full and probe sequences stay short.
+static int TableBits(const GeneratedSet& generated)
+{
+    int bits = 1;
+    while ((size_t)1 << bits < 2 * generated.cases.size()) {
+        bits++;
+    }
+    return bits;
+}
+
+static void WriteSet(FILE* file, const GeneratedSet& generated)
+{
+    fprintf(file, "static const LastLayerCase %sCases[%d] = {\n", generated.name, (int)generated.cases.size());
+    for (size_t i = 0; i < generated.cases.size(); i++) {
+        fprintf(file, "    { \"%s\", \"%s\" },\n", generated.cases[i].name.c_str(), generated.cases[i].algorithm.c_str());
+    }
+    fprintf(file, "};\n\n");
+
+    int bits = TableBits(generated);
+    std::vector<LastLayerEntry> entries((size_t)1 << bits);
+    memset(entries.data(), 0, entries.size() * sizeof(LastLayerEntry));
+    int mask = (1 << bits) - 1;
+    for (size_t i = 0; i < generated.cases.size(); i++) {
+        int slot = LastLayerSlot(generated.cases[i].key, bits);
+        while (entries[slot].signature != 0) {
+            slot = (slot + 1) & mask;
+        }
+        entries[slot].signature = generated.cases[i].key;
+        entries[slot].caseIndex = (unsigned short)i;
+        entries[slot].turns = (unsigned char)generated.cases[i].turns;
+    }
+
+    fprintf(file, "static const LastLayerEntry %sEntries[%d] = {\n", generated.name, 1 << bits);
+    for (size_t slot = 0; slot < entries.size(); slot++) {
+        fprintf(file, "    { 0x%016llxULL, %d, %d },\n", (unsigned long long)entries[slot].signature,
+                entries[slot].caseIndex, entries[slot].turns);
+    }
+    fprintf(file, "};\n\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        printf("Usage: generate_lastlayer ALGORITHM_DIR OUTPUT_FILE\n");
+        return 1;
+    }
+
+    GeneratedSet sets[NUM_OF_LAST_LAYER_SETS];
+    sets[LAST_LAYER_OLL].name = "oll";
+    sets[LAST_LAYER_PLL].name = "pll";
+    sets[LAST_LAYER_ZBLL].name = "zbll";
+
+    std::string directory = argv[1];
+    if (!ReadCases((directory + "/oll.txt").c_str(), "OLL skip", LAST_LAYER_OLL, sets[LAST_LAYER_OLL]) ||
+        !CheckCases(sets[LAST_LAYER_OLL], OLL_CASES) ||
+        !ReadCases((directory + "/pll.txt").c_str(), "PLL skip", LAST_LAYER_PLL, sets[LAST_LAYER_PLL]) ||
+        !CheckCases(sets[LAST_LAYER_PLL], PLL_CASES) ||
+        !MakeZbllCases(sets[LAST_LAYER_OLL], sets[LAST_LAYER_PLL], sets[LAST_LAYER_ZBLL]))
+        return 1;
+
+    FILE* file = fopen(argv[2], "w");
+    if (file == NULL) {
+        printf("Unable to create '%s'.\n", argv[2]);
+        return 1;
+    }
+    fprintf(file, "// Generated by tools/generate_lastlayer.cpp from the lists in algorithms/. Don't edit.\n\n");
+    fprintf(file, "#include \"lastlayer.h\"\n\n");
+    for (int set = 0; set < NUM_OF_LAST_LAYER_SETS; set++) {
+        WriteSet(file, sets[set]);
+    }
+    fprintf(file, "const LastLayerTable lastLayerTables[NUM_OF_LAST_LAYER_SETS] = {\n");
+    for (int set = 0; set < NUM_OF_LAST_LAYER_SETS; set++) {
+        fprintf(file, "    { %sEntries, %d, %sCases, %d },\n", sets[set].name, TableBits(sets[set]), sets[set].name, (int)sets[set].cases.size());
+    }
+    fprintf(file, "};\n");
+    fclose(file);
+
+    for (int set = 0; set < NUM_OF_LAST_LAYER_SETS; set++) {
+        printf("%s: %d cases\n", sets[set].name, (int)sets[set].cases.size());
+    }
+    return 0;
+}
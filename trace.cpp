@@ -0,0 +1,131 @@
+#include <stdio.h>
+
+#include "trace.h"
+
+#ifdef CUBE_TRACE
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+static_assert((TRACE_EVENTS_PER_THREAD & (TRACE_EVENTS_PER_THREAD - 1)) == 0, "TRACE_EVENTS_PER_THREAD must be a power of two");
+
+struct TraceEvent {
+    const char* name;
+    uint64_t startTime;     // Nanoseconds since tracing started.
+    uint64_t duration;      // Nanoseconds.
+};
+
+// The events of one thread. Only that thread writes to it; count is published with release
+// ordering so the events before it can be read by the thread writing the trace.
+struct TraceBuffer {
+    TraceEvent events[TRACE_EVENTS_PER_THREAD];
+    std::atomic<uint64_t> count;            // Events recorded, including overwritten ones.
+    std::atomic<const char*> threadName;
+    int threadId;
+};
+
+static const std::chrono::steady_clock::time_point traceStart = std::chrono::steady_clock::now();
+
+// Every thread's buffer, registered the first time it records an event. Buffers are never freed,
+// so the events of threads that have finished can still be written.
+static std::mutex buffersMutex;
+static std::vector<TraceBuffer*> buffers;
+static thread_local TraceBuffer* threadBuffer = NULL;
+
+static TraceBuffer* GetThreadBuffer()
+{
+    if (threadBuffer == NULL) {
+        TraceBuffer* buffer = new TraceBuffer;
+        buffer->count.store(0, std::memory_order_relaxed);
+        buffer->threadName.store(NULL, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffer->threadId = (int)buffers.size() + 1;
+        buffers.push_back(buffer);
+        threadBuffer = buffer;
+    }
+    return threadBuffer;
+}
+
+uint64_t TraceNow()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceStart).count();
+}
+
+void TraceRecord(const char* name, uint64_t startTime)
+{
+    uint64_t endTime = TraceNow();
+    TraceBuffer* buffer = GetThreadBuffer();
+    uint64_t index = buffer->count.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer->events[index & (TRACE_EVENTS_PER_THREAD - 1)];
+    event.name = name;
+    event.startTime = startTime;
+    event.duration = endTime - startTime;
+    buffer->count.store(index + 1, std::memory_order_release);
+}
+
+void TraceSetThreadName(const char* name)
+{
+    GetThreadBuffer()->threadName.store(name, std::memory_order_relaxed);
+}
+
+bool TraceWriteJson(const char* filename)
+{
+    FILE* file = fopen(filename, "w");
+    if (file == NULL)
+        return false;
+
+    std::vector<TraceBuffer*> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        snapshot = buffers;
+    }
+
+    // Complete ("X") events, in microseconds, then a name for every thread.
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    bool first = true;
+    for (size_t i = 0; i < snapshot.size(); i++) {
+        TraceBuffer* buffer = snapshot[i];
+        uint64_t count = buffer->count.load(std::memory_order_acquire);
+        uint64_t oldest = (count > TRACE_EVENTS_PER_THREAD) ? count - TRACE_EVENTS_PER_THREAD : 0;
+        for (uint64_t index = oldest; index < count; index++) {
+            const TraceEvent& event = buffer->events[index & (TRACE_EVENTS_PER_THREAD - 1)];
+            fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    first ? "" : ",\n", event.name, buffer->threadId, event.startTime / 1000.0, event.duration / 1000.0);
+            first = false;
+        }
+    }
+    for (size_t i = 0; i < snapshot.size(); i++) {
+        const char* name = snapshot[i]->threadName.load(std::memory_order_relaxed);
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                first ? "" : ",\n", snapshot[i]->threadId, (name != NULL) ? name : "thread");
+        first = false;
+    }
+    fprintf(file, "\n]}\n");
+
+    bool ok = !ferror(file);
+    if (fclose(file) != 0)
+        ok = false;
+    return ok;
+}
+
+bool TraceEnabled()
+{
+    return true;
+}
+
+#else
+
+bool TraceWriteJson(const char* filename)
+{
+    return false;
+}
+
+bool TraceEnabled()
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////////////////
+// TIMELINE TRACING
+//
+// Scoped markers record when a block of code ran and for how long. Every
+// thread writes its events into its own ring buffer, so recording one is a
+// clock read and a few stores, with no locks. The rings can be written out
+// as Chrome trace JSON, which chrome://tracing and ui.perfetto.dev open.
+//
+// Tracing is only compiled in when CUBE_TRACE is defined. Otherwise the
+// markers expand to nothing and TraceWriteJson reports that it's disabled.
+/////////////////////////////////////////////////////////////////////////////
+
+#define TRACE_EVENTS_PER_THREAD 65536   // Events kept per thread before the oldest are overwritten.
+
+#ifdef CUBE_TRACE
+
+// Nanoseconds since the first call.
+uint64_t TraceNow();
+
+// Records an event that started at startTime (from TraceNow) and ends now.
+// name must outlive the trace, e.g. a string literal.
+void TraceRecord(const char* name, uint64_t startTime);
+
+// Names the calling thread in the trace.
+void TraceSetThreadName(const char* name);
+
+// Records the time from its construction to the end of the enclosing scope.
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : scopeName(name), startTime(TraceNow()) {}
+    ~TraceScope() { TraceRecord(scopeName, startTime); }
+
+private:
+    const char* scopeName;
+    uint64_t startTime;
+};
+
+#define TRACE_CONCAT_INNER(a, b)    a##b
+#define TRACE_CONCAT(a, b)          TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name)           TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_THREAD_NAME(name)     TraceSetThreadName(name)
+
+#else
+
+#define TRACE_SCOPE(name)
+#define TRACE_THREAD_NAME(name)
+
+#endif
+
+// Writes the events of every thread as Chrome trace JSON. Events recorded while writing
+// may be missing. Returns false if the file could not be written or tracing is disabled.
+bool TraceWriteJson(const char* filename);
+
+// True if the program was built with CUBE_TRACE.
+bool TraceEnabled();